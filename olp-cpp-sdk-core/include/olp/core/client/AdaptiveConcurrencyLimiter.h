@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace client {
+
+/**
+ * @brief Controls the adaptive concurrency limit.
+ *
+ * The limit is adjusted with the additive increase/multiplicative decrease
+ * (AIMD) rule. While the latency stays close to the lowest observed latency,
+ * the limit grows by one every `limit` completed requests, so the throughput
+ * grows as well. Overload responses and latency inflation decrease the limit
+ * by `backoff_ratio`.
+ */
+struct CORE_API AdaptiveConcurrencySettings {
+  /**
+   * @brief The limit that is used before any request is completed.
+   *
+   * The default value is 4.
+   */
+  size_t initial_limit = 4u;
+
+  /**
+   * @brief The lower bound of the limit.
+   *
+   * The default value is 1.
+   */
+  size_t min_limit = 1u;
+
+  /**
+   * @brief The upper bound of the limit.
+   *
+   * The default value is 64.
+   */
+  size_t max_limit = 64u;
+
+  /**
+   * @brief The factor in the range (0, 1) applied to the limit on overload.
+   *
+   * The default value is 0.5.
+   */
+  double backoff_ratio = 0.5;
+
+  /**
+   * @brief The allowed ratio of the request latency to the lowest observed
+   * latency.
+   *
+   * Higher latencies are treated as the queueing on a congested link.
+   *
+   * The default value is 2.0.
+   */
+  double latency_tolerance = 2.0;
+};
+
+/**
+ * @brief Limits the number of concurrent requests adaptively.
+ *
+ * The limiter can be shared between several operations that use the same
+ * link. Tasks passed to `Acquire` run when a slot is available; every
+ * acquired slot must be returned with `Release`. The limit is adjusted by the
+ * samples passed to `Update`.
+ *
+ * The baseline latency is the lowest observed one. If the link becomes
+ * slower, the limit drops to the minimum, and the baseline is relearned from
+ * the samples taken there.
+ */
+class CORE_API AdaptiveConcurrencyLimiter {
+ public:
+  /// The classification of a completed request.
+  enum class Outcome {
+    /// The request succeeded; the latency is used to adjust the limit.
+    kSuccess,
+    /// The server or the link is overloaded, e.g. HTTP 429 or 503, timeout.
+    kOverload,
+    /// The request says nothing about the link, e.g. it was cancelled.
+    kIgnored
+  };
+
+  /**
+   * @brief Creates the `AdaptiveConcurrencyLimiter` instance.
+   *
+   * @param settings The limiter settings.
+   */
+  explicit AdaptiveConcurrencyLimiter(
+      AdaptiveConcurrencySettings settings = AdaptiveConcurrencySettings());
+
+  AdaptiveConcurrencyLimiter(const AdaptiveConcurrencyLimiter&) = delete;
+  AdaptiveConcurrencyLimiter& operator=(const AdaptiveConcurrencyLimiter&) =
+      delete;
+
+  /**
+   * @brief Runs the task when a slot is available.
+   *
+   * The task is called without the internal lock held, either immediately on
+   * the calling thread or on the thread that releases a slot. It owns the slot
+   * and must call `Release` eventually.
+   *
+   * @param task The task to run.
+   */
+  void Acquire(std::function<void()> task);
+
+  /// Returns a slot and runs the queued tasks that fit into the limit.
+  void Release();
+
+  /**
+   * @brief Adjusts the limit with a completed request.
+   *
+   * Must be called before the slot of the request is released.
+   *
+   * @param latency The time from the start to the end of the request.
+   * @param outcome The classification of the request.
+   */
+  void Update(std::chrono::milliseconds latency, Outcome outcome);
+
+  /**
+   * @brief Classifies the HTTP status or the `ErrorCode` of a request.
+   *
+   * @param status The HTTP status code or the negative `ErrorCode` value.
+   *
+   * @return `kOverload` for HTTP 429, 503, and timeouts, `kIgnored` for the
+   * cancelled requests and the network errors, and `kSuccess` otherwise.
+   */
+  static Outcome Classify(int status);
+
+  /// Gets the current limit.
+  size_t GetLimit() const;
+
+  /// Gets the number of acquired slots.
+  size_t GetInFlight() const;
+
+  /// Gets the number of the tasks waiting for a slot.
+  size_t GetQueueSize() const;
+
+ private:
+  size_t LimitUnsafe() const;
+
+  /// Runs the queued tasks; must be called with the `lock` held.
+  void DrainUnsafe(std::unique_lock<std::mutex>& lock);
+
+  const AdaptiveConcurrencySettings settings_;
+
+  mutable std::mutex mutex_;
+  double limit_;
+  size_t in_flight_{0u};
+  bool draining_{false};
+  std::deque<std::function<void()>> queue_;
+
+  std::chrono::milliseconds baseline_latency_;
+  std::chrono::milliseconds window_min_latency_;
+  size_t window_samples_{0u};
+  size_t decrease_holdoff_{0u};
+};
+
+}  // namespace client
+}  // namespace olp
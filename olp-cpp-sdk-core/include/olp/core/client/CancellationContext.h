@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,9 +19,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include <olp/core/CoreApi.h>
 #include <olp/core/client/CancellationToken.h>
@@ -90,8 +92,8 @@ class CORE_API CancellationContext {
    */
   struct CancellationContextImpl {
     /**
-     * @brief The mutex lock used to protect the `CancellationContext` object
-     * from the concurrent read and write operations.
+     * @brief The mutex lock used to serialize the registration of
+     * the suboperation token with its cancellation.
      */
     mutable std::recursive_mutex mutex_;
     /**
@@ -103,8 +105,10 @@ class CORE_API CancellationContext {
     CancellationToken sub_operation_cancel_token_{};
     /**
      * @brief The flag that is set to `true` for `CancelOperation()`.
+     *
+     * Once set, it is never reset, so it is read without the lock.
      */
-    bool is_cancelled_{false};
+    std::atomic<bool> is_cancelled_{false};
   };
 
   /**
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -32,44 +32,41 @@ inline bool CancellationContext::ExecuteOrCancelled(
     return true;
   }
 
-  std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+  if (!impl_->is_cancelled_.load(std::memory_order_acquire)) {
+    if (!execute_fn) {
+      return true;
+    }
 
-  if (impl_->is_cancelled_) {
-    if (cancel_fn) {
-      cancel_fn();
+    // The lock makes the cancellation wait until the token is registered.
+    std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    if (!impl_->is_cancelled_.load(std::memory_order_acquire)) {
+      impl_->sub_operation_cancel_token_ = execute_fn();
+      return true;
     }
-    return false;
   }
 
-  if (execute_fn) {
-    impl_->sub_operation_cancel_token_ = execute_fn();
+  if (cancel_fn) {
+    cancel_fn();
   }
-
-  return true;
+  return false;
 }
 
 inline void CancellationContext::CancelOperation() {
-  if (!impl_) {
+  if (!impl_ ||
+      impl_->is_cancelled_.exchange(true, std::memory_order_acq_rel)) {
     return;
   }
 
-  std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
-  if (impl_->is_cancelled_) {
-    return;
+  CancellationToken token;
+  {
+    std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
+    std::swap(token, impl_->sub_operation_cancel_token_);
   }
-
-  impl_->sub_operation_cancel_token_.Cancel();
-  impl_->sub_operation_cancel_token_ = CancellationToken();
-  impl_->is_cancelled_ = true;
+  token.Cancel();
 }
 
 inline bool CancellationContext::IsCancelled() const {
-  if (!impl_) {
-    return false;
-  }
-
-  std::lock_guard<std::recursive_mutex> lock(impl_->mutex_);
-  return impl_->is_cancelled_;
+  return impl_ && impl_->is_cancelled_.load(std::memory_order_acquire);
 }
 
 inline size_t CancellationContextHash::operator()(
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace client {
+
+/**
+ * @brief Controls the hedging of idempotent GET requests.
+ *
+ * When a GET request does not receive the first byte of the response within
+ * the hedging delay, a duplicate request is sent. The first completed response
+ * is used, and the other request is cancelled.
+ *
+ * The delay follows the observed time to first byte, so only the slowest
+ * requests are hedged. The budget caps the additional load: each request
+ * earns `budget_ratio` of a hedge, and each hedge spends one.
+ */
+struct CORE_API HedgingSettings {
+  /**
+   * @brief The percentile of the observed time to first byte that is used as
+   * the hedging delay.
+   *
+   * The default value is 95.
+   */
+  double delay_percentile = 95.0;
+
+  /**
+   * @brief The hedging delay that is used until `min_samples` requests are
+   * observed.
+   *
+   * The default value is 500 milliseconds.
+   */
+  std::chrono::milliseconds initial_delay = std::chrono::milliseconds(500);
+
+  /**
+   * @brief The lower limit of the hedging delay.
+   *
+   * The default value is 10 milliseconds.
+   */
+  std::chrono::milliseconds min_delay = std::chrono::milliseconds(10);
+
+  /**
+   * @brief The number of observed requests required to use the percentile.
+   *
+   * The default value is 20.
+   */
+  size_t min_samples = 20u;
+
+  /**
+   * @brief The share of hedged requests in the range [0, 1].
+   *
+   * The default value is 0.05, so at most 5% of the requests are duplicated.
+   */
+  double budget_ratio = 0.05;
+
+  /**
+   * @brief The maximum number of hedges that can be accumulated.
+   *
+   * Limits the burst of hedges after a long period without slow requests.
+   *
+   * The default value is 10.
+   */
+  double max_budget = 10.0;
+};
+
+}  // namespace client
+}  // namespace olp
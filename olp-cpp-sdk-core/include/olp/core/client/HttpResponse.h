@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,12 +19,14 @@
 
 #pragma once
 
+#include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <olp/core/CoreApi.h>
+#include <olp/core/http/BufferChain.h>
 #include <olp/core/http/NetworkTypes.h>
 
 namespace olp {
@@ -123,6 +125,21 @@ class CORE_API HttpResponse {
         response_(std::move(response)),
         headers_(std::move(headers)) {}
 
+  /**
+   * @brief Creates the `HttpResponse` instance.
+   *
+   * The response body is kept in the chunks of the `BufferChain`, so copies
+   * of this response share the data instead of duplicating it.
+   *
+   * @param status The HTTP status.
+   * @param response The response body.
+   * @param headers Response headers.
+   */
+  HttpResponse(int status, http::BufferChain response, http::Headers headers)
+      : status_(status),
+        buffer_(std::move(response)),
+        headers_(std::move(headers)) {}
+
   /**
    * @brief A copy constructor.
    *
@@ -133,8 +150,13 @@ class CORE_API HttpResponse {
    */
   HttpResponse(const HttpResponse& other)
       : status_(other.status_),
+        buffer_(other.buffer_),
         headers_(other.headers_),
         network_statistics_(other.network_statistics_) {
+    if (!other.buffer_.Empty()) {
+      return;
+    }
+
     response_ << other.response_.rdbuf();
     if (!response_.good()) {
       // Depending on the users handling of the stringstream it might be that
@@ -156,8 +178,11 @@ class CORE_API HttpResponse {
   HttpResponse& operator=(const HttpResponse& other) {
     if (this != &other) {
       status_ = other.status_;
+      buffer_ = other.buffer_;
       response_ = std::stringstream{};
-      response_ << other.response_.rdbuf();
+      if (buffer_.Empty()) {
+        response_ << other.response_.rdbuf();
+      }
       headers_ = other.headers_;
       network_statistics_ = other.network_statistics_;
     }
@@ -177,6 +202,12 @@ class CORE_API HttpResponse {
    * @param output Reference to a vector.
    */
   void GetResponse(std::vector<unsigned char>& output) {
+    if (!buffer_.Empty()) {
+      output.resize(buffer_.Size());
+      buffer_.CopyTo(output.data());
+      return;
+    }
+
     response_.seekg(0, std::ios::end);
     const auto pos = response_.tellg();
     if (pos > 0) {
@@ -192,7 +223,9 @@ class CORE_API HttpResponse {
    *
    * @param output Reference to a string.
    */
-  void GetResponse(std::string& output) const { output = response_.str(); }
+  void GetResponse(std::string& output) const {
+    output = buffer_.Empty() ? response_.str() : buffer_.ToString();
+  }
 
   /**
    * @brief Get the response body as a vector of unsigned chars.
@@ -216,12 +249,51 @@ class CORE_API HttpResponse {
     return result;
   }
 
+  /**
+   * @brief Moves the response body out of this response.
+   *
+   * Does not copy the data when the body was received into a single
+   * `BufferChain` chunk, which is the case when the size of the body is known
+   * in advance. The response body is empty after the call.
+   *
+   * @return The response body as a vector of unsigned chars.
+   */
+  std::shared_ptr<std::vector<unsigned char>> ReleaseResponseAsBytes() {
+    if (!buffer_.Empty()) {
+      return buffer_.Release();
+    }
+
+    auto bytes = std::make_shared<std::vector<unsigned char>>();
+    GetResponse(*bytes);
+    response_ = std::stringstream{};
+    return bytes;
+  }
+
+  /**
+   * @brief Return the reference to the response buffer.
+   *
+   * The buffer is empty if the response body is stored in the stream, see
+   * `GetRawResponse`.
+   *
+   * @return The reference to the response buffer.
+   */
+  const http::BufferChain& GetResponseBuffer() const { return buffer_; }
+
   /**
    * @brief Return the reference to the response object.
    *
+   * If the response body is stored in the `BufferChain`, it is moved into the
+   * stream by this call.
+   *
    * @return The reference to the response object.
    */
-  std::stringstream& GetRawResponse() { return response_; }
+  std::stringstream& GetRawResponse() {
+    if (!buffer_.Empty()) {
+      response_.str(buffer_.ToString());
+      buffer_.Clear();
+    }
+    return response_;
+  }
 
   /**
    * @brief Return the const reference to the response headers.
@@ -261,6 +333,7 @@ class CORE_API HttpResponse {
  private:
   int status_{static_cast<int>(olp::http::ErrorCode::UNKNOWN_ERROR)};
   std::stringstream response_;
+  http::BufferChain buffer_;
   http::Headers headers_;
   NetworkStatistics network_statistics_;
 };
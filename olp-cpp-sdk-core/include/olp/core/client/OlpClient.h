@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -179,6 +179,36 @@ class CORE_API OlpClient {
                              std::string content_type,
                              CancellationContext context) const;
 
+  /**
+   * @brief Executes the HTTP request with a streamed body through the network
+   * stack in a blocking way.
+   *
+   * The body is read from the stream while the request is sent, so it does
+   * not have to fit in memory. Before each retry, the stream is rewound to the
+   * position that it had when this method was called. If the stream is not
+   * seekable, the request is not retried.
+   *
+   * @param path The path that is appended to the base URL.
+   * @param method Select one of the following methods: `POST` or `PUT`.
+   * @param query_params The parameters that are appended to the URL path.
+   * @param header_params The headers used to customize the request.
+   * @param body_stream The stream that provides the request body. It must not
+   * be accessed until the request is completed.
+   * @param body_size The number of bytes to send from the stream. If not set,
+   * the body is sent with the chunked transfer encoding.
+   * @param content_type The content type for the `body_stream`.
+   * @param context The `CancellationContext` instance that is used to cancel
+   * the request.
+   *
+   * @return The `HttpResponse` instance.
+   */
+  HttpResponse CallApiWithBodyStream(
+      std::string path, std::string method, ParametersType query_params,
+      ParametersType header_params,
+      http::NetworkRequest::RequestBodyStreamType body_stream,
+      porting::optional<std::uint64_t> body_size, std::string content_type,
+      CancellationContext context) const;
+
  private:
   class OlpClientImpl;
   std::shared_ptr<OlpClientImpl> impl_;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -32,6 +33,7 @@
 #include <olp/core/client/RetrySettings.h>
 #include <olp/core/http/Network.h>
 #include <olp/core/porting/optional.h>
+#include <olp/core/thread/SchedulingGroup.h>
 
 namespace olp {
 namespace cache {
@@ -170,6 +172,20 @@ struct CORE_API ApiLookupSettings {
    * `lookup_endpoint_provider` is not called additionally.
    */
   CatalogEndpointProvider catalog_endpoint_provider = nullptr;
+
+  /**
+   * @brief Pre-warms the connections to the services of a catalog.
+   *
+   * The API Lookup Service returns the URLs of all the services of a catalog
+   * at once. If enabled, the clients of all the returned services are cached,
+   * so the lookups of the other services do not need additional requests, and
+   * a `HEAD` request is sent in the background to every newly discovered
+   * host. This opens the pooled connection, including the DNS lookup and the
+   * TLS handshake, before the first data request needs it.
+   *
+   * Disabled by default.
+   */
+  bool prewarm_connections = false;
 };
 
 /**
@@ -209,6 +225,21 @@ struct CORE_API OlpClientSettings {
    */
   std::shared_ptr<thread::TaskScheduler> task_scheduler = nullptr;
 
+  /**
+   * @brief The scheduling group of the client tasks.
+   *
+   * When set, the clients schedule their tasks to the `task_scheduler` in
+   * the group, so a scheduler shared by many clients serves the groups
+   * fairly. The clients created with the same group share it: set a new
+   * `thread::SchedulingGroup` instance for each client, or use
+   * `thread::SchedulingGroup::FromKey` with the catalog HRN to group
+   * the clients of a catalog.
+   *
+   * The group takes effect with a scheduler that supports the groups, for
+   * example, `thread::ThreadPoolTaskScheduler`.
+   */
+  porting::optional<thread::SchedulingGroup> scheduling_group = porting::none;
+
   /**
    * @brief The `Network` instance.
    *
@@ -246,7 +277,30 @@ struct CORE_API OlpClientSettings {
    * By default, this setting is set to `false`.
    */
   bool propagate_all_cache_errors = false;
+
+  /**
+   * @brief The number of byte ranges in which the layer clients download
+   * large blobs concurrently.
+   *
+   * Applies to the uncompressed blobs bigger than 8 MB whose size is known
+   * from the partition metadata. Set to 0 or 1 to download every blob with
+   * a single request. By default, the ranged download is disabled.
+   */
+  size_t blob_download_ranges = 0u;
 };
 
+/**
+ * @brief Applies the scheduling group of the settings to the task scheduler.
+ *
+ * Used by the clients to schedule their tasks in the group.
+ *
+ * @param settings The client settings.
+ *
+ * @return The settings with the `task_scheduler` that schedules the tasks in
+ * the `scheduling_group`, and without the group; or the unchanged settings if
+ * no group is set.
+ */
+CORE_API OlpClientSettings ApplySchedulingGroup(OlpClientSettings settings);
+
 }  // namespace client
 }  // namespace olp
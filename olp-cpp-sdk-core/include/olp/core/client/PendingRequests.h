@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -33,6 +34,9 @@ namespace client {
 
 /**
  * @brief A container for requests that have not finished yet.
+ *
+ * The requests are distributed between several independently locked shards,
+ * so the concurrent insertions and removals rarely contend.
  */
 class CORE_API PendingRequests final {
  public:
@@ -77,8 +81,18 @@ class CORE_API PendingRequests final {
 
  private:
   using ContextMap = std::unordered_set<TaskContext, TaskContextHash>;
-  ContextMap task_contexts_;
-  mutable std::mutex task_contexts_lock_;
+
+  /// A part of the requests guarded by its own mutex.
+  struct Shard {
+    ContextMap task_contexts;
+    mutable std::mutex mutex;
+  };
+
+  static constexpr size_t kShardCount = 16u;
+
+  Shard& GetShard(const TaskContext& task_context);
+
+  std::array<Shard, kShardCount> shards_;
 };
 
 }  // namespace client
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace client {
+
+/**
+ * @brief Controls the client-side rate limiting of a host.
+ *
+ * The rate limiting starts when the host responds with HTTP 429 or 503. From
+ * then on, the requests of all the `OlpClient` instances in the process to
+ * this host share one token bucket, and no request is sent before the time
+ * given by the `Retry-After` header. The rate limiting stops when the host
+ * does not reject requests for `throttle_period`.
+ */
+struct CORE_API RateLimitSettings {
+  /**
+   * @brief The rate at which the tokens are added to the bucket.
+   *
+   * The default value is 10.
+   */
+  double requests_per_second = 10.0;
+
+  /**
+   * @brief The capacity of the bucket.
+   *
+   * The default value is 10.
+   */
+  size_t burst = 10u;
+
+  /**
+   * @brief The time after the last rejected request when the rate limiting
+   * stops.
+   *
+   * The default value is 60 seconds.
+   */
+  std::chrono::seconds throttle_period = std::chrono::seconds(60);
+};
+
+}  // namespace client
+}  // namespace olp
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace client {
+
+/**
+ * @brief Limits the share of the retried requests per host.
+ *
+ * Each request to a host earns `budget_ratio` of a retry, and each retry
+ * spends one. The budget is shared by all the `OlpClient` instances in the
+ * process, so a partial outage does not multiply the load on the host by the
+ * number of attempts.
+ */
+struct CORE_API RetryBudgetSettings {
+  /**
+   * @brief The share of retried requests in the range [0, 1].
+   *
+   * The default value is 0.1, so at most 10% of the requests are retried.
+   */
+  double budget_ratio = 0.1;
+
+  /**
+   * @brief The maximum number of retries that can be accumulated.
+   *
+   * The budget starts full, so the first failures are retried.
+   *
+   * The default value is 10.
+   */
+  double max_budget = 10.0;
+};
+
+}  // namespace client
+}  // namespace olp
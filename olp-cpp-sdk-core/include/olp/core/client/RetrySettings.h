@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 HERE Europe B.V.
+ * Copyright (C) 2021-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,7 +23,11 @@
 #include <functional>
 
 #include <olp/core/client/BackdownStrategy.h>
+#include <olp/core/client/HedgingSettings.h>
 #include <olp/core/client/HttpResponse.h>
+#include <olp/core/client/RateLimitSettings.h>
+#include <olp/core/client/RetryBudgetSettings.h>
+#include <olp/core/porting/optional.h>
 
 namespace olp {
 namespace client {
@@ -139,6 +143,41 @@ struct CORE_API RetrySettings {
    * @brief Evaluates responses to determine if the retry should be attempted.
    */
   RetryCondition retry_condition = DefaultRetryCondition;
+
+  /**
+   * @brief The hedging settings for idempotent GET requests.
+   *
+   * Hedging is disabled if not set. It is applied to every attempt of the
+   * synchronous and asynchronous `OlpClient::CallApi` requests. The
+   * asynchronous requests are hedged only when `OlpClientSettings` has a task
+   * scheduler, which measures the hedging delay.
+   *
+   * The requests that stream the response with a data callback are not
+   * hedged, as the streamed data cannot be taken back.
+   *
+   * A response that matches `retry_condition` is used only when the other
+   * attempt has already completed. Otherwise, the other attempt is awaited.
+   */
+  porting::optional<HedgingSettings> hedging_settings = porting::none;
+
+  /**
+   * @brief The client-side rate limiting of the hosts that reject requests.
+   *
+   * Rate limiting is disabled if not set. The state of each host is shared by
+   * all the clients in the process that enable it.
+   *
+   * @note The `Retry-After` header of the HTTP 429 and 503 responses is
+   * honored by the retries regardless of this setting.
+   */
+  porting::optional<RateLimitSettings> rate_limit_settings = porting::none;
+
+  /**
+   * @brief The budget of the retries per host.
+   *
+   * The retries are not limited if not set. The budget of each host is shared
+   * by all the clients in the process that enable it.
+   */
+  porting::optional<RetryBudgetSettings> retry_budget_settings = porting::none;
 };
 
 }  // namespace client
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -28,6 +29,7 @@
 #include <olp/core/client/CancellationContext.h>
 #include <olp/core/client/CancellationToken.h>
 #include <olp/core/client/Condition.h>
+#include <olp/core/porting/optional.h>
 
 namespace olp {
 namespace client {
@@ -127,7 +129,8 @@ class CORE_API TaskContext {
    */
   void SetExecutors(Exec execute_func, Callback callback,
                     client::CancellationContext context) {
-    impl_ = std::make_shared<TaskContextImpl<ExecResult>>(
+    // The functions are kept in the same allocation as the state.
+    impl_ = std::make_shared<TaskContextImpl<ExecResult, Exec, Callback>>(
         std::move(execute_func), std::move(callback), std::move(context));
   }
 
@@ -170,15 +173,20 @@ class CORE_API TaskContext {
    * Erases the type of the `Result` object produced by the `ExecuteFunc`
    * function and passes it to the `UserCallback` instance.
    *
-   * @tparam T The result type.
+   * @tparam Response The result type.
+   * @tparam Exec The type of the task.
+   * @tparam Callback The type of the callback.
    */
-  template <typename Response>
+  template <typename Response,
+            typename Exec =
+                std::function<Response(client::CancellationContext)>,
+            typename Callback = std::function<void(Response)>>
   class TaskContextImpl : public Impl {
    public:
     /// The task that produces the `Response` instance.
-    using ExecuteFunc = std::function<Response(client::CancellationContext)>;
+    using ExecuteFunc = Exec;
     /// Consumes the `Response` instance.
-    using UserCallback = std::function<void(Response)>;
+    using UserCallback = Callback;
 
     /**
      * @brief Creates the `TaskContextImpl` instance.
@@ -210,20 +218,20 @@ class CORE_API TaskContext {
 
       // Moving the user callback and function guarantee that they are
       // executed exactly once
-      ExecuteFunc function = nullptr;
-      UserCallback callback = nullptr;
+      porting::optional<ExecuteFunc> function;
+      porting::optional<UserCallback> callback;
 
       {
         std::lock_guard<std::mutex> lock(mutex_);
-        function = std::move(execute_func_);
-        callback = std::move(callback_);
+        MoveOut(execute_func_, function);
+        MoveOut(callback_, callback);
       }
 
       Response user_response =
           client::ApiError(client::ErrorCode::Cancelled, "Cancelled");
 
-      if (function && !context_.IsCancelled()) {
-        auto response = function(context_);
+      if (IsSet(function) && !context_.IsCancelled()) {
+        auto response = (*function)(context_);
         // Cancel could occur during the function execution. In that case,
         // ignore the response.
         if (!context_.IsCancelled() ||
@@ -236,14 +244,14 @@ class CORE_API TaskContext {
       // Reset the context after the task is finished.
       context_.ExecuteOrCancelled([]() { return CancellationToken(); });
 
-      if (callback) {
-        callback(std::move(user_response));
+      if (IsSet(callback)) {
+        (*callback)(std::move(user_response));
       }
 
       // Resources need to be released before the notification, else lambas
       // would have captured resources like network or `TaskScheduler`.
-      function = nullptr;
-      callback = nullptr;
+      function = porting::none;
+      callback = porting::none;
 
       condition_.Notify();
       state_.store(State::COMPLETED);
@@ -269,7 +277,7 @@ class CORE_API TaskContext {
 
       {
         std::lock_guard<std::mutex> lock(mutex_);
-        execute_func_ = nullptr;
+        execute_func_ = porting::none;
       }
 
       return condition_.Wait(timeout);
@@ -298,13 +306,40 @@ class CORE_API TaskContext {
       COMPLETED
     };
 
+    /// Moves the function out of the `from` instance and leaves it empty.
+    template <typename Function>
+    static void MoveOut(porting::optional<Function>& from,
+                        porting::optional<Function>& to) {
+      if (from) {
+        to.emplace(std::move(*from));
+        from = porting::none;
+      }
+    }
+
+    /// Checks whether the function is set, including an empty
+    /// `std::function` instance.
+    template <typename Function>
+    static bool IsSet(const porting::optional<Function>& function) {
+      return function && IsSet(*function);
+    }
+
+    template <typename Function>
+    static bool IsSet(const Function&) {
+      return true;
+    }
+
+    template <typename Result, typename... Args>
+    static bool IsSet(const std::function<Result(Args...)>& function) {
+      return static_cast<bool>(function);
+    }
+
     /// The mutex lock used to protect from the concurrent read and write
     /// operations.
     std::mutex mutex_;
     /// The `ExecuteFunc` instance.
-    ExecuteFunc execute_func_;
+    porting::optional<ExecuteFunc> execute_func_;
     /// The `UserCallback` instance.
-    UserCallback callback_;
+    porting::optional<UserCallback> callback_;
     /// The `CancellationContext` instance.
     client::CancellationContext context_;
     /// The `Condition` instance.
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace http {
+
+/**
+ * @brief A chunked, reference-counted byte buffer used for response bodies.
+ *
+ * The data is stored in a list of chunks that are shared between copies of
+ * the chain, so copying a `BufferChain` never copies the payload. Appending
+ * never touches a chunk that is shared with another chain.
+ *
+ * When the expected size is known in advance (for example, from the
+ * `Content-Length` header or the partition metadata), call `Reserve` before
+ * appending data. The whole body then ends up in a single chunk, and
+ * `Release` hands it over to the caller without copying.
+ */
+class CORE_API BufferChain final {
+ public:
+  /// The chunk type.
+  using Chunk = std::vector<std::uint8_t>;
+
+  /// The shared pointer to the chunk.
+  using ChunkPtr = std::shared_ptr<Chunk>;
+
+  /// The default capacity of a newly allocated chunk.
+  static constexpr std::size_t kDefaultChunkSize = 16u * 1024u;
+
+  BufferChain() = default;
+
+  /**
+   * @brief Creates the `BufferChain` instance that holds a single chunk.
+   *
+   * @param chunk The chunk. The chain takes the shared ownership of it.
+   */
+  explicit BufferChain(ChunkPtr chunk);
+
+  /// A default copy constructor. Shares the chunks with `other`.
+  BufferChain(const BufferChain& other) = default;
+
+  /// A default copy assignment operator. Shares the chunks with `other`.
+  BufferChain& operator=(const BufferChain& other) = default;
+
+  /// A move constructor. Leaves `other` empty.
+  BufferChain(BufferChain&& other) noexcept;
+
+  /// A move assignment operator. Leaves `other` empty.
+  BufferChain& operator=(BufferChain&& other) noexcept;
+
+  /**
+   * @brief Reserves the capacity for the data that is appended next.
+   *
+   * Only has an effect when the chain is empty or the last chunk is not
+   * shared.
+   *
+   * @param size The total number of bytes that the chain is expected to hold.
+   */
+  void Reserve(std::size_t size);
+
+  /**
+   * @brief Appends data to the end of the chain.
+   *
+   * @param data The pointer to the data.
+   * @param size The number of bytes to append.
+   */
+  void Append(const std::uint8_t* data, std::size_t size);
+
+  /**
+   * @brief Shrinks the chain to the given size.
+   *
+   * @param size The new size. If it is greater than the current size, nothing
+   * happens.
+   */
+  void Truncate(std::size_t size);
+
+  /**
+   * @brief Removes all data from the chain.
+   */
+  void Clear();
+
+  /**
+   * @brief Gets the total number of bytes in the chain.
+   *
+   * @return The number of bytes.
+   */
+  std::size_t Size() const { return size_; }
+
+  /**
+   * @brief Checks whether the chain holds no data.
+   *
+   * @return True if the chain is empty; false otherwise.
+   */
+  bool Empty() const { return size_ == 0u; }
+
+  /**
+   * @brief Gets the chunks of the chain.
+   *
+   * The chunks must not be modified.
+   *
+   * @return The list of chunks.
+   */
+  const std::vector<ChunkPtr>& GetChunks() const { return chunks_; }
+
+  /**
+   * @brief Copies the whole chain into the given memory.
+   *
+   * @param output The destination. Must be at least `Size()` bytes long.
+   */
+  void CopyTo(std::uint8_t* output) const;
+
+  /**
+   * @brief Renders the chain content to a string.
+   *
+   * @return The string that contains a copy of the data.
+   */
+  std::string ToString() const;
+
+  /**
+   * @brief Moves the data out of the chain as one contiguous buffer.
+   *
+   * If the chain consists of a single chunk that is not shared, the chunk is
+   * returned as is. Otherwise, the chunks are copied into a new buffer. The
+   * chain is empty after the call.
+   *
+   * @return The buffer that contains the data.
+   */
+  ChunkPtr Release();
+
+ private:
+  std::vector<ChunkPtr> chunks_;
+  std::size_t size_{0u};
+  std::size_t reserve_{0u};
+};
+
+/**
+ * @brief An output stream that writes into a `BufferChain`.
+ *
+ * Use it as the `Network::Payload` to collect the response body without an
+ * intermediate `std::stringstream`.
+ */
+class CORE_API BufferChainOutputStream final : public std::ostream {
+ public:
+  BufferChainOutputStream();
+  ~BufferChainOutputStream() override;
+
+  /**
+   * @brief Gets the underlying chain.
+   *
+   * @return The reference to the chain.
+   */
+  BufferChain& GetBuffer();
+
+ private:
+  class StreamBuffer : public std::streambuf {
+   public:
+    BufferChain& GetBuffer() { return buffer_; }
+
+   protected:
+    std::streamsize xsputn(const char_type* s, std::streamsize count) override;
+    int_type overflow(int_type ch) override;
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+   private:
+    BufferChain buffer_;
+  };
+
+  StreamBuffer stream_buffer_;
+};
+
+}  // namespace http
+}  // namespace olp
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace http {
+
+/**
+ * @brief A histogram of latency values with logarithmic buckets.
+ *
+ * Each power of two is split into four buckets, so the relative error of a
+ * value taken from the histogram is below 25%. The memory footprint is fixed
+ * and does not depend on the number of recorded values.
+ */
+class CORE_API LatencyHistogram final {
+ public:
+  /// The latency unit.
+  using MicroSeconds = std::chrono::microseconds;
+
+  /// The number of buckets.
+  static constexpr std::size_t kBucketCount = 128u;
+
+  /// The bucket counters.
+  using Buckets = std::array<std::uint64_t, kBucketCount>;
+
+  /**
+   * @brief Records a value.
+   *
+   * @param value The latency value.
+   */
+  void Add(MicroSeconds value);
+
+  /**
+   * @brief Adds the values recorded by another histogram.
+   *
+   * @param other The histogram to merge.
+   */
+  void Merge(const LatencyHistogram& other);
+
+  /**
+   * @brief Gets the number of recorded values.
+   *
+   * @return The number of recorded values.
+   */
+  std::uint64_t GetCount() const { return count_; }
+
+  /**
+   * @brief Gets the sum of the recorded values.
+   *
+   * @return The sum of the recorded values.
+   */
+  MicroSeconds GetSum() const { return sum_; }
+
+  /**
+   * @brief Gets the largest recorded value.
+   *
+   * @return The largest recorded value.
+   */
+  MicroSeconds GetMax() const { return max_; }
+
+  /**
+   * @brief Gets the approximate percentile of the recorded values.
+   *
+   * @param percentile The percentile in the range [0, 100].
+   *
+   * @return The upper bound of the bucket that contains the percentile, but
+   * not more than the largest recorded value. Zero if the histogram is empty.
+   */
+  MicroSeconds GetPercentile(double percentile) const;
+
+  /**
+   * @brief Gets the bucket counters.
+   *
+   * @return The number of values recorded to every bucket.
+   */
+  const Buckets& GetBuckets() const { return buckets_; }
+
+  /**
+   * @brief Gets the smallest value of the bucket.
+   *
+   * @param index The bucket index.
+   *
+   * @return The smallest value that is recorded to the bucket.
+   */
+  static MicroSeconds GetBucketLowerBound(std::size_t index);
+
+  /**
+   * @brief Gets the bucket index for the value.
+   *
+   * @param value The latency value.
+   *
+   * @return The index of the bucket that the value is recorded to.
+   */
+  static std::size_t GetBucketIndex(MicroSeconds value);
+
+ private:
+  Buckets buckets_{};
+  std::uint64_t count_{0u};
+  MicroSeconds sum_{0};
+  MicroSeconds max_{0};
+};
+
+}  // namespace http
+}  // namespace olp
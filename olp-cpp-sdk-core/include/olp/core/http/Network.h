@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,12 +19,15 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "olp/core/CoreApi.h"
+#include "olp/core/http/LatencyHistogram.h"
 #include "olp/core/http/NetworkInitializationSettings.h"
 #include "olp/core/http/NetworkRequest.h"
 #include "olp/core/http/NetworkResponse.h"
@@ -51,6 +54,10 @@ class CORE_API Network {
   /// The request and response payload type.
   using Payload = std::shared_ptr<std::ostream>;
 
+  /// The latency histograms of the request phases indexed by
+  /// `Diagnostics::Timings`.
+  using LatencyHistograms = std::array<LatencyHistogram, Diagnostics::Count>;
+
   /// Network statistics for a specific bucket.
   struct Statistics {
     /// The total bytes downloaded, including the size of headers and payload.
@@ -64,6 +71,10 @@ class CORE_API Network {
 
     /// The total number of requests that failed.
     uint32_t total_failed{0u};
+
+    /// The latency histograms per host. Only the requests that provide
+    /// `Diagnostics` are recorded.
+    std::unordered_map<std::string, LatencyHistograms> host_latencies;
   };
 
   virtual ~Network() = default;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,7 +29,9 @@ namespace http {
  * @brief The HTTP headers.
  */
 static constexpr auto kAuthorizationHeader = "Authorization";
+static constexpr auto kContentLengthHeader = "Content-Length";
 static constexpr auto kContentTypeHeader = "Content-Type";
+static constexpr auto kRetryAfterHeader = "Retry-After";
 static constexpr auto kUserAgentHeader = "User-Agent";
 
 /**
@@ -32,6 +32,17 @@ namespace http {
  * @brief Settings for network initialization.
  */
 struct CORE_API NetworkInitializationSettings {
+  /**
+   * @brief The strategy used to distribute requests between network workers.
+   */
+  enum class ShardingPolicy {
+    /// Requests to the same host are always handled by the same worker, so
+    /// they share connections and TLS sessions.
+    kByHost,
+    /// Each request is handled by the worker with the fewest pending requests.
+    kByLoad
+  };
+
   /**
    * @brief The maximum number of requests that can be sent simultaneously.
    */
@@ -58,6 +69,25 @@ struct CORE_API NetworkInitializationSettings {
    * supported.
    */
   size_t max_transfer_bytes_per_second = 0u;
+
+  /**
+   * @brief The number of network workers.
+   *
+   * Each worker has its own thread and transfer loop, so TLS decryption,
+   * decompression and data callbacks of different requests run in parallel.
+   * The `max_requests_count` limit is split evenly between the workers.
+   *
+   * @note Currently, only CURL-based network implementation supports this
+   * setting.
+   */
+  size_t worker_count = 1u;
+
+  /**
+   * @brief The policy used to assign requests to the workers.
+   *
+   * Only has an effect when `worker_count` is greater than 1.
+   */
+  ShardingPolicy sharding_policy = ShardingPolicy::kByLoad;
 };
 
 }  // namespace http
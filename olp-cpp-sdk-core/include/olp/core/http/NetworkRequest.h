@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,12 +20,14 @@
 #pragma once
 
 #include <cstdint>
+#include <istream>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include <olp/core/CoreApi.h>
 #include <olp/core/http/NetworkSettings.h>
+#include <olp/core/porting/optional.h>
 
 namespace olp {
 namespace http {
@@ -36,6 +38,9 @@ class CORE_API NetworkRequest final {
   /// An alias for the HTTP request body.
   using RequestBodyType = std::shared_ptr<const std::vector<std::uint8_t>>;
 
+  /// An alias for the streamed HTTP request body.
+  using RequestBodyStreamType = std::shared_ptr<std::istream>;
+
   /// The HTTP method, as specified at https://tools.ietf.org/html/rfc2616.
   enum class HttpVerb {
     GET = 0,     ///< The GET method (RFC2616, section-9.3).
@@ -127,6 +132,45 @@ class CORE_API NetworkRequest final {
    */
   NetworkRequest& WithBody(RequestBodyType body);
 
+  /**
+   * @brief Gets the streamed request body.
+   *
+   * @return The stream that provides the request body or `nullptr` if the body
+   * is not streamed.
+   */
+  RequestBodyStreamType GetBodyStream() const;
+
+  /**
+   * @brief Gets the size of the streamed request body.
+   *
+   * @return The number of bytes that are read from the body stream or
+   * `olp::porting::none` if the size is unknown.
+   */
+  const porting::optional<std::uint64_t>& GetBodyStreamSize() const;
+
+  /**
+   * @brief Sets the streamed request body.
+   *
+   * The body is read from the stream while the request is sent, so it does
+   * not have to fit in memory. The stream is read from its current position
+   * and must not be accessed until the request is completed. If the stream is
+   * seekable, the network can rewind it, for example, to follow a redirect.
+   *
+   * Takes precedence over the body set with `WithBody`.
+   *
+   * @note Currently, only CURL-based network implementation sends the body
+   * without reading it into memory first.
+   *
+   * @param[in] stream The stream that provides the request body.
+   * @param[in] size The number of bytes to send. If not set, the body is sent
+   * with the chunked transfer encoding.
+   *
+   * @return A reference to *this.
+   */
+  NetworkRequest& WithBodyStream(
+      RequestBodyStreamType stream,
+      porting::optional<std::uint64_t> size = porting::none);
+
   /**
    * @brief Gets the network settings for this request.
    *
@@ -152,6 +196,10 @@ class CORE_API NetworkRequest final {
   Headers headers_;
   /// The body of the HTTP request.
   RequestBodyType body_;
+  /// The streamed body of the HTTP request.
+  RequestBodyStreamType body_stream_;
+  /// The size of the streamed body.
+  porting::optional<std::uint64_t> body_stream_size_;
   /// The network settings for this request.
   NetworkSettings settings_{};
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -96,6 +96,17 @@ class CORE_API NetworkUtils {
    * @return The user agent or an empty string if there is no user agent.
    */
   static std::string ExtractUserAgent(Headers& headers);
+
+  /**
+   * @brief Extracts the host name from the URL.
+   *
+   * The scheme, user information, port, path, and query are skipped.
+   *
+   * @param url The URL.
+   *
+   * @return The host name or an empty string if the URL has no host.
+   */
+  static std::string ExtractHost(const std::string& url);
 };  // The `NetworkUtils` class.
 
 /**
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <olp/core/CoreApi.h>
+#include <olp/core/http/Network.h>
+
+namespace olp {
+namespace http {
+
+/**
+ * @class DeduplicationAdapter
+ * @brief A network adapter that coalesces identical in-flight requests.
+ *
+ * The `GET` and `HEAD` requests without a body that have the same URL and
+ * headers are sent to the underlying network only once when they are issued
+ * before the first one receives any response data. The response headers and
+ * body chunks are passed to every caller as they arrive, so the adapter
+ * neither buffers nor copies the body. The other requests are forwarded as
+ * they are.
+ *
+ * `OlpClient` merges identical requests only within the same instance. Share
+ * one adapter between the settings of all the clients to merge the requests
+ * for the same lookup, metadata, or blob URLs across them.
+ *
+ * A cancelled request stops receiving the response data right away and is
+ * completed with `ErrorCode::CANCELLED_ERROR` when the shared request
+ * finishes. The shared request is cancelled once all its callers cancel.
+ *
+ * Example Usage:
+ * @code
+ * auto network = std::make_shared<DeduplicationAdapter>(
+ *     OlpClientSettingsFactory::CreateDefaultNetworkRequestHandler());
+ * @endcode
+ */
+class CORE_API DeduplicationAdapter final : public Network {
+ public:
+  /**
+   * @brief Constructs a DeduplicationAdapter instance.
+   *
+   * @param network The underlying network implementation to forward requests
+   * to.
+   */
+  explicit DeduplicationAdapter(std::shared_ptr<Network> network);
+
+  ~DeduplicationAdapter() override;
+
+  /**
+   * @copydoc Network::Send
+   */
+  SendOutcome Send(NetworkRequest request, Payload payload, Callback callback,
+                   HeaderCallback header_callback,
+                   DataCallback data_callback) override;
+
+  /**
+   * @copydoc Network::Cancel
+   */
+  void Cancel(RequestId id) override;
+
+  /**
+   * @copydoc Network::SetDefaultHeaders
+   */
+  void SetDefaultHeaders(Headers headers) override;
+
+  /**
+   * @copydoc Network::SetCurrentBucket
+   */
+  void SetCurrentBucket(uint8_t bucket_id) override;
+
+  /**
+   * @copydoc Network::GetStatistics
+   */
+  Statistics GetStatistics(uint8_t bucket_id = 0) override;
+
+  /**
+   * @brief Gets the number of requests that were served by a request of
+   * another caller.
+   *
+   * @return The number of coalesced requests.
+   */
+  size_t GetCoalescedCount() const;
+
+ private:
+  class DeduplicationAdapterImpl;
+  std::shared_ptr<DeduplicationAdapterImpl> impl_;
+};
+
+}  // namespace http
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025 HERE Europe B.V.
+ * Copyright (C) 2025-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -40,6 +40,8 @@ namespace http {
  *
  * @note Request timings are only available when Curl is used.
  * @note The HAR file is produced when the instance is destroyed.
+ * @note Request and response bodies are only recorded when `capture_content`
+ * is enabled. They are required to replay the file with `HarReplayNetwork`.
  *
  * Features:
  * - Captures HTTP requests and responses.
@@ -60,8 +62,11 @@ class CORE_API HarCaptureAdapter final : public Network {
    * to.
    * @param har_out_path The file path where the HAR (HTTP Archive) file will be
    * saved.
+   * @param capture_content If true, the request and response bodies are
+   * stored in the HAR file as Base64 encoded text.
    */
-  HarCaptureAdapter(std::shared_ptr<Network> network, std::string har_out_path);
+  HarCaptureAdapter(std::shared_ptr<Network> network, std::string har_out_path,
+                    bool capture_content = false);
 
   ~HarCaptureAdapter() override;
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <olp/core/CoreApi.h>
+#include <olp/core/http/Network.h>
+
+namespace olp {
+namespace http {
+
+/**
+ * @class HarReplayNetwork
+ * @brief A network implementation that serves the responses recorded in a HAR
+ * (HTTP Archive) file.
+ *
+ * The requests are matched by method and URL, and optionally by body. When
+ * the file contains several entries for the same request, they are served in
+ * the recorded order, and the sequence starts over after the last one. The
+ * requests that have no matching entry fail with `ErrorCode::OFFLINE_ERROR`.
+ *
+ * The response bodies are only available if the file was recorded by
+ * `HarCaptureAdapter` with `capture_content` enabled, or by another tool that
+ * stores the content text.
+ *
+ * Use it to run the whole stack, including the clients, cache, and parsers,
+ * against recorded traffic on machines without network access.
+ *
+ * Example Usage:
+ * @code
+ * auto network = std::make_shared<HarReplayNetwork>(
+ *     "/tmp/session.har", HarReplayNetwork::TimingMode::kRecorded);
+ * @endcode
+ */
+class CORE_API HarReplayNetwork final : public Network {
+ public:
+  /// Controls when the responses are delivered.
+  enum class TimingMode {
+    /// The responses are delivered as soon as possible.
+    kFullSpeed,
+    /// The responses are delivered after the recorded request time.
+    kRecorded
+  };
+
+  /**
+   * @brief Constructs a HarReplayNetwork instance.
+   *
+   * @param har_path The path to the HAR file.
+   * @param timing_mode Controls when the responses are delivered.
+   * @param match_body If true, the request body must match the recorded body
+   * as well.
+   */
+  explicit HarReplayNetwork(const std::string& har_path,
+                            TimingMode timing_mode = TimingMode::kFullSpeed,
+                            bool match_body = false);
+
+  ~HarReplayNetwork() override;
+
+  /**
+   * @copydoc Network::Send
+   */
+  SendOutcome Send(NetworkRequest request, Payload payload, Callback callback,
+                   HeaderCallback header_callback = nullptr,
+                   DataCallback data_callback = nullptr) override;
+
+  /**
+   * @copydoc Network::Cancel
+   */
+  void Cancel(RequestId id) override;
+
+  /**
+   * @brief Gets the number of entries loaded from the HAR file.
+   *
+   * @return The number of entries; zero if the file cannot be loaded.
+   */
+  size_t GetEntryCount() const;
+
+ private:
+  class HarReplayNetworkImpl;
+  std::shared_ptr<HarReplayNetworkImpl> impl_;
+};
+
+}  // namespace http
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -39,6 +39,14 @@ class CORE_API IAppender {
    * @param message The message to append.
    */
   virtual IAppender& append(const LogMessage& message) = 0;
+
+  /**
+   * @brief Writes the buffered messages to the output.
+   *
+   * The log system calls it after every message in the synchronous mode and
+   * after every batch of messages in the asynchronous mode.
+   */
+  virtual IAppender& flush() { return *this; }
 };
 
 }  // namespace logging
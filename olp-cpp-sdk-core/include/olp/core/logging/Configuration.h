@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -26,6 +27,7 @@
 #include <olp/core/CoreApi.h>
 #include <olp/core/logging/Appender.h>
 #include <olp/core/logging/MessageFormatter.h>
+#include <olp/core/porting/optional.h>
 
 namespace olp {
 namespace logging {
@@ -66,6 +68,44 @@ class CORE_API Configuration {
    */
   using AppenderList = std::vector<AppenderWithLogLevel>;
 
+  /**
+   * @brief Defines what happens to a message logged when the queue of
+   * the asynchronous mode is full.
+   */
+  enum class OverflowPolicy {
+    /// The message is dropped. The number of dropped messages is reported
+    /// to the appenders as a warning.
+    DropNewest,
+    /// The logging thread waits until the queue has a free slot.
+    Block
+  };
+
+  /**
+   * @brief The settings of the asynchronous mode.
+   *
+   * In the asynchronous mode, the logging thread only copies the message into
+   * a preallocated queue slot. A background thread formats the messages,
+   * passes them to the appenders, and flushes the appenders once per batch.
+   *
+   * @note The `file`, `function`, and `fullFunction` strings of the messages
+   * are not copied, so they must be string literals, as the ones passed by
+   * the `OLP_SDK_LOG_*` macros.
+   */
+  struct AsyncSettings {
+    /// The maximum number of queued messages. Rounded up to a power of two.
+    size_t queueSize{1024u};
+
+    /// The maximum size of a message. Longer messages are truncated.
+    size_t maxMessageSize{1024u};
+
+    /// The behavior when the queue is full.
+    OverflowPolicy overflowPolicy{OverflowPolicy::DropNewest};
+
+    /// The maximum time the messages stay in the queue when the logging is
+    /// idle.
+    std::chrono::milliseconds flushInterval{100};
+  };
+
   /**
    * @brief Creates a default configuration by adding
    * an instance of `DebugAppender` and `ConsoleAppender` as appenders.
@@ -103,8 +143,24 @@ class CORE_API Configuration {
    */
   inline const AppenderList& getAppenders() const;
 
+  /**
+   * @brief Enables the asynchronous mode.
+   *
+   * @param settings The settings of the asynchronous mode.
+   */
+  inline Configuration& setAsync(AsyncSettings settings);
+
+  /**
+   * @brief Gets the settings of the asynchronous mode.
+   *
+   * @return The settings if the asynchronous mode is enabled; an empty
+   * optional otherwise.
+   */
+  inline const porting::optional<AsyncSettings>& getAsync() const;
+
  private:
   AppenderList m_appenders;
+  porting::optional<AsyncSettings> m_async;
 };
 
 inline bool Configuration::isValid() const { return !m_appenders.empty(); }
@@ -127,5 +183,15 @@ inline auto Configuration::getAppenders() const -> const AppenderList& {
   return m_appenders;
 }
 
+inline Configuration& Configuration::setAsync(AsyncSettings settings) {
+  m_async = std::move(settings);
+  return *this;
+}
+
+inline auto Configuration::getAsync() const
+    -> const porting::optional<AsyncSettings>& {
+  return m_async;
+}
+
 }  // namespace logging
 }  // namespace olp
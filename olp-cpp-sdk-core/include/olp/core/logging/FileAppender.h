@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -83,6 +83,8 @@ class CORE_API FileAppender : public IAppender {
 
   IAppender& append(const LogMessage& message) override;
 
+  IAppender& flush() override;
+
  private:
   std::string m_fileName;
   bool m_appendFile;
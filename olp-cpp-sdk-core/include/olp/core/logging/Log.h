@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,13 +19,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <cinttypes>
+#include <cstdint>
 #include <cstdlib>
 #include <sstream>
 #include <string>
 
 #include <olp/core/logging/Format.h>
 #include <olp/core/logging/Level.h>
+#include <olp/core/logging/LogArgument.h>
 
 #include <olp/core/CoreApi.h>
 #include <olp/core/porting/optional.h>
@@ -259,12 +262,13 @@
  * @param tag The tag for the log component.
  * @param message The log message.
  */
-#define OLP_SDK_LOG(level, tag, message)              \
-  do {                                                \
-    if (::olp::logging::Log::isEnabled(level, tag)) { \
-      OLP_SDK_DO_LOG(level, tag, message);            \
-    }                                                 \
-  }                                                   \
+#define OLP_SDK_LOG(level, tag, message)                  \
+  do {                                                    \
+    static ::olp::logging::LogLevelCache __level_cache;   \
+    if (__level_cache.isEnabled(level, tag)) {            \
+      OLP_SDK_DO_LOG(level, tag, message);                \
+    }                                                     \
+  }                                                       \
   OLP_SDK_CORE_LOOP_ONCE()
 
 #endif  // OLP_SDK_LOGGING_DISABLED
@@ -346,12 +350,13 @@
  * @param level The log level.
  * @param tag The tag for the log component.
  */
-#define OLP_SDK_LOG_F(level, tag, ...)                \
-  do {                                                \
-    if (::olp::logging::Log::isEnabled(level, tag)) { \
-      OLP_SDK_DO_LOG_F(level, tag, __VA_ARGS__);      \
-    }                                                 \
-  }                                                   \
+#define OLP_SDK_LOG_F(level, tag, ...)                  \
+  do {                                                  \
+    static ::olp::logging::LogLevelCache __level_cache; \
+    if (__level_cache.isEnabled(level, tag)) {          \
+      OLP_SDK_DO_LOG_F(level, tag, __VA_ARGS__);        \
+    }                                                   \
+  }                                                     \
   OLP_SDK_CORE_LOOP_ONCE()
 
 #endif  // OLP_SDK_LOGGING_DISABLED
@@ -402,6 +407,86 @@
 #define OLP_SDK_LOG_ERROR_F(tag, ...) \
   OLP_SDK_LOG_F(::olp::logging::Level::Error, tag, __VA_ARGS__)
 
+#ifdef OLP_SDK_LOGGING_DISABLED
+#define OLP_SDK_LOG_S(level, tag, ...) \
+  do {                                 \
+  }                                    \
+  OLP_SDK_CORE_LOOP_ONCE()
+#else
+/**
+ * @brief Logs a structured message.
+ *
+ * The arguments are stored unformatted and substituted for the `{}`
+ * placeholders of the format only when the message is written. In
+ * the asynchronous mode, it happens on the logging thread. See `LogArgument`
+ * for the supported types.
+ *
+ * The format is the first of the variadic arguments and must be a string
+ * literal, as the asynchronous mode keeps only the pointer to it.
+ *
+ * @param level The log level.
+ * @param tag The tag for the log component.
+ */
+#define OLP_SDK_LOG_S(level, tag, ...)                                \
+  do {                                                                \
+    static ::olp::logging::LogLevelCache __level_cache;               \
+    if (__level_cache.isEnabled(level, tag)) {                        \
+      ::olp::logging::Log::logStructured(                             \
+          level, tag, OLP_SDK_LOG_FILE, OLP_SDK_LOG_LINE,             \
+          OLP_SDK_LOG_FUNCTION, OLP_SDK_LOG_FUNCTION_SIGNATURE,       \
+          "" __VA_ARGS__);                                            \
+    }                                                                 \
+  }                                                                   \
+  OLP_SDK_CORE_LOOP_ONCE()
+
+#endif  // OLP_SDK_LOGGING_DISABLED
+
+#ifdef LOGGING_DISABLE_DEBUG_LEVEL
+#define OLP_SDK_LOG_TRACE_S(tag, ...) OLP_SDK_CORE_UNUSED(tag, __VA_ARGS__)
+#define OLP_SDK_LOG_DEBUG_S(tag, ...) OLP_SDK_CORE_UNUSED(tag, __VA_ARGS__)
+#else
+/**
+ * @brief Logs a "Trace" structured message.
+ *
+ * @param tag The tag for the log component.
+ */
+#define OLP_SDK_LOG_TRACE_S(tag, ...) \
+  OLP_SDK_LOG_S(::olp::logging::Level::Trace, tag, __VA_ARGS__)
+
+/**
+ * @brief Logs a "Debug" structured message.
+ *
+ * @param tag The tag for the log component.
+ */
+#define OLP_SDK_LOG_DEBUG_S(tag, ...) \
+  OLP_SDK_LOG_S(::olp::logging::Level::Debug, tag, __VA_ARGS__)
+
+#endif  // LOGGING_DISABLE_DEBUG_LEVEL
+
+/**
+ * @brief Logs an "Info" structured message.
+ *
+ * @param tag The tag for the log component.
+ */
+#define OLP_SDK_LOG_INFO_S(tag, ...) \
+  OLP_SDK_LOG_S(::olp::logging::Level::Info, tag, __VA_ARGS__)
+
+/**
+ * @brief Logs a "Warning" structured message.
+ *
+ * @param tag The tag for the log component.
+ */
+#define OLP_SDK_LOG_WARNING_S(tag, ...) \
+  OLP_SDK_LOG_S(::olp::logging::Level::Warning, tag, __VA_ARGS__)
+
+/**
+ * @brief Logs an "Error" structured message.
+ *
+ * @param tag The tag for the log component.
+ */
+#define OLP_SDK_LOG_ERROR_S(tag, ...) \
+  OLP_SDK_LOG_S(::olp::logging::Level::Error, tag, __VA_ARGS__)
+
 /**
  * @brief A namespace for the logging library.
  */
@@ -543,6 +628,19 @@ class CORE_API Log {
    */
   static bool isEnabled(Level level, const std::string& tag);
 
+  /**
+   * @brief Checks whether a log tag is enabled for a level.
+   *
+   * Unless the levels of the tags are mixed with the default level, it costs
+   * a single atomic load and does not create a `std::string` for the tag.
+   *
+   * @param level The log level.
+   * @param tag The null-terminated tag for the log component.
+   *
+   * @return True if the log is enabled; false otherwise.
+   */
+  static bool isEnabled(Level level, const char* tag);
+
   /**
    * @brief Logs a message to the registered appenders.
    *
@@ -563,6 +661,42 @@ class CORE_API Log {
                          unsigned int line, const char* function,
                          const char* fullFunction);
 
+  /**
+   * @brief Logs a structured message to the registered appenders.
+   *
+   * @param level The log level.
+   * @param tag The tag for the log component.
+   * @param format The format with the `{}` placeholders for the arguments.
+   * Must be a string literal in the asynchronous mode.
+   * @param arguments The arguments.
+   * @param count The number of arguments.
+   * @param file The file that generated the message.
+   * @param line The line in the file where the message was logged.
+   * @param function The function that generated the message.
+   * @param fullFunction The fully qualified function that generated the
+   * message.
+   */
+  static void logRecord(Level level, const std::string& tag,
+                        const char* format, const LogArgument* arguments,
+                        size_t count, const char* file, unsigned int line,
+                        const char* function, const char* fullFunction);
+
+  /**
+   * @brief Logs a structured message to the registered appenders.
+   *
+   * Used by the `OLP_SDK_LOG_*_S` macros.
+   */
+  template <typename... Args>
+  static void logStructured(Level level, const std::string& tag,
+                            const char* file, unsigned int line,
+                            const char* function, const char* fullFunction,
+                            const char* format, const Args&... args) {
+    // The trailing argument keeps the array non-empty.
+    const LogArgument arguments[] = {LogArgument(args)..., LogArgument()};
+    logRecord(level, tag, format, arguments, sizeof...(Args), file, line,
+              function, fullFunction);
+  }
+
   /**
    * @brief Adds a line to be censored out from the log.
    *
@@ -583,5 +717,46 @@ class CORE_API Log {
    */
   static void removeCensor(const std::string& message);
 };
+
+/**
+ * @brief Caches the enabled levels of a tag for a single log statement.
+ *
+ * Used by the logging macros, so the statements with a tag that has its own
+ * level don't take the lock of the log system on every check. Any change of
+ * the levels invalidates all the caches. Only the null-terminated tags are
+ * cached, by their address.
+ */
+class CORE_API LogLevelCache {
+ public:
+  /**
+   * @brief Checks whether a log tag is enabled for a level.
+   *
+   * @param level The log level.
+   * @param tag The null-terminated tag for the log component. Must not
+   * change while it is at the same address.
+   *
+   * @return True if the log is enabled; false otherwise.
+   */
+  bool isEnabled(Level level, const char* tag);
+
+  /**
+   * @brief Checks whether a log tag is enabled for a level.
+   *
+   * The tag is not cached.
+   *
+   * @param level The log level.
+   * @param tag The tag for the log component.
+   *
+   * @return True if the log is enabled; false otherwise.
+   */
+  bool isEnabled(Level level, const std::string& tag) {
+    return Log::isEnabled(level, tag);
+  }
+
+ private:
+  /// The generation of the levels, the enabled levels, and the low bits of
+  /// the tag address, packed so they are updated together.
+  std::atomic<uint64_t> state_{0u};
+};
 }  // namespace logging
 }  // namespace olp
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace logging {
+
+/**
+ * @brief An unformatted argument of a structured log message.
+ *
+ * The argument stores the value as is, so the message is formatted only when
+ * it is written. Strings are referenced, not copied.
+ *
+ * Supported are `bool`, characters, integral, floating-point and enumeration
+ * types, null-terminated strings, and `std::string`. Other pointers do not
+ * compile.
+ */
+class CORE_API LogArgument {
+ public:
+  /// The type of the stored value.
+  enum class Type : uint8_t {
+    kNone,
+    kBool,
+    kChar,
+    kSigned,
+    kUnsigned,
+    kDouble,
+    kString
+  };
+
+  /// Creates an empty argument.
+  LogArgument() : type_(Type::kNone) { value_.unsigned_value = 0u; }
+
+  /// Creates a boolean argument.
+  LogArgument(bool value) : type_(Type::kBool) {
+    value_.unsigned_value = value ? 1u : 0u;
+  }
+
+  /// Creates a character argument.
+  LogArgument(char value) : type_(Type::kChar) {
+    value_.unsigned_value = static_cast<unsigned char>(value);
+  }
+
+  /// Creates a signed integer argument.
+  template <typename T,
+            typename std::enable_if<std::is_integral<T>::value &&
+                                        std::is_signed<T>::value>::type* =
+                nullptr>
+  LogArgument(T value) : type_(Type::kSigned) {
+    value_.signed_value = static_cast<int64_t>(value);
+  }
+
+  /// Creates an unsigned integer argument.
+  template <typename T,
+            typename std::enable_if<std::is_integral<T>::value &&
+                                        std::is_unsigned<T>::value>::type* =
+                nullptr>
+  LogArgument(T value) : type_(Type::kUnsigned) {
+    value_.unsigned_value = static_cast<uint64_t>(value);
+  }
+
+  /// Creates a floating-point argument.
+  template <typename T, typename std::enable_if<
+                            std::is_floating_point<T>::value>::type* = nullptr>
+  LogArgument(T value) : type_(Type::kDouble) {
+    value_.double_value = static_cast<double>(value);
+  }
+
+  /// Creates an argument from the underlying value of an enumeration.
+  template <typename T,
+            typename std::enable_if<std::is_enum<T>::value>::type* = nullptr>
+  LogArgument(T value)
+      : LogArgument(
+            static_cast<typename std::underlying_type<T>::type>(value)) {}
+
+  /// Creates a string argument that references the null-terminated string.
+  LogArgument(const char* value)
+      : LogArgument(value, value ? std::strlen(value) : 0u) {}
+
+  /// Creates the "(null)" string argument.
+  LogArgument(std::nullptr_t)
+      : LogArgument(static_cast<const char*>(nullptr)) {}
+
+  /// Other pointers are not supported, as they would be logged as `true`.
+  LogArgument(const void*) = delete;
+
+  /// Other pointers are not supported, as they would be logged as `true`.
+  template <typename T>
+  LogArgument(const T*) = delete;
+
+  /// Creates a string argument that references the string.
+  LogArgument(const std::string& value)
+      : LogArgument(value.data(), value.size()) {}
+
+  /// Creates a string argument that references the characters.
+  LogArgument(const char* data, size_t size) : type_(Type::kString) {
+    value_.string_value.data = data ? data : "(null)";
+    value_.string_value.size = data ? size : 6u;
+  }
+
+  /// Gets the type of the stored value.
+  Type getType() const { return type_; }
+
+  /// Gets the value of the `kBool`, `kChar`, or `kUnsigned` argument.
+  uint64_t getUnsigned() const { return value_.unsigned_value; }
+
+  /// Gets the value of the `kSigned` argument.
+  int64_t getSigned() const { return value_.signed_value; }
+
+  /// Gets the value of the `kDouble` argument.
+  double getDouble() const { return value_.double_value; }
+
+  /// Gets the characters of the `kString` argument.
+  const char* getData() const { return value_.string_value.data; }
+
+  /// Gets the size of the `kString` argument.
+  size_t getSize() const { return value_.string_value.size; }
+
+  /**
+   * @brief Formats the argument and appends it to the string.
+   *
+   * @param output The string to append to.
+   */
+  void appendTo(std::string& output) const;
+
+  /**
+   * @brief Formats a structured log message.
+   *
+   * Every `{}` in the format is replaced with the next argument. `{{` and
+   * `}}` are replaced with `{` and `}`. A placeholder without an argument is
+   * kept as is, and the arguments without a placeholder are ignored.
+   *
+   * @param format The null-terminated format.
+   * @param arguments The arguments.
+   * @param count The number of arguments.
+   *
+   * @return The formatted message.
+   */
+  static std::string format(const char* format, const LogArgument* arguments,
+                            size_t count);
+
+ private:
+  Type type_;
+  union {
+    uint64_t unsigned_value;
+    int64_t signed_value;
+    double double_value;
+    struct {
+      const char* data;
+      size_t size;
+    } string_value;
+  } value_;
+};
+
+}  // namespace logging
+}  // namespace olp
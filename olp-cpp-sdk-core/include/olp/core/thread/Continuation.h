@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 HERE Europe B.V.
+ * Copyright (C) 2022-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,9 +19,10 @@
 
 #pragma once
 
-#include <deque>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <olp/core/client/ApiError.h>
 #include <olp/core/client/ApiResponse.h>
@@ -74,6 +75,18 @@ class CORE_API ContinuationImpl final {
   ContinuationImpl(std::shared_ptr<TaskScheduler> task_scheduler,
                    ExecutionContext context, ContinuationTask task);
 
+  /**
+   * @brief Creates the `ContinuationImpl` instance without tasks.
+   *
+   * Used by `Continuation` that keeps the statically typed task chain itself
+   * and only needs this instance to schedule and finalize the execution.
+   *
+   * @param task_scheduler The `TaskScheduler` instance.
+   * @param context The `ExecutionContext` instance.
+   */
+  ContinuationImpl(std::shared_ptr<TaskScheduler> task_scheduler,
+                   ExecutionContext context);
+
   /**
    * @brief Adds the next asynchronous task
    * to the `ContinuationImpl` instance.
@@ -92,6 +105,15 @@ class CORE_API ContinuationImpl final {
    */
   void Run(FinalCallbackType callback);
 
+  /**
+   * @brief Schedules a task that runs a statically typed task chain.
+   *
+   * Like `Run`, does nothing if the execution is already started or cleared.
+   *
+   * @param task The task that runs the chain and finalizes the execution.
+   */
+  void Start(std::function<void()> task);
+
   /**
    * @brief Gets the `ExecutionContext` object.
    *
@@ -122,7 +144,7 @@ class CORE_API ContinuationImpl final {
 
  private:
   std::shared_ptr<thread::TaskScheduler> task_scheduler_;
-  std::deque<ContinuationTask> tasks_;
+  std::vector<ContinuationTask> tasks_;
   ExecutionContext execution_context_;
 
   /**
@@ -133,6 +155,120 @@ class CORE_API ContinuationImpl final {
   bool change_allowed{true};
 };
 
+/// The state shared by the tasks of one execution of a continuation chain.
+struct ContinuationExecution {
+  ContinuationExecution(ExecutionContext context,
+                        ContinuationImpl::FinalCallbackType final_callback,
+                        std::shared_ptr<const void> chain)
+      : context(std::move(context)),
+        final_callback(std::move(final_callback)),
+        chain(std::move(chain)) {}
+
+  /// Finalizes the execution once; a null `result` means it is cancelled.
+  void Finish(void* result) {
+    if (!finished.exchange(true)) {
+      final_callback(result, result == nullptr || context.Cancelled());
+    }
+  }
+
+  ExecutionContext context;
+  ContinuationImpl::FinalCallbackType final_callback;
+  /// Keeps the tasks alive while asynchronous callbacks are pending.
+  std::shared_ptr<const void> chain;
+  std::atomic<bool> finished{false};
+};
+
+/**
+ * @brief A task of a continuation chain that produces `ResultType`.
+ *
+ * The tasks are immutable once created and are shared between the
+ * `Continuation` instances, so `Then` does not copy the chain.
+ */
+template <typename ResultType>
+class ContinuationNode {
+ public:
+  /// The callback that receives the result of the task.
+  using Callback = std::function<void(ResultType)>;
+
+  virtual ~ContinuationNode() = default;
+
+  /**
+   * @brief Runs the preceding tasks and then this task.
+   *
+   * @param execution The state of the execution.
+   * @param callback Receives the result of this task.
+   */
+  virtual void Run(const std::shared_ptr<ContinuationExecution>& execution,
+                   Callback callback) const = 0;
+};
+
+/// The first task of a continuation chain.
+template <typename ResultType>
+class ContinuationSource final : public ContinuationNode<ResultType> {
+ public:
+  /// The type of the first task.
+  using Task = std::function<void(
+      ExecutionContext, typename ContinuationNode<ResultType>::Callback)>;
+
+  /// Creates the `ContinuationSource` instance.
+  explicit ContinuationSource(Task task) : task_(std::move(task)) {}
+
+  void Run(const std::shared_ptr<ContinuationExecution>& execution,
+           typename ContinuationNode<ResultType>::Callback callback)
+      const override;
+
+ private:
+  Task task_;
+};
+
+/// Adapts the tasks of a `ContinuationImpl` instance as the first task.
+template <typename ResultType>
+class ContinuationImplSource final : public ContinuationNode<ResultType> {
+ public:
+  /// Creates the `ContinuationImplSource` instance.
+  explicit ContinuationImplSource(ContinuationImpl impl)
+      : impl_(std::move(impl)) {}
+
+  void Run(const std::shared_ptr<ContinuationExecution>& execution,
+           typename ContinuationNode<ResultType>::Callback callback)
+      const override;
+
+ private:
+  mutable ContinuationImpl impl_;
+};
+
+/**
+ * @brief A task that consumes the result of the previous task.
+ *
+ * `Task` is the callable passed to `Continuation::Then`; it is stored as is,
+ * and the intermediate results are moved from one task to the next one
+ * without type erasure.
+ */
+template <typename InputType, typename ResultType, typename Task>
+class ContinuationStep final : public ContinuationNode<ResultType> {
+ public:
+  /// Creates the `ContinuationStep` instance.
+  ContinuationStep(std::shared_ptr<const ContinuationNode<InputType>> previous,
+                   Task task)
+      : previous_(std::move(previous)), task_(std::move(task)) {}
+
+  void Run(const std::shared_ptr<ContinuationExecution>& execution,
+           typename ContinuationNode<ResultType>::Callback callback)
+      const override;
+
+ private:
+  struct InputCallback {
+    void operator()(InputType input);
+
+    std::shared_ptr<ContinuationExecution> execution;
+    const ContinuationStep* step;
+    typename ContinuationNode<ResultType>::Callback callback;
+  };
+
+  std::shared_ptr<const ContinuationNode<InputType>> previous_;
+  mutable Task task_;
+};
+
 }  // namespace internal
 
 /// A generic template for `Continuation`.
@@ -153,6 +289,9 @@ class CORE_API Continuation final {
   /// An alias for the continuation chain first task.
   using ContinuationTaskType =
       std::function<void(ExecutionContext, std::function<void(ResultType)>)>;
+  /// An alias for the last task of the chain.
+  using ChainType =
+      std::shared_ptr<const internal::ContinuationNode<ResultType>>;
 
  public:
   /// The default constructor of `Continuation<ResultType>`.
@@ -180,6 +319,9 @@ class CORE_API Continuation final {
    * @brief Adds the next asynchronous task
    * to the `ContinuationImpl` instance.
    *
+   * The callable is stored in the chain as is, without wrapping it into
+   * `std::function`.
+   *
    * @param task The `ContinuationTask` instance. It represents
    * a task that you want to add to the continuation chain.
    */
@@ -221,8 +363,14 @@ class CORE_API Continuation final {
   Continuation& Finally(FinallyCallbackType finally_callback);
 
  private:
+  template <typename OtherType>
+  friend class Continuation;
+
+  Continuation(ContinuationImplType continuation, ChainType chain);
+
   FinallyCallbackType finally_callback_;
   ContinuationImplType impl_;
+  ChainType chain_;
 };
 
 /**
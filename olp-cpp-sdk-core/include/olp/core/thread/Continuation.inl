@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 HERE Europe B.V.
+ * Copyright (C) 2022-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,11 +27,63 @@ namespace thread {
 class ExecutionContext;
 class TaskScheduler;
 
+namespace internal {
+
+template <typename ResultType>
+void ContinuationSource<ResultType>::Run(
+    const std::shared_ptr<ContinuationExecution>& execution,
+    typename ContinuationNode<ResultType>::Callback callback) const {
+  const auto& context = execution->context;
+  if (!context.Cancelled()) {
+    task_(context, std::move(callback));
+  }
+
+  if (context.Cancelled()) {
+    execution->Finish(nullptr);
+  }
+}
+
+template <typename ResultType>
+void ContinuationImplSource<ResultType>::Run(
+    const std::shared_ptr<ContinuationExecution>& execution,
+    typename ContinuationNode<ResultType>::Callback callback) const {
+  impl_.Run([execution, callback](void* input, bool cancelled) {
+    if (cancelled || input == nullptr) {
+      execution->Finish(nullptr);
+    } else {
+      callback(std::move(*static_cast<ResultType*>(input)));
+    }
+  });
+}
+
+template <typename InputType, typename ResultType, typename Task>
+void ContinuationStep<InputType, ResultType, Task>::Run(
+    const std::shared_ptr<ContinuationExecution>& execution,
+    typename ContinuationNode<ResultType>::Callback callback) const {
+  previous_->Run(execution,
+                 InputCallback{execution, this, std::move(callback)});
+}
+
+template <typename InputType, typename ResultType, typename Task>
+void ContinuationStep<InputType, ResultType, Task>::InputCallback::operator()(
+    InputType input) {
+  const auto& context = execution->context;
+  if (!context.Cancelled()) {
+    step->task_(context, std::move(input), std::move(callback));
+  }
+
+  if (context.Cancelled()) {
+    execution->Finish(nullptr);
+  }
+}
+
+}  // namespace internal
+
 template <typename ResultType>
 void Continuation<ResultType>::Run() {
   // Run should not start an execution if the `Finally` method is not called
   // for the task continuation.
-  if (!finally_callback_) {
+  if (!finally_callback_ || !chain_) {
     impl_.Clear();
     return;
   }
@@ -60,7 +112,7 @@ void Continuation<ResultType>::Run() {
     }
   });
 
-  impl_.Run([=](void* input, bool cancelled) {
+  auto final_callback = [=](void* input, bool cancelled) {
     impl_.Clear();
 
     const auto finally_callback = std::move(finally_callback_);
@@ -71,6 +123,17 @@ void Continuation<ResultType>::Run() {
         finally_callback(std::move(*static_cast<ResultType*>(input)));
       }
     }
+  };
+
+  // The tasks run one after another in the callbacks of the previous tasks,
+  // so the only scheduler hop is the one that starts the chain.
+  auto chain = chain_;
+  auto execution = std::make_shared<internal::ContinuationExecution>(
+      impl_.GetExecutionContext(), std::move(final_callback), chain);
+  impl_.Start([chain, execution]() {
+    chain->Run(execution, [execution](ResultType result) {
+      execution->Finish(static_cast<void*>(&result));
+    });
   });
 }
 
@@ -111,9 +174,12 @@ template <typename Callable>
 Continuation<internal::DeducedType<Callable>> Continuation<ResultType>::Then(
     Callable task) {
   using NewResultType = internal::DeducedType<Callable>;
-  using Function = internal::TypeToFunctionInput<NewResultType>;
-  return Then(std::function<void(ExecutionContext, ResultType, Function)>(
-      std::move(task)));
+  using Step = internal::ContinuationStep<ResultType, NewResultType, Callable>;
+  if (!chain_) {
+    return {impl_, nullptr};
+  }
+
+  return {impl_, std::make_shared<Step>(chain_, std::move(task))};
 }
 
 template <typename ResultType>
@@ -123,19 +189,14 @@ Continuation<ResultType>::Then(std::function<void(ExecutionContext, ResultType,
                                                   std::function<void(NewType)>)>
                                    task) {
   using NewResultType = internal::RemoveRefAndConst<NewType>;
-  const auto context = impl_.GetExecutionContext();
-
-  return impl_.Then(
-      {[=](void* input, CallbackType callback) {
-         auto in = *static_cast<ResultType*>(input);
-         task(std::move(context), std::move(in),
-              [=](NewResultType arg) { callback(static_cast<void*>(&arg)); });
-       },
-       [](void* input) {
-         auto in = *static_cast<NewResultType*>(input);
-         auto result = std::make_unique<NewResultType>(std::move(in));
-         return internal::MakeUntypedUnique(std::move(result));
-       }});
+  using Task = std::function<void(ExecutionContext, ResultType,
+                                  std::function<void(NewType)>)>;
+  using Step = internal::ContinuationStep<ResultType, NewResultType, Task>;
+  if (!chain_) {
+    return {impl_, nullptr};
+  }
+
+  return {impl_, std::make_shared<Step>(chain_, std::move(task))};
 }
 
 template <typename ResultType>
@@ -153,12 +214,20 @@ template <typename ResultType>
 Continuation<ResultType>::Continuation(
     std::shared_ptr<TaskScheduler> scheduler, ExecutionContext context,
     std::function<void(ExecutionContext, std::function<void(ResultType)>)> task)
-    : impl_(scheduler, context,
-            Continuation<void>::ToAsyncTask(context, std::move(task))) {}
+    : impl_(std::move(scheduler), std::move(context)),
+      chain_(std::make_shared<internal::ContinuationSource<ResultType>>(
+          std::move(task))) {}
 
 template <typename ResultType>
 Continuation<ResultType>::Continuation(ContinuationImplType continuation)
-    : impl_(std::move(continuation)) {}
+    : impl_(continuation),
+      chain_(std::make_shared<internal::ContinuationImplSource<ResultType>>(
+          std::move(continuation))) {}
+
+template <typename ResultType>
+Continuation<ResultType>::Continuation(ContinuationImplType continuation,
+                                       ChainType chain)
+    : impl_(std::move(continuation)), chain_(std::move(chain)) {}
 
 }  // namespace thread
 }  // namespace olp
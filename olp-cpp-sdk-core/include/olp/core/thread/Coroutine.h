@@ -0,0 +1,435 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+/**
+ * @file
+ * @brief The optional coroutine support, available when the SDK is used with
+ * C++20 coroutines. `OLP_SDK_HAS_COROUTINES` is defined in that case.
+ */
+
+#if defined(__has_include)
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine) && \
+    __cpp_impl_coroutine >= 201902L
+#define OLP_SDK_HAS_COROUTINES 1
+#endif
+#endif
+
+#ifdef OLP_SDK_HAS_COROUTINES
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <olp/core/client/ApiError.h>
+#include <olp/core/client/CancellationContext.h>
+#include <olp/core/client/CancellationToken.h>
+#include <olp/core/thread/TaskScheduler.h>
+
+namespace olp {
+namespace thread {
+
+namespace detail {
+
+/// Resumes the coroutine on the scheduler, or right away without one.
+inline void Resume(const std::shared_ptr<TaskScheduler>& scheduler,
+                   std::coroutine_handle<> handle) {
+  if (scheduler) {
+    scheduler->ScheduleTask([handle]() { handle.resume(); });
+  } else {
+    handle.resume();
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Awaits an asynchronous SDK call that reports the result to
+ * a callback.
+ *
+ * The call is started when the coroutine is suspended, and the coroutine is
+ * resumed with the response passed to the callback. No thread is blocked
+ * while waiting. If the callback is invoked before the call returns, the
+ * coroutine continues without being suspended.
+ *
+ * The call is registered in the `CancellationContext` instance, so
+ * cancelling the context cancels the call. If the context is already
+ * cancelled, the call is not started and the response holds
+ * the `Cancelled` error.
+ *
+ * @note The coroutine must not be destroyed while it waits for the response.
+ *
+ * @tparam Response The response type passed to the callback.
+ */
+template <typename Response>
+class CallbackAwaiter final {
+ public:
+  /// The callback that receives the response.
+  using Callback = std::function<void(Response)>;
+  /// Starts the call with the callback and returns its cancellation token.
+  using StartFunction = std::function<client::CancellationToken(Callback)>;
+
+  /**
+   * @brief Creates the `CallbackAwaiter` instance.
+   *
+   * @param start The function that starts the call.
+   * @param context The `CancellationContext` instance used to cancel the call.
+   * @param scheduler The scheduler on which the coroutine is resumed. If it is
+   * not set, the coroutine is resumed on the thread that calls the callback.
+   */
+  CallbackAwaiter(StartFunction start, client::CancellationContext context,
+                  std::shared_ptr<TaskScheduler> scheduler = nullptr)
+      : start_(std::move(start)),
+        context_(std::move(context)),
+        state_(std::make_shared<State>()) {
+    state_->scheduler = std::move(scheduler);
+  }
+
+  /// The call is always started on suspension.
+  bool await_ready() const noexcept { return false; }
+
+  /// Starts the call, returns false if the response is already available.
+  bool await_suspend(std::coroutine_handle<> handle) {
+    state_->handle = handle;
+
+    auto state = state_;
+    Callback callback = [state](Response response) {
+      state->response.emplace(std::move(response));
+      // The second of the callback and `await_suspend` resumes the coroutine.
+      if (state->arrived.exchange(true)) {
+        detail::Resume(state->scheduler, state->handle);
+      }
+    };
+
+    context_.ExecuteOrCancelled(
+        [&]() { return start_(callback); },
+        [&]() { callback(client::ApiError::Cancelled()); });
+
+    return !state_->arrived.exchange(true);
+  }
+
+  /// Gets the response of the call.
+  Response await_resume() { return std::move(*state_->response); }
+
+ private:
+  struct State {
+    std::shared_ptr<TaskScheduler> scheduler;
+    std::coroutine_handle<> handle;
+    std::optional<Response> response;
+    std::atomic<bool> arrived{false};
+  };
+
+  StartFunction start_;
+  client::CancellationContext context_;
+  std::shared_ptr<State> state_;
+};
+
+/**
+ * @brief Awaits a function that is executed on the scheduler.
+ *
+ * Use it for the synchronous operations, e.g. the cache access, so they do
+ * not block the thread of the coroutine. The coroutine is resumed on
+ * the scheduler thread that executed the function.
+ *
+ * @tparam Function The function type.
+ */
+template <typename Function>
+class ScheduledFunctionAwaiter final {
+ public:
+  /// The result of the function.
+  using Result = typename std::invoke_result<Function&>::type;
+
+  /**
+   * @brief Creates the `ScheduledFunctionAwaiter` instance.
+   *
+   * @param scheduler The scheduler used to execute the function. If it is not
+   * set, the function is executed right away.
+   * @param function The function to execute.
+   * @param priority The priority of the task.
+   */
+  ScheduledFunctionAwaiter(std::shared_ptr<TaskScheduler> scheduler,
+                           Function function, uint32_t priority)
+      : scheduler_(std::move(scheduler)),
+        function_(std::move(function)),
+        priority_(priority) {}
+
+  /// Without a scheduler, the function is executed in `await_resume`.
+  bool await_ready() const noexcept { return !scheduler_; }
+
+  /// Schedules the function and the resumption of the coroutine.
+  void await_suspend(std::coroutine_handle<> handle) {
+    scheduler_->ScheduleTask([handle]() { handle.resume(); }, priority_);
+  }
+
+  /// Executes the function on the scheduler thread.
+  Result await_resume() { return function_(); }
+
+ private:
+  std::shared_ptr<TaskScheduler> scheduler_;
+  Function function_;
+  uint32_t priority_;
+};
+
+/**
+ * @brief Executes the function on the scheduler, and resumes the coroutine
+ * with its result on the same thread.
+ *
+ * @code
+ *     auto value = co_await thread::RunOn(scheduler, [&]() {
+ *       return cache->Get(key);
+ *     });
+ * @endcode
+ */
+template <typename Function>
+ScheduledFunctionAwaiter<typename std::decay<Function>::type> RunOn(
+    std::shared_ptr<TaskScheduler> scheduler, Function&& function,
+    uint32_t priority = NORMAL) {
+  return {std::move(scheduler), std::forward<Function>(function), priority};
+}
+
+/**
+ * @brief Moves the coroutine to the scheduler.
+ *
+ * @code
+ *     co_await thread::ResumeOn(scheduler);
+ * @endcode
+ */
+inline auto ResumeOn(std::shared_ptr<TaskScheduler> scheduler,
+                     uint32_t priority = NORMAL) {
+  return RunOn(std::move(scheduler), []() {}, priority);
+}
+
+/**
+ * @brief A lazily started coroutine that produces a value of type `T`.
+ *
+ * The coroutine starts when it is awaited by another coroutine, or when
+ * `Start` is called. Exceptions are rethrown to the awaiting coroutine.
+ *
+ * @code
+ *     thread::Task<DataResponse> GetTwice(VersionedLayerClient& client) {
+ *       auto response = co_await read::AwaitGetData(client, first);
+ *       if (!response) {
+ *         co_return response;
+ *       }
+ *       co_return co_await read::AwaitGetData(client, second);
+ *     }
+ * @endcode
+ *
+ * @tparam T The result type, or `void`.
+ */
+template <typename T>
+class Task;
+
+namespace detail {
+
+template <typename T>
+struct TaskCallback {
+  using type = std::function<void(T)>;
+};
+
+template <>
+struct TaskCallback<void> {
+  using type = std::function<void()>;
+};
+
+class PromiseBase {
+ public:
+  std::suspend_always initial_suspend() const noexcept { return {}; }
+
+  /// Transfers the control to the awaiting coroutine.
+  auto final_suspend() const noexcept {
+    struct FinalAwaiter {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<>) const noexcept {
+        return continuation ? continuation : std::noop_coroutine();
+      }
+      void await_resume() const noexcept {}
+
+      std::coroutine_handle<> continuation;
+    };
+    return FinalAwaiter{continuation_};
+  }
+
+  void unhandled_exception() { exception_ = std::current_exception(); }
+
+  void SetContinuation(std::coroutine_handle<> continuation) {
+    continuation_ = continuation;
+  }
+
+  void RethrowIfFailed() {
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+ private:
+  std::coroutine_handle<> continuation_;
+  std::exception_ptr exception_;
+};
+
+template <typename T>
+class Promise : public PromiseBase {
+ public:
+  Task<T> get_return_object();
+
+  template <typename Value>
+  void return_value(Value&& value) {
+    value_.emplace(std::forward<Value>(value));
+  }
+
+  T TakeResult() {
+    this->RethrowIfFailed();
+    return std::move(*value_);
+  }
+
+ private:
+  std::optional<T> value_;
+};
+
+template <>
+class Promise<void> : public PromiseBase {
+ public:
+  Task<void> get_return_object();
+
+  void return_void() {}
+
+  void TakeResult() { this->RethrowIfFailed(); }
+};
+
+}  // namespace detail
+
+template <typename T>
+class Task final {
+ public:
+  /// The promise type used by the compiler.
+  using promise_type = detail::Promise<T>;
+
+  Task(Task&& other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      Destroy();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task() { Destroy(); }
+
+  /// Starts the coroutine when it is awaited.
+  auto operator co_await() && noexcept {
+    struct Awaiter {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<> continuation) noexcept {
+        handle.promise().SetContinuation(continuation);
+        return handle;
+      }
+      T await_resume() { return handle.promise().TakeResult(); }
+
+      std::coroutine_handle<promise_type> handle;
+    };
+    return Awaiter{handle_};
+  }
+
+  /// The callback that receives the result of `Start`.
+  using Callback = typename detail::TaskCallback<T>::type;
+
+  /**
+   * @brief Starts the coroutine from a regular function.
+   *
+   * The task keeps running after this call returns, and the callback is
+   * invoked with the result once it is done. An exception thrown by
+   * the coroutine terminates the program.
+   *
+   * @param callback The callback that receives the result, might be empty.
+   */
+  void Start(Callback callback = nullptr) && {
+    Detach(std::move(*this), std::move(callback));
+  }
+
+ private:
+  friend class detail::Promise<T>;
+
+  explicit Task(std::coroutine_handle<promise_type> handle)
+      : handle_(handle) {}
+
+  /// Fires and forgets a coroutine that owns the task.
+  struct Detached {
+    struct promise_type {
+      Detached get_return_object() const noexcept { return {}; }
+      std::suspend_never initial_suspend() const noexcept { return {}; }
+      std::suspend_never final_suspend() const noexcept { return {}; }
+      void return_void() const noexcept {}
+      void unhandled_exception() const noexcept { std::terminate(); }
+    };
+  };
+
+  static Detached Detach(Task task, Callback callback) {
+    if constexpr (std::is_void<T>::value) {
+      co_await std::move(task);
+      if (callback) {
+        callback();
+      }
+    } else {
+      auto result = co_await std::move(task);
+      if (callback) {
+        callback(std::move(result));
+      }
+    }
+  }
+
+  void Destroy() {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = nullptr;
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object() {
+  return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() {
+  return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+}  // namespace detail
+
+}  // namespace thread
+}  // namespace olp
+
+#endif  // OLP_SDK_HAS_COROUTINES
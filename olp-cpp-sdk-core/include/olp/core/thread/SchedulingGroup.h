@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace thread {
+
+/**
+ * @brief A group of tasks that shares a `TaskScheduler` fairly with
+ * the other groups.
+ *
+ * A scheduler that supports the groups queues the tasks of each group
+ * separately. Within a group, the tasks are executed by priority and then in
+ * the FIFO order. Between the groups with tasks of the same priority,
+ * the execution is shared according to the group weights, so a group with
+ * a long queue does not delay the tasks of the others.
+ *
+ * The groups are cheap to copy and compare by the identifier.
+ */
+class CORE_API SchedulingGroup {
+ public:
+  /**
+   * @brief Creates a new group that is different from all the other groups.
+   *
+   * Use it to group the tasks of a client instance.
+   *
+   * @param weight The share of the group relative to the other groups.
+   * Zero is treated as one.
+   */
+  explicit SchedulingGroup(uint32_t weight = 1u);
+
+  /**
+   * @brief Gets the group for the key.
+   *
+   * The groups created from the same key are the same group. For example, use
+   * the catalog HRN as the key to group the tasks of the clients of
+   * the catalog.
+   *
+   * @param key The key of the group.
+   * @param weight The share of the group relative to the other groups.
+   * Zero is treated as one.
+   *
+   * @return The `SchedulingGroup` instance.
+   */
+  static SchedulingGroup FromKey(const std::string& key, uint32_t weight = 1u);
+
+  /**
+   * @brief Gets the identifier of the group.
+   *
+   * Zero is reserved for the tasks scheduled without a group.
+   *
+   * @return The group identifier.
+   */
+  uint64_t GetId() const { return id_; }
+
+  /**
+   * @brief Gets the weight of the group.
+   *
+   * @return The group weight, at least one.
+   */
+  uint32_t GetWeight() const { return weight_; }
+
+ private:
+  SchedulingGroup(uint64_t id, uint32_t weight);
+
+  uint64_t id_;
+  uint32_t weight_;
+};
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <olp/core/CoreApi.h>
+
+namespace olp {
+namespace thread {
+
+/**
+ * @brief Marks the current thread as blocked while the object exists.
+ *
+ * Wrap the waits for the network, locks, disk flushes, or timers in the
+ * scheduled tasks with it. On a worker thread of an elastic
+ * `ThreadPoolTaskScheduler`, the pool may start a compensating worker while
+ * the task waits, so the queued tasks are not starved. On any other thread,
+ * it does nothing.
+ *
+ * The regions can be nested, only the outermost one is reported.
+ */
+class CORE_API ScopedBlockingRegion final {
+ public:
+  ScopedBlockingRegion();
+  ~ScopedBlockingRegion();
+
+  ScopedBlockingRegion(const ScopedBlockingRegion&) = delete;
+  ScopedBlockingRegion& operator=(const ScopedBlockingRegion&) = delete;
+};
+
+}  // namespace thread
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,10 +19,18 @@
 
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include <olp/core/client/ApiResponse.h>
 #include <olp/core/client/CancellationContext.h>
+#include <olp/core/client/CancellationToken.h>
+#include <olp/core/http/LatencyHistogram.h>
+#include <olp/core/thread/SchedulingGroup.h>
 #include <olp/core/utils/WarningWorkarounds.h>
 
 namespace olp {
@@ -47,6 +55,54 @@ class CORE_API TaskScheduler {
   /// An alias for the abstract interface input.
   using CallFuncType = std::function<void()>;
 
+  /// The statistics of the tasks with the same priority.
+  struct PriorityStatistics {
+    /// The number of tasks waiting in the queue.
+    size_t queue_depth{0u};
+
+    /// The time between enqueueing and starting the executed tasks.
+    http::LatencyHistogram wait_time;
+
+    /// The execution time of the finished tasks.
+    http::LatencyHistogram execution_time;
+  };
+
+  /// The statistics of a worker thread.
+  struct ThreadStatistics {
+    /// The time spent executing tasks since the thread is started.
+    std::chrono::microseconds busy_time{0};
+
+    /// The share of the thread lifetime spent executing tasks, from 0 to 1.
+    double busy_ratio{0.0};
+
+    /// The execution time of the task that is running now, zero if idle.
+    std::chrono::microseconds current_task_time{0};
+  };
+
+  /// The statistics of the tasks executed by the scheduler.
+  struct Statistics {
+    /// The statistics per task priority.
+    std::map<uint32_t, PriorityStatistics> priorities;
+
+    /// The statistics per worker thread.
+    std::vector<ThreadStatistics> threads;
+
+    /// The longest execution time of a task, including the running tasks.
+    std::chrono::microseconds longest_task_time{0};
+
+    /// The priority of the longest task.
+    uint32_t longest_task_priority{0u};
+  };
+
+  /**
+   * @brief Called when a task takes longer than the threshold.
+   *
+   * Called on the worker thread after the task is finished, with the
+   * execution time and the priority of the task.
+   */
+  using SlowTaskCallback =
+      std::function<void(std::chrono::microseconds, uint32_t)>;
+
   virtual ~TaskScheduler() = default;
 
   /**
@@ -71,6 +127,21 @@ class CORE_API TaskScheduler {
     EnqueueTask(std::move(func), priority);
   }
 
+  /**
+   * @brief Schedules the asynchronous task in the scheduling group.
+   *
+   * @param[in] func The callable target that should be added to the scheduling
+   * pipeline.
+   * @param[in] priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   * @param[in] group The group that shares the scheduler fairly with the other
+   * groups.
+   */
+  void ScheduleTask(CallFuncType&& func, uint32_t priority,
+                    const SchedulingGroup& group) {
+    EnqueueTask(std::move(func), priority, group);
+  }
+
   /**
    * @brief Schedules the asynchronous cancellable task.
    *
@@ -102,6 +173,76 @@ class CORE_API TaskScheduler {
     return context;
   }
 
+  /**
+   * @brief Schedules the asynchronous task to be executed after the delay.
+   *
+   * The schedulers that implement `EnqueueDelayedTask`, e.g.
+   * `ThreadPoolTaskScheduler`, add the task to the scheduling pipeline once
+   * the delay expires, so it does not occupy any thread while waiting.
+   *
+   * @note With the default `EnqueueDelayedTask` implementation, the task is
+   * enqueued right away and holds the thread that executes it for the whole
+   * delay. Every waiting task then takes a worker from the scheduler, e.g. the
+   * retries, hedged requests, and requests to a rate limited host of
+   * `OlpClient`, and can starve the other tasks of a small thread pool.
+   * Custom schedulers should override `EnqueueDelayedTask` with a timer.
+   *
+   * @param[in] func The callable target that should be added to the scheduling
+   * pipeline.
+   * @param[in] delay The minimal time to wait before the task is enqueued.
+   * @param[in] priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   *
+   * @return The `CancellationToken` instance that removes the task if it was
+   * not executed yet.
+   */
+  client::CancellationToken ScheduleAfter(CallFuncType&& func,
+                                          std::chrono::milliseconds delay,
+                                          uint32_t priority = NORMAL) {
+    return ScheduleAt(std::move(func),
+                      std::chrono::steady_clock::now() + delay, priority);
+  }
+
+  /**
+   * @brief Schedules the asynchronous task to be executed at the given time.
+   *
+   * The task waits for the time the same as in `ScheduleAfter`.
+   *
+   * @param[in] func The callable target that should be added to the scheduling
+   * pipeline.
+   * @param[in] time The time point before which the task is not enqueued.
+   * @param[in] priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   *
+   * @return The `CancellationToken` instance that removes the task if it was
+   * not executed yet.
+   */
+  client::CancellationToken ScheduleAt(
+      CallFuncType&& func, std::chrono::steady_clock::time_point time,
+      uint32_t priority = NORMAL);
+
+  /**
+   * @brief Gets the statistics of the tasks executed by the scheduler.
+   *
+   * The statistics are collected since the scheduler is created. The default
+   * implementation does not collect them and returns empty statistics.
+   *
+   * @return The `Statistics` instance.
+   */
+  virtual Statistics GetStatistics() const;
+
+  /**
+   * @brief Sets a callback for the tasks that take longer than the threshold.
+   *
+   * The default implementation does not measure the tasks and ignores the
+   * callback.
+   *
+   * @param[in] threshold The minimal execution time of a reported task.
+   * @param[in] callback The callback, or `nullptr` to stop reporting.
+   */
+  virtual void SetSlowTaskCallback(std::chrono::milliseconds threshold,
+                                   SlowTaskCallback callback);
+
  protected:
   /**
    * @brief The abstract enqueue task interface that is implemented by
@@ -136,6 +277,52 @@ class CORE_API TaskScheduler {
     OLP_SDK_CORE_UNUSED(priority);
     EnqueueTask(std::forward<CallFuncType>(func));
   }
+
+  /**
+   * @brief The enqueue task with scheduling group interface that can be
+   * implemented by the subclass.
+   *
+   * Implement this method to share the threads fairly between the groups:
+   * keep the priorities and the order of the tasks within a group, and
+   * alternate between the groups according to their weights. The default
+   * implementation ignores the group.
+   *
+   * @param[in] func The rvalue reference of the task that should be enqueued.
+   * Once this method is called, you own the task.
+   * @param[in] priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   * @param[in] group The scheduling group of the task.
+   */
+  virtual void EnqueueTask(CallFuncType&& func, uint32_t priority,
+                           const SchedulingGroup& group) {
+    OLP_SDK_CORE_UNUSED(group);
+    EnqueueTask(std::forward<CallFuncType>(func), priority);
+  }
+
+  /**
+   * @brief The enqueue delayed task interface that can be implemented by the
+   * subclass.
+   *
+   * Implement this method to enqueue the task with the given priority once
+   * the time is reached, e.g. using a timer. The default implementation
+   * enqueues the task right away, and the task sleeps until the time on the
+   * thread that executes it, so the thread is busy for the whole delay and
+   * cannot execute any other task. Override this method when the scheduler
+   * runs on a few threads or the delays are long.
+   *
+   * @param[in] func The rvalue reference of the task that should be enqueued.
+   * Once this method is called, you own the task.
+   * @param[in] time The time point before which the task must not be executed.
+   * @param[in] priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   *
+   * @return The `CancellationToken` instance that stops waiting for the time.
+   * The task does not need to be removed, as it checks the cancellation
+   * itself.
+   */
+  virtual client::CancellationToken EnqueueDelayedTask(
+      CallFuncType&& func, std::chrono::steady_clock::time_point time,
+      uint32_t priority);
 };
 
 /**
@@ -158,5 +345,21 @@ inline CORE_API void ExecuteOrSchedule(
   scheduler->ScheduleTask(std::move(func));
 }
 
+/**
+ * @brief Creates a task scheduler that schedules all the tasks to another
+ * scheduler in the scheduling group.
+ *
+ * Use it to give a client its own group in a scheduler shared by many
+ * clients.
+ *
+ * @param scheduler The scheduler that executes the tasks.
+ * @param group The scheduling group of the tasks.
+ *
+ * @return The `TaskScheduler` instance, or `nullptr` if `scheduler` is
+ * `nullptr`.
+ */
+CORE_API std::shared_ptr<TaskScheduler> CreateGroupTaskScheduler(
+    std::shared_ptr<TaskScheduler> scheduler, SchedulingGroup group);
+
 }  // namespace thread
 }  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -27,13 +29,32 @@
 namespace olp {
 namespace thread {
 
+class TaskStatistics;
+class TimerWheel;
+
 /**
  * @brief An implementation of the `TaskScheduler` instance that uses a thread
  * pool.
  *
+ * The pool has a fixed number of threads, or it is elastic: it keeps the core
+ * threads running and starts extra threads, up to the maximum, while the
+ * tasks wait in a `ScopedBlockingRegion`. The extra threads exit after being
+ * idle for the idle timeout.
  */
 class CORE_API ThreadPoolTaskScheduler final : public TaskScheduler {
  public:
+  /// The settings of an elastic thread pool.
+  struct ElasticSettings {
+    /// The number of threads that are not blocked and kept running.
+    size_t core_thread_count{1u};
+
+    /// The maximal number of threads, including the blocked ones.
+    size_t max_thread_count{16u};
+
+    /// The time an extra thread waits for a task before it exits.
+    std::chrono::milliseconds idle_timeout{std::chrono::seconds(30)};
+  };
+
   /**
    * @brief Creates the `ThreadPoolTaskScheduler` object with one thread.
    *
@@ -42,7 +63,20 @@ class CORE_API ThreadPoolTaskScheduler final : public TaskScheduler {
   explicit ThreadPoolTaskScheduler(size_t thread_count = 1u);
 
   /**
-   * @brief Closes the `SyncQueue` instance and joins threads.
+   * @brief Creates the elastic `ThreadPoolTaskScheduler` object.
+   *
+   * The core threads are started right away. While a task is in a
+   * `ScopedBlockingRegion` and the other tasks wait in the queue, the pool
+   * starts an extra thread, so the number of the threads that are not
+   * blocked stays at the core thread count.
+   *
+   * @param settings The settings of the pool. The core thread count is at
+   * least one, and the maximal thread count is at least the core one.
+   */
+  explicit ThreadPoolTaskScheduler(ElasticSettings settings);
+
+  /**
+   * @brief Discards the queued tasks and joins threads.
    */
   ~ThreadPoolTaskScheduler() override;
 
@@ -55,6 +89,20 @@ class CORE_API ThreadPoolTaskScheduler final : public TaskScheduler {
   /// Non-copyable, non-movable
   ThreadPoolTaskScheduler& operator=(ThreadPoolTaskScheduler&&) = delete;
 
+  /**
+   * @brief Gets the statistics of the executed tasks.
+   *
+   * The statistics are always collected, the overhead is a few clock reads
+   * per task.
+   *
+   * @return The `Statistics` instance.
+   */
+  Statistics GetStatistics() const override;
+
+  /// @copydoc TaskScheduler::SetSlowTaskCallback()
+  void SetSlowTaskCallback(std::chrono::milliseconds threshold,
+                           SlowTaskCallback callback) override;
+
  protected:
   /**
    * @brief Overrides the base class method to enqueue tasks and execute them on
@@ -81,13 +129,45 @@ class CORE_API ThreadPoolTaskScheduler final : public TaskScheduler {
   void EnqueueTask(TaskScheduler::CallFuncType&& func,
                    uint32_t priority) override;
 
+  /**
+   * @brief Overrides the base class method to enqueue tasks to the queue of
+   * the scheduling group.
+   *
+   * The tasks of the groups are executed fairly according to the group
+   * weights. The tasks without a group form a group with weight one.
+   *
+   * @param func The rvalue reference of the task that should be enqueued.
+   * @param priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   * @param group The scheduling group of the task.
+   */
+  void EnqueueTask(TaskScheduler::CallFuncType&& func, uint32_t priority,
+                   const SchedulingGroup& group) override;
+
+  /**
+   * @brief Overrides the base class method to enqueue the task with a timer,
+   * so no thread is occupied while waiting for the time.
+   *
+   * @param func The rvalue reference of the task that should be enqueued.
+   * @param time The time point before which the task is not enqueued.
+   * @param priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   *
+   * @return The `CancellationToken` instance that removes the timer.
+   */
+  client::CancellationToken EnqueueDelayedTask(
+      TaskScheduler::CallFuncType&& func,
+      std::chrono::steady_clock::time_point time, uint32_t priority) override;
+
  private:
   class QueueImpl;
 
-  /// Thread pool created in constructor.
-  std::vector<std::thread> thread_pool_;
-  /// SyncQueue used to manage tasks.
+  /// The task queue and the worker threads.
   std::unique_ptr<QueueImpl> queue_;
+  /// Timers of the delayed tasks.
+  std::shared_ptr<TimerWheel> timers_;
+  /// The statistics of the executed tasks.
+  std::unique_ptr<TaskStatistics> statistics_;
 };
 
 }  // namespace thread
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <olp/core/thread/TaskScheduler.h>
+
+namespace olp {
+namespace thread {
+
+class TaskStatistics;
+class TimerWheel;
+struct PrioritizedTask;
+
+/**
+ * @brief An implementation of the `TaskScheduler` instance that uses a thread
+ * pool with a task queue per worker.
+ *
+ * Unlike `ThreadPoolTaskScheduler`, the workers do not share a single queue
+ * and lock. Tasks scheduled from a worker thread go to the queue of that
+ * worker, other tasks are distributed between the workers in turn. An idle
+ * worker steals the tasks from the queues of the other workers.
+ *
+ * Every queue has a FIFO lane per priority. A worker executes the task with
+ * the highest priority it can find, so the priorities are respected between
+ * the queues as well. The order of the tasks with the same priority is kept
+ * within a queue, but not between the queues.
+ *
+ * Use it when many small tasks are scheduled, e.g. during prefetch, and the
+ * shared queue of `ThreadPoolTaskScheduler` becomes the bottleneck.
+ */
+class CORE_API WorkStealingTaskScheduler final : public TaskScheduler {
+ public:
+  /**
+   * @brief Creates the `WorkStealingTaskScheduler` object.
+   *
+   * @param thread_count The number of threads initialized in the thread pool.
+   */
+  explicit WorkStealingTaskScheduler(size_t thread_count = 1u);
+
+  /**
+   * @brief Discards the pending tasks and joins threads.
+   */
+  ~WorkStealingTaskScheduler() override;
+
+  /// Non-copyable, non-movable
+  WorkStealingTaskScheduler(const WorkStealingTaskScheduler&) = delete;
+  /// Non-copyable, non-movable
+  WorkStealingTaskScheduler& operator=(const WorkStealingTaskScheduler&) =
+      delete;
+  /// Non-copyable, non-movable
+  WorkStealingTaskScheduler(WorkStealingTaskScheduler&&) = delete;
+  /// Non-copyable, non-movable
+  WorkStealingTaskScheduler& operator=(WorkStealingTaskScheduler&&) = delete;
+
+  /// @copydoc ThreadPoolTaskScheduler::GetStatistics()
+  Statistics GetStatistics() const override;
+
+  /// @copydoc TaskScheduler::SetSlowTaskCallback()
+  void SetSlowTaskCallback(std::chrono::milliseconds threshold,
+                           SlowTaskCallback callback) override;
+
+ protected:
+  /**
+   * @brief Overrides the base class method to enqueue tasks and execute them on
+   * the next free thread from the thread pool.
+   *
+   * @note Tasks added with this method has Priority::NORMAL priority.
+   *
+   * @param func The rvalue reference of the task that should be enqueued.
+   */
+  void EnqueueTask(TaskScheduler::CallFuncType&& func) override;
+
+  /**
+   * @brief Overrides the base class method to enqueue tasks and execute them on
+   * the next free thread from the thread pool.
+   *
+   * @param func The rvalue reference of the task that should be enqueued.
+   * @param priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   */
+  void EnqueueTask(TaskScheduler::CallFuncType&& func,
+                   uint32_t priority) override;
+
+  /**
+   * @brief Overrides the base class method to enqueue the task with a timer,
+   * so no thread is occupied while waiting for the time.
+   *
+   * @param func The rvalue reference of the task that should be enqueued.
+   * @param time The time point before which the task is not enqueued.
+   * @param priority The priority of the task. Tasks with higher priority
+   * executes earlier.
+   *
+   * @return The `CancellationToken` instance that removes the timer.
+   */
+  client::CancellationToken EnqueueDelayedTask(
+      TaskScheduler::CallFuncType&& func,
+      std::chrono::steady_clock::time_point time, uint32_t priority) override;
+
+ private:
+  class WorkerQueue;
+
+  /// Gets a task from the worker queue or steals it from the other queues.
+  bool Pop(size_t index, PrioritizedTask& task);
+
+  void Run(size_t index);
+
+  /// The queues of the workers, one per thread.
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  /// Thread pool created in constructor.
+  std::vector<std::thread> thread_pool_;
+  /// The next queue for the tasks scheduled outside of the workers.
+  std::atomic<size_t> next_queue_{0u};
+  /// The number of tasks in the queues. Might be negative for a short time.
+  std::atomic<int64_t> pending_{0};
+  /// The number of workers waiting for tasks.
+  std::atomic<size_t> sleeping_{0u};
+  std::atomic<bool> closed_{false};
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  /// Timers of the delayed tasks.
+  std::shared_ptr<TimerWheel> timers_;
+  /// The statistics of the executed tasks.
+  std::unique_ptr<TaskStatistics> statistics_;
+};
+
+}  // namespace thread
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 HERE Europe B.V.
+ * Copyright (C) 2021-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "DiskCacheEnv.h"
 
 #include <olp/core/porting/platform.h>
+#include <olp/core/thread/ScopedBlockingRegion.h>
 #include <olp/core/utils/WarningWorkarounds.h>
 
 #ifndef PORTING_PLATFORM_WINDOWS
@@ -309,6 +310,8 @@ class PosixWritableFile final : public leveldb::WritableFile {
   // The path argument is only used to populate the description string in the
   // returned Status if an error occurs.
   static leveldb::Status SyncFd(int fd, const std::string& fd_path) {
+    olp::thread::ScopedBlockingRegion blocking_region;
+
 #if HAVE_FULLFSYNC
     // On macOS and iOS, fsync() doesn't guarantee durability past power
     // failures. fcntl(F_FULLFSYNC) is required for that purpose. Some
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/client/AdaptiveConcurrencyLimiter.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <olp/core/http/HttpStatusCode.h>
+#include <olp/core/http/NetworkTypes.h>
+
+namespace olp {
+namespace client {
+
+namespace {
+/// The number of samples at the minimum limit that relearn the baseline.
+constexpr size_t kLatencyWindowSamples = 20u;
+
+/// Latencies below this value are not distinguishable from each other.
+constexpr std::chrono::milliseconds kMinBaselineLatency(1);
+}  // namespace
+
+AdaptiveConcurrencyLimiter::AdaptiveConcurrencyLimiter(
+    AdaptiveConcurrencySettings settings)
+    : settings_(std::move(settings)),
+      limit_(static_cast<double>(settings_.initial_limit)),
+      baseline_latency_(std::chrono::milliseconds::max()),
+      window_min_latency_(std::chrono::milliseconds::max()) {}
+
+void AdaptiveConcurrencyLimiter::Acquire(std::function<void()> task) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue_.push_back(std::move(task));
+  DrainUnsafe(lock);
+}
+
+void AdaptiveConcurrencyLimiter::Release() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (in_flight_ > 0u) {
+    --in_flight_;
+  }
+  DrainUnsafe(lock);
+}
+
+void AdaptiveConcurrencyLimiter::Update(std::chrono::milliseconds latency,
+                                        Outcome outcome) {
+  if (outcome == Outcome::kIgnored) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const auto baseline = std::max(baseline_latency_, kMinBaselineLatency);
+
+  if (outcome == Outcome::kSuccess) {
+    baseline_latency_ = std::min(baseline_latency_, latency);
+
+    // At the minimum limit, the latency includes no queueing caused by this
+    // limiter, so the baseline is relearned there if the link became slower.
+    if (LimitUnsafe() <= settings_.min_limit) {
+      window_min_latency_ = std::min(window_min_latency_, latency);
+      if (++window_samples_ >= kLatencyWindowSamples) {
+        baseline_latency_ = window_min_latency_;
+        window_samples_ = 0u;
+      }
+    } else {
+      window_min_latency_ = std::chrono::milliseconds::max();
+      window_samples_ = 0u;
+    }
+  }
+
+  const bool congested =
+      outcome == Outcome::kOverload ||
+      (baseline != std::chrono::milliseconds::max() &&
+       latency.count() > baseline.count() * settings_.latency_tolerance);
+
+  // The requests that were in flight at the last decrease saw the same
+  // congestion, so the limit is decreased at most once per round trip.
+  const bool holdoff = decrease_holdoff_ > 0u;
+  if (holdoff) {
+    --decrease_holdoff_;
+  }
+
+  if (congested) {
+    if (!holdoff) {
+      limit_ = std::max(limit_ * settings_.backoff_ratio,
+                        static_cast<double>(settings_.min_limit));
+      decrease_holdoff_ = in_flight_ > 0u ? in_flight_ - 1u : 0u;
+    }
+    return;
+  }
+
+  // Grow only when the limit is reached, otherwise the latency says nothing
+  // about the higher concurrency.
+  if (in_flight_ >= LimitUnsafe() || !queue_.empty()) {
+    limit_ = std::min(limit_ + 1.0 / limit_,
+                      static_cast<double>(settings_.max_limit));
+  }
+}
+
+AdaptiveConcurrencyLimiter::Outcome AdaptiveConcurrencyLimiter::Classify(
+    int status) {
+  switch (status) {
+    case http::HttpStatusCode::REQUEST_TIMEOUT:
+    case http::HttpStatusCode::TOO_MANY_REQUESTS:
+    case http::HttpStatusCode::SERVICE_UNAVAILABLE:
+    case http::HttpStatusCode::GATEWAY_TIMEOUT:
+    case static_cast<int>(http::ErrorCode::TIMEOUT_ERROR):
+      return Outcome::kOverload;
+    default:
+      return status < 0 ? Outcome::kIgnored : Outcome::kSuccess;
+  }
+}
+
+size_t AdaptiveConcurrencyLimiter::GetLimit() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return LimitUnsafe();
+}
+
+size_t AdaptiveConcurrencyLimiter::GetInFlight() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return in_flight_;
+}
+
+size_t AdaptiveConcurrencyLimiter::GetQueueSize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.size();
+}
+
+size_t AdaptiveConcurrencyLimiter::LimitUnsafe() const {
+  return std::max(static_cast<size_t>(limit_), settings_.min_limit);
+}
+
+void AdaptiveConcurrencyLimiter::DrainUnsafe(
+    std::unique_lock<std::mutex>& lock) {
+  // The tasks may release their slots synchronously; the thread that is
+  // already draining picks up the freed slots instead of recursing.
+  if (draining_) {
+    return;
+  }
+
+  draining_ = true;
+  while (!queue_.empty() && in_flight_ < LimitUnsafe()) {
+    auto task = std::move(queue_.front());
+    queue_.pop_front();
+    ++in_flight_;
+
+    lock.unlock();
+    task();
+    lock.lock();
+  }
+  draining_ = false;
+}
+
+}  // namespace client
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,7 +19,11 @@
 
 #include "ApiLookupClientImpl.h"
 
+#include <sstream>
+#include <vector>
+
 #include <olp/core/client/HRN.h>
+#include <olp/core/http/NetworkConstants.h>
 #include <olp/core/logging/Log.h>
 #include "client/api/PlatformApi.h"
 #include "client/api/ResourcesApi.h"
@@ -90,6 +94,51 @@ std::string ClientCacheKey(const std::string& service,
                            const std::string& service_version) {
   return service + service_version;
 }
+
+/// Returns the scheme and the authority of the URL, e.g. "https://here.com/".
+std::string GetOrigin(const std::string& url) {
+  const auto scheme_end = url.find("://");
+  if (scheme_end == std::string::npos) {
+    return {};
+  }
+
+  const auto authority_end = url.find_first_of("/?#", scheme_end + 3u);
+  return url.substr(0, authority_end) + '/';
+}
+
+void SendPrewarmRequest(const OlpClientSettings& settings,
+                        const std::string& url) {
+  const auto& network = settings.network_request_handler;
+  if (!network) {
+    return;
+  }
+
+  const auto& retry_settings = settings.retry_settings;
+  http::NetworkRequest request(url);
+  request.WithVerb(http::NetworkRequest::HttpVerb::HEAD)
+      .WithHeader(http::kUserAgentHeader, http::kOlpSdkUserAgent)
+      .WithSettings(
+          http::NetworkSettings()
+              .WithConnectionTimeout(retry_settings.connection_timeout)
+              .WithTransferTimeout(retry_settings.transfer_timeout)
+              .WithProxySettings(settings.proxy_settings.value_or(
+                  http::NetworkProxySettings())));
+
+  // Only the connection is of interest, the response is ignored.
+  const auto outcome =
+      network->Send(std::move(request), std::make_shared<std::stringstream>(),
+                    [url](http::NetworkResponse response) {
+                      OLP_SDK_LOG_DEBUG_F(
+                          kLogTag, "Connection prewarmed, url='%s', status=%d",
+                          url.c_str(), response.GetStatus());
+                    });
+
+  if (!outcome.IsSuccessful()) {
+    const auto error = http::ErrorCodeToString(outcome.GetErrorCode());
+    OLP_SDK_LOG_DEBUG_F(kLogTag, "Prewarm failed, url='%s', error='%s'",
+                        url.c_str(), error.c_str());
+  }
+}
 }  // namespace
 
 ApiLookupClientImpl::ApiLookupClientImpl(const HRN& catalog,
@@ -139,6 +188,7 @@ ApiLookupClient::LookupApiResponse ApiLookupClientImpl::LookupApi(
   if (options != OnlineOnly && options != CacheWithUpdate) {
     PutToDiskCache(api_result);
   }
+  PrewarmConnections(api_result);
 
   auto url = FindApi(api_result.first, service, service_version);
   if (url.empty()) {
@@ -195,6 +245,7 @@ CancellationToken ApiLookupClientImpl::LookupApi(
     if (options != OnlineOnly && options != CacheWithUpdate) {
       PutToDiskCache(api_result);
     }
+    PrewarmConnections(api_result);
 
     const auto url = FindApi(api_result.first, service, service_version);
     if (url.empty()) {
@@ -296,5 +347,35 @@ void ApiLookupClientImpl::PutToDiskCache(const ApisResult& available_services) {
   }
 }
 
+void ApiLookupClientImpl::PrewarmConnections(
+    const ApisResult& available_services) {
+  if (!settings_.api_lookup_settings.prewarm_connections) {
+    return;
+  }
+
+  std::vector<std::string> new_hosts;
+  for (const auto& service_api : available_services.first) {
+    const auto& base_url = service_api.GetBaseUrl();
+    CreateAndCacheClient(
+        base_url,
+        ClientCacheKey(service_api.GetApi(), service_api.GetVersion()),
+        available_services.second);
+
+    auto origin = GetOrigin(base_url);
+    if (origin.empty()) {
+      continue;
+    }
+
+    std::lock_guard<std::mutex> lock(cached_clients_mutex_);
+    if (prewarmed_hosts_.insert(origin).second) {
+      new_hosts.push_back(std::move(origin));
+    }
+  }
+
+  for (const auto& host : new_hosts) {
+    SendPrewarmRequest(settings_, host);
+  }
+}
+
 }  // namespace client
 }  // namespace olp
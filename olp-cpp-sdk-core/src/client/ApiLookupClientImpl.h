@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <olp/core/client/ApiError.h>
 #include <olp/core/client/ApiLookupClient.h>
@@ -65,6 +66,10 @@ class ApiLookupClientImpl {
 
   void PutToDiskCache(const ApisResult& available_services);
 
+  /// Caches the clients of all the services and opens the connections to
+  /// their hosts, if enabled in the settings.
+  void PrewarmConnections(const ApisResult& available_services);
+
   const HRN& catalog_;
   const std::string catalog_string_;
   const OlpClientSettings& settings_;
@@ -72,6 +77,7 @@ class ApiLookupClientImpl {
 
   std::mutex cached_clients_mutex_;
   std::unordered_map<std::string, ClientWithExpiration> cached_clients_;
+  std::unordered_set<std::string> prewarmed_hosts_;
 };
 
 }  // namespace client
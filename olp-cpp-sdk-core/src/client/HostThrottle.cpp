@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "HostThrottle.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+#include "olp/core/http/HttpStatusCode.h"
+#include "olp/core/http/NetworkConstants.h"
+#include "olp/core/http/NetworkUtils.h"
+
+namespace olp {
+namespace client {
+
+namespace {
+/// Longer delays exceed any sensible timeout, so the delay is clamped to it.
+constexpr std::chrono::seconds kMaxRetryAfter(24 * 60 * 60);
+
+/// Days since 1970-01-01 of the civil date, from H. Hinnant's algorithms.
+int64_t DaysFromCivil(int64_t year, unsigned month, unsigned day) {
+  year -= month <= 2 ? 1 : 0;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const auto year_of_era = static_cast<unsigned>(year - era * 400);
+  const unsigned day_of_year =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const unsigned day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+}
+
+/// Parses the IMF-fixdate, e.g. "Wed, 21 Oct 2015 07:28:00 GMT".
+porting::optional<std::chrono::system_clock::time_point> ParseHttpDate(
+    const std::string& value) {
+  static const char* kMonths[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                  "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  char month_name[4] = {};
+  int day = 0, year = 0, hour = 0, minute = 0, second = 0;
+  if (std::sscanf(value.c_str(), "%*3s, %2d %3s %4d %2d:%2d:%2d GMT", &day,
+                  month_name, &year, &hour, &minute, &second) != 6) {
+    return porting::none;
+  }
+
+  const auto month = std::find_if(
+      std::begin(kMonths), std::end(kMonths),
+      [&](const char* name) { return std::strcmp(name, month_name) == 0; });
+  if (month == std::end(kMonths)) {
+    return porting::none;
+  }
+
+  const auto days = DaysFromCivil(
+      year, static_cast<unsigned>(month - std::begin(kMonths) + 1),
+      static_cast<unsigned>(day));
+  return std::chrono::system_clock::time_point(std::chrono::seconds(
+      days * 86400 + hour * 3600 + minute * 60 + second));
+}
+}  // namespace
+
+std::shared_ptr<HostThrottle> HostThrottle::Get(const std::string& url) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::shared_ptr<HostThrottle>> hosts;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& throttle = hosts[http::NetworkUtils::ExtractHost(url)];
+  if (!throttle) {
+    throttle = std::make_shared<HostThrottle>();
+  }
+  return throttle;
+}
+
+porting::optional<std::chrono::milliseconds> HostThrottle::GetRetryAfter(
+    const HttpResponse& response) {
+  const auto status = response.GetStatus();
+  if (status != http::HttpStatusCode::TOO_MANY_REQUESTS &&
+      status != http::HttpStatusCode::SERVICE_UNAVAILABLE) {
+    return porting::none;
+  }
+
+  const auto& headers = response.GetHeaders();
+  const auto header =
+      std::find_if(headers.begin(), headers.end(), [](const http::Header& h) {
+        return http::NetworkUtils::CaseInsensitiveCompare(
+            h.first, http::kRetryAfterHeader);
+      });
+  if (header == headers.end() || header->second.empty()) {
+    return porting::none;
+  }
+
+  const auto& value = header->second;
+  if (std::all_of(value.begin(), value.end(),
+                  [](char c) { return std::isdigit(c) != 0; })) {
+    // Clamped before the conversion, as a long value overflows in ms.
+    return std::chrono::milliseconds(std::chrono::seconds(
+        std::min<long long>(std::strtoll(value.c_str(), nullptr, 10),
+                            kMaxRetryAfter.count())));
+  }
+
+  const auto date = ParseHttpDate(value);
+  if (!date) {
+    return porting::none;
+  }
+
+  return std::max(std::chrono::duration_cast<std::chrono::milliseconds>(
+                      *date - std::chrono::system_clock::now()),
+                  std::chrono::milliseconds::zero());
+}
+
+std::chrono::milliseconds HostThrottle::Reserve(
+    const RateLimitSettings& settings, Clock::time_point now) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (now >= throttled_until_) {
+    return std::chrono::milliseconds::zero();
+  }
+
+  const auto interval = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(
+          1.0 / std::max(settings.requests_per_second, 1e-3)));
+  const auto tolerance =
+      interval * static_cast<int64_t>(std::max<size_t>(settings.burst, 1u) - 1);
+
+  const auto send_time =
+      std::max({now, next_send_time_ - tolerance, blocked_until_});
+  next_send_time_ = std::max(next_send_time_, send_time) + interval;
+
+  // Round up, so the request is never sent before its time.
+  const auto wait = send_time - now;
+  const auto wait_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(wait);
+  return wait_ms < wait ? wait_ms + std::chrono::milliseconds(1) : wait_ms;
+}
+
+void HostThrottle::OnRejected(
+    porting::optional<std::chrono::milliseconds> retry_after,
+    const RateLimitSettings& settings, Clock::time_point now) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  throttled_until_ = std::max(throttled_until_, now + settings.throttle_period);
+  if (retry_after) {
+    blocked_until_ = std::max(blocked_until_, now + *retry_after);
+  }
+}
+
+void HostThrottle::OnRequest(const RetryBudgetSettings& settings) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  InitializeBudgetUnsafe(settings);
+  budget_ = std::min(budget_ + settings.budget_ratio, settings.max_budget);
+}
+
+bool HostThrottle::TryRetry(const RetryBudgetSettings& settings) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  InitializeBudgetUnsafe(settings);
+  if (budget_ < 1.0) {
+    return false;
+  }
+  budget_ -= 1.0;
+  return true;
+}
+
+void HostThrottle::InitializeBudgetUnsafe(const RetryBudgetSettings& settings) {
+  if (!budget_initialized_) {
+    budget_ = settings.max_budget;
+    budget_initialized_ = true;
+  }
+}
+
+}  // namespace client
+}  // namespace olp
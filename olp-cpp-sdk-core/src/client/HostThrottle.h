@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "olp/core/client/HttpResponse.h"
+#include "olp/core/client/RateLimitSettings.h"
+#include "olp/core/client/RetryBudgetSettings.h"
+#include "olp/core/porting/optional.h"
+
+namespace olp {
+namespace client {
+
+/**
+ * @brief The rate limiting and retry budget state of a host.
+ *
+ * The state is shared by all the `OlpClient` instances in the process. The
+ * rate limiting uses the generic cell rate algorithm, which is equivalent to a
+ * token bucket but lets every request reserve its send time up front.
+ */
+class HostThrottle final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Gets the state of the host of the URL.
+  static std::shared_ptr<HostThrottle> Get(const std::string& url);
+
+  /**
+   * @brief Gets the delay requested by the `Retry-After` header.
+   *
+   * Only the HTTP 429 and 503 responses are considered. Both the delay in
+   * seconds and the HTTP date formats are supported.
+   */
+  static porting::optional<std::chrono::milliseconds> GetRetryAfter(
+      const HttpResponse& response);
+
+  /**
+   * @brief Reserves the time to send a request.
+   *
+   * @return The time to wait before the request is sent, zero if the host is
+   * not rate limited.
+   */
+  std::chrono::milliseconds Reserve(const RateLimitSettings& settings,
+                                    Clock::time_point now = Clock::now());
+
+  /// Starts or extends the rate limiting after a rejected request.
+  void OnRejected(porting::optional<std::chrono::milliseconds> retry_after,
+                  const RateLimitSettings& settings,
+                  Clock::time_point now = Clock::now());
+
+  /// Adds the retry budget earned by a request.
+  void OnRequest(const RetryBudgetSettings& settings);
+
+  /// Spends the budget of a single retry. Returns false if there is none.
+  bool TryRetry(const RetryBudgetSettings& settings);
+
+ private:
+  /// Must be called under the `mutex_`.
+  void InitializeBudgetUnsafe(const RetryBudgetSettings& settings);
+
+  std::mutex mutex_;
+  Clock::time_point throttled_until_;
+  Clock::time_point blocked_until_;
+  Clock::time_point next_send_time_;
+  double budget_{0.0};
+  bool budget_initialized_{false};
+};
+
+}  // namespace client
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,24 +19,36 @@
 
 #include "olp/core/client/OlpClient.h"
 
+#include <atomic>
 #include <cctype>
 #include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <future>
 #ifdef OLP_SDK_NETWORK_IOS_BACKGROUND_DOWNLOAD
 #include <list>
 #endif  // OLP_SDK_NETWORK_IOS_BACKGROUND_DOWNLOAD
+#include <mutex>
 #include <sstream>
 #include <thread>
+#include <vector>
 
+#include "HostThrottle.h"
 #include "PendingUrlRequests.h"
+#include "RequestHedger.h"
 #include "olp/core/client/Condition.h"
 #include "olp/core/client/ErrorCode.h"
+#include "olp/core/http/BufferChain.h"
 #include "olp/core/http/HttpStatusCode.h"
 #include "olp/core/http/NetworkConstants.h"
+#include "olp/core/http/NetworkUtils.h"
 #include "olp/core/logging/Log.h"
 #include "olp/core/porting/shared_mutex.h"
 #include "olp/core/thread/Atomic.h"
+#include "olp/core/thread/ScopedBlockingRegion.h"
+#include "olp/core/thread/TaskScheduler.h"
 #include "olp/core/utils/Url.h"
+#include "olp/core/utils/WarningWorkarounds.h"
 
 #ifdef OLP_SDK_NETWORK_IOS_BACKGROUND_DOWNLOAD
 #include "context/ContextInternal.h"
@@ -48,6 +60,8 @@ constexpr auto kLogTag = "OlpClient";
 constexpr auto kApiKeyParam = "apiKey=";
 constexpr auto kHttpPrefix = "http://";
 constexpr auto kHttpsPrefix = "https://";
+// Upper limit for the body preallocation based on the Content-Length header.
+constexpr size_t kMaxPreallocatedBodySize = 64u * 1024u * 1024u;
 
 struct RequestSettings {
   explicit RequestSettings(const int initial_backdown_period_ms,
@@ -173,6 +187,21 @@ bool StatusSuccess(int status) {
   return status >= 0 && status < http::HttpStatusCode::BAD_REQUEST;
 }
 
+void ReserveResponseBody(const std::string& key, const std::string& value,
+                         http::BufferChain& body) {
+  if (!http::NetworkUtils::CaseInsensitiveCompare(key,
+                                                  http::kContentLengthHeader)) {
+    return;
+  }
+
+  char* end = nullptr;
+  const auto length = std::strtoull(value.c_str(), &end, 10);
+  if (end != value.c_str() && length > 0 &&
+      length <= kMaxPreallocatedBodySize) {
+    body.Reserve(static_cast<size_t>(length));
+  }
+}
+
 bool CaseInsensitiveCompare(const std::string& str1, const std::string& str2) {
   return (str1.size() == str2.size()) &&
          std::equal(str1.begin(), str1.end(), str2.begin(),
@@ -204,29 +233,316 @@ std::chrono::milliseconds CalculateNextWaitTime(const RetrySettings& settings,
              : std::chrono::milliseconds::zero();
 }
 
-void ExecuteSingleRequest(const std::shared_ptr<http::Network>& network,
-                          const PendingUrlRequestPtr& pending_request,
-                          const http::NetworkRequest& request,
-                          const NetworkCallbackType& callback) {
-  auto response_body = std::make_shared<std::stringstream>();
+std::shared_ptr<HostThrottle> GetHostThrottle(const RetrySettings& settings,
+                                              const std::string& url) {
+  if (!settings.rate_limit_settings && !settings.retry_budget_settings) {
+    return nullptr;
+  }
+
+  auto throttle = HostThrottle::Get(url);
+  if (settings.retry_budget_settings) {
+    throttle->OnRequest(*settings.retry_budget_settings);
+  }
+  return throttle;
+}
+
+// Returns the time to wait before a request is sent to a rate limited host.
+std::chrono::milliseconds ReserveSendTime(
+    const std::shared_ptr<HostThrottle>& throttle,
+    const RetrySettings& settings) {
+  return throttle && settings.rate_limit_settings
+             ? throttle->Reserve(*settings.rate_limit_settings)
+             : std::chrono::milliseconds::zero();
+}
+
+void OnResponse(const std::shared_ptr<HostThrottle>& throttle,
+                const RetrySettings& settings, const HttpResponse& response) {
+  const auto status = response.GetStatus();
+  if (throttle && settings.rate_limit_settings &&
+      (status == http::HttpStatusCode::TOO_MANY_REQUESTS ||
+       status == http::HttpStatusCode::SERVICE_UNAVAILABLE)) {
+    throttle->OnRejected(HostThrottle::GetRetryAfter(response),
+                         *settings.rate_limit_settings);
+  }
+}
+
+bool SpendRetryBudget(const std::shared_ptr<HostThrottle>& throttle,
+                      const RetrySettings& settings) {
+  return !throttle || !settings.retry_budget_settings ||
+         throttle->TryRetry(*settings.retry_budget_settings);
+}
+
+// Checks the conditions that only apply to the retries, after the retry
+// condition of the settings passed.
+bool CanRetry(const std::shared_ptr<HostThrottle>& throttle,
+              const RetrySettings& settings,
+              porting::optional<std::chrono::milliseconds> retry_after,
+              std::chrono::milliseconds remaining_wait_time,
+              const std::string& url) {
+  if (retry_after && *retry_after > remaining_wait_time) {
+    OLP_SDK_LOG_DEBUG_F(kLogTag,
+                        "Retry-After exceeds the timeout, retry_after=%lld, "
+                        "url='%s'",
+                        static_cast<long long>(retry_after->count()),
+                        url.c_str());
+    return false;
+  }
+
+  if (!SpendRetryBudget(throttle, settings)) {
+    OLP_SDK_LOG_WARNING_F(kLogTag, "Retry budget exhausted, url='%s'",
+                          url.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+bool CanHedge(const http::NetworkRequest& request) {
+#ifdef OLP_SDK_NETWORK_IOS_BACKGROUND_DOWNLOAD
+  OLP_SDK_CORE_UNUSED(request);
+  return false;
+#else
+  // Only the idempotent requests are hedged.
+  const auto& body = request.GetBody();
+  return request.GetVerb() == http::NetworkRequest::HttpVerb::GET &&
+         (!body || body->empty()) && !request.GetBodyStream();
+#endif  // OLP_SDK_NETWORK_IOS_BACKGROUND_DOWNLOAD
+}
+
+HttpResponse MakeAsyncResponse(const http::NetworkResponse& response,
+                               http::BufferChain& body,
+                               http::Headers& headers) {
+  const auto status = response.GetStatus();
+  if (!StatusSuccess(status)) {
+    const std::string error =
+        response.GetError().empty()
+            ? "Error occurred, please check HTTP status code"
+            : response.GetError();
+    body.Clear();
+    body.Append(reinterpret_cast<const std::uint8_t*>(error.data()),
+                error.size());
+  }
+
+  return {status, std::move(body), std::move(headers)};
+}
+
+// Sends a duplicate of the request when the first byte does not arrive within
+// the hedging delay. The delay is measured with the task scheduler, so no
+// thread waits for it. A response that would be retried does not win while the
+// other attempt is still in flight, as that attempt may still succeed.
+void ExecuteHedgedRequest(
+    const std::shared_ptr<http::Network>& network,
+    const PendingUrlRequestPtr& pending_request,
+    const http::NetworkRequest& request, const NetworkCallbackType& callback,
+    const RetrySettings& retry_settings,
+    const std::shared_ptr<RequestHedger>& hedger,
+    const std::shared_ptr<thread::TaskScheduler>& scheduler) {
+  struct Attempt {
+    std::shared_ptr<http::BufferChainOutputStream> body =
+        std::make_shared<http::BufferChainOutputStream>();
+    http::Headers headers;
+    http::RequestId id{PendingUrlRequest::kInvalidRequestId};
+    std::chrono::steady_clock::time_point send_time{};
+    bool done{false};
+  };
+
+  struct HedgeState {
+    std::mutex mutex;
+    Attempt attempts[2];
+    CancellationToken timer;
+    int winner{-1};
+    bool first_byte_received{false};
+    bool cancelled{false};
+  };
+
+  auto state = std::make_shared<HedgeState>();
+  const auto retry_condition = retry_settings.retry_condition;
+
+  // Cancels the timer and the attempts other than `except`.
+  auto cancel_others = [state, network](int except) {
+    std::vector<http::RequestId> ids;
+    CancellationToken timer;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      timer = std::move(state->timer);
+      for (int i = 0; i < 2; ++i) {
+        const auto& attempt = state->attempts[i];
+        if (i != except && !attempt.done &&
+            attempt.id != PendingUrlRequest::kInvalidRequestId) {
+          ids.push_back(attempt.id);
+        }
+      }
+    }
+
+    timer.Cancel();
+    for (const auto id : ids) {
+      network->Cancel(id);
+    }
+  };
+
+  auto send_attempt = [=](int index) {
+    auto body = state->attempts[index].body;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->attempts[index].send_time = std::chrono::steady_clock::now();
+    }
+
+    return network->Send(
+        request, body,
+        [=](const http::NetworkResponse& response) {
+          http::Headers headers;
+          {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            headers = std::move(state->attempts[index].headers);
+          }
+
+          auto http_response =
+              MakeAsyncResponse(response, body->GetBuffer(), headers);
+          const bool retryable =
+              retry_condition && retry_condition(http_response);
+
+          http::RequestId id = response.GetRequestId();
+          {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->attempts[index].done = true;
+            if (state->winner >= 0) {
+              return;
+            }
+
+            const auto& other = state->attempts[1 - index];
+            const bool other_in_flight =
+                other.id != PendingUrlRequest::kInvalidRequestId &&
+                !other.done;
+            if (retryable && other_in_flight && !state->cancelled) {
+              return;
+            }
+
+            state->winner = index;
+            // The pending request knows only the ID of the first attempt.
+            if (index > 0) {
+              id = state->attempts[0].id;
+            }
+          }
+          cancel_others(index);
+
+          callback(id, std::move(http_response));
+        },
+        [=](std::string key, std::string value) {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          auto& attempt = state->attempts[index];
+          if (attempt.headers.empty()) {
+            hedger->RecordFirstByte(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - attempt.send_time));
+          }
+          state->first_byte_received = true;
+          ReserveResponseBody(key, value, body->GetBuffer());
+          attempt.headers.emplace_back(std::move(key), std::move(value));
+        });
+  };
+
+  auto hedge = [=]() {
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (state->winner >= 0 || state->first_byte_received) {
+        return;
+      }
+    }
+
+    if (pending_request->IsCancelled() || !hedger->TryHedge()) {
+      return;
+    }
+
+    OLP_SDK_LOG_DEBUG_F(kLogTag, "Hedging request, url='%s'",
+                        request.GetUrl().c_str());
+    const auto outcome = send_attempt(1);
+    if (!outcome.IsSuccessful()) {
+      return;
+    }
+
+    bool finished = false;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      auto& attempt = state->attempts[1];
+      if (!attempt.done) {
+        attempt.id = outcome.GetRequestId();
+      }
+      finished = state->winner == 0 ||
+                 (state->winner < 0 && pending_request->IsCancelled());
+    }
+
+    if (finished) {
+      network->Cancel(outcome.GetRequestId());
+    }
+  };
+
+  auto make_request = [&](http::RequestId& id) {
+    hedger->OnRequest();
+    const auto send_outcome = send_attempt(0);
+    if (!send_outcome.IsSuccessful()) {
+      callback(PendingUrlRequest::kInvalidRequestId,
+               ToHttpResponse(send_outcome));
+      return CancellationToken();
+    }
+
+    id = send_outcome.GetRequestId();
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->attempts[0].id = id;
+      if (state->winner < 0) {
+        state->timer = scheduler->ScheduleAfter(hedge, hedger->GetDelay(),
+                                                thread::HIGH);
+      }
+    }
+
+    return CancellationToken([=] {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->cancelled = true;
+      }
+      cancel_others(-1);
+    });
+  };
+
+  auto cancelled_func = [&]() {
+    OLP_SDK_LOG_DEBUG_F(kLogTag,
+                        "ExecuteSingleRequest - already cancelled, url='%s'",
+                        request.GetUrl().c_str());
+    callback(PendingUrlRequest::kInvalidRequestId,
+             ToHttpResponse(kCancelledErrorResponse));
+  };
+
+  pending_request->ExecuteOrCancelled(make_request, cancelled_func);
+}
+
+void ExecuteSingleRequest(
+    const std::shared_ptr<http::Network>& network,
+    const PendingUrlRequestPtr& pending_request,
+    const http::NetworkRequest& request, const NetworkCallbackType& callback,
+    const RetrySettings& retry_settings,
+    const std::shared_ptr<RequestHedger>& hedger,
+    const std::weak_ptr<thread::TaskScheduler>& task_scheduler) {
+  if (hedger && CanHedge(request)) {
+    if (auto scheduler = task_scheduler.lock()) {
+      ExecuteHedgedRequest(network, pending_request, request, callback,
+                           retry_settings, hedger, scheduler);
+      return;
+    }
+  }
+
+  auto response_body = std::make_shared<http::BufferChainOutputStream>();
   auto headers = std::make_shared<http::Headers>();
 
   auto make_request = [&](http::RequestId& id) {
     auto send_outcome = network->Send(
         request, response_body,
         [=](const http::NetworkResponse& response) {
-          auto status = response.GetStatus();
-          if (!StatusSuccess(status)) {
-            response_body->str(
-                response.GetError().empty()
-                    ? "Error occurred, please check HTTP status code"
-                    : response.GetError());
-          }
-
           callback(response.GetRequestId(),
-                   {status, std::move(*response_body), std::move(*headers)});
+                   MakeAsyncResponse(response, response_body->GetBuffer(),
+                                     *headers));
         },
         [=](std::string key, std::string value) {
+          ReserveResponseBody(key, value, response_body->GetBuffer());
           headers->emplace_back(std::move(key), std::move(value));
         });
 
@@ -257,12 +573,19 @@ NetworkCallbackType GetRetryCallback(
     const std::shared_ptr<http::Network>& network,
     const PendingUrlRequestsPtr& pending_requests,
     const PendingUrlRequestPtr& pending_request,
-    const NetworkRequestPtr& request) {
+    const NetworkRequestPtr& request,
+    const std::shared_ptr<HostThrottle>& throttle,
+    const std::shared_ptr<RequestHedger>& hedger,
+    const std::weak_ptr<thread::TaskScheduler>& task_scheduler) {
   return [=](const http::RequestId request_id, HttpResponse response) mutable {
     ++settings->current_try;
+    OnResponse(throttle, retry_settings, response);
 
-    if (CheckRetryCondition(*settings, retry_settings, response)) {
-      // Response is either successull or retries count/time expired
+    const auto retry_after = HostThrottle::GetRetryAfter(response);
+    const auto remaining_wait_time =
+        settings->max_wait_time - settings->accumulated_wait_time;
+
+    auto complete = [&]() {
       if (pending_request->GetRequestId() != request_id) {
         OLP_SDK_LOG_WARNING_F(
             kLogTag,
@@ -279,22 +602,58 @@ NetworkCallbackType GetRetryCallback(
       } else {
         pending_request->OnRequestCompleted(std::move(response));
       }
+    };
+
+    if (CheckRetryCondition(*settings, retry_settings, response) ||
+        !CanRetry(throttle, retry_settings, retry_after, remaining_wait_time,
+                  request->GetUrl())) {
+      // Response is either successull or retries count/time expired
+      complete();
       return;
     }
 
-    const auto start = std::chrono::steady_clock::now();
-
-    // TODO: Do not block thread but instead implement an event queue that will
-    // trigger next retry once the time expired!
-    const auto actual_wait_time =
-        std::min(settings->current_backdown_period,
-                 settings->max_wait_time - settings->accumulated_wait_time);
-    std::this_thread::sleep_for(actual_wait_time);
+    // The send time is reserved right away and the retry waits for both the
+    // backdown and the rate limited host; both count against the timeout.
+    const auto actual_wait_time = std::max(
+        std::min(std::max(settings->current_backdown_period,
+                          retry_after.value_or(std::chrono::milliseconds(0))),
+                 remaining_wait_time),
+        ReserveSendTime(throttle, retry_settings));
+    if (actual_wait_time > remaining_wait_time) {
+      OLP_SDK_LOG_DEBUG_F(kLogTag,
+                          "Host is rate limited beyond the timeout, url='%s'",
+                          request->GetUrl().c_str());
+      complete();
+      return;
+    }
 
     settings->accumulated_wait_time += actual_wait_time;
     settings->current_backdown_period =
         CalculateNextWaitTime(retry_settings, settings->current_try);
 
+    auto retry = [=]() {
+      ExecuteSingleRequest(
+          network, pending_request, *request,
+          GetRetryCallback(merge, settings, retry_settings, network,
+                           pending_requests, pending_request, request,
+                           throttle, hedger, task_scheduler),
+          retry_settings, hedger, task_scheduler);
+    };
+
+    // The scheduler is not owned here, as the last reference released on its
+    // own thread would join that thread.
+    if (auto scheduler = task_scheduler.lock()) {
+      OLP_SDK_LOG_DEBUG(kLogTag, "retry_callback - retrigger after delay="
+                                     << actual_wait_time.count() << "ms");
+      // The retry belongs to a request that is already in flight.
+      scheduler->ScheduleAfter(std::move(retry), actual_wait_time,
+                               thread::HIGH);
+      return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(actual_wait_time);
+
     OLP_SDK_LOG_DEBUG(
         kLogTag, "retry_callback - retrigger after sleep, actual_wait_time="
                      << actual_wait_time.count() << "ms, slept="
@@ -303,10 +662,7 @@ NetworkCallbackType GetRetryCallback(
                             .count()
                      << "ms");
 
-    ExecuteSingleRequest(
-        network, pending_request, *request,
-        GetRetryCallback(merge, settings, retry_settings, network,
-                         pending_requests, pending_request, request));
+    retry();
   };
 }
 
@@ -330,11 +686,232 @@ http::NetworkRequest::HttpVerb GetHttpVerb(const std::string& verb) {
   return http::NetworkRequest::HttpVerb::GET;
 }
 
+// Sends a duplicate of the request when the first byte does not arrive within
+// the hedging delay. A response that would be retried does not win while the
+// other attempt is still in flight, as that attempt may still succeed.
+HttpResponse SendHedgedRequest(const http::NetworkRequest& request,
+                               const olp::client::OlpClientSettings& settings,
+                               const olp::client::RetrySettings& retry_settings,
+                               std::shared_ptr<RequestHedger> hedger,
+                               client::CancellationContext context) {
+  struct Attempt {
+    std::shared_ptr<http::BufferChainOutputStream> body =
+        std::make_shared<http::BufferChainOutputStream>();
+    http::Headers headers;
+    http::RequestId id{PendingUrlRequest::kInvalidRequestId};
+    std::chrono::steady_clock::time_point send_time{};
+    bool done{false};
+  };
+
+  struct HedgeState {
+    std::mutex mutex;
+    std::condition_variable condition;
+    Attempt attempts[2];
+    int winner{-1};
+    bool first_byte_received{false};
+    bool cancelled{false};
+    HttpResponse response;
+  };
+
+  auto state = std::make_shared<HedgeState>();
+  auto network = settings.network_request_handler;
+  const auto retry_condition = retry_settings.retry_condition;
+
+  auto cancel_attempts = [state, network](int except) {
+    std::vector<http::RequestId> ids;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      for (int i = 0; i < 2; ++i) {
+        const auto& attempt = state->attempts[i];
+        if (i != except && !attempt.done &&
+            attempt.id != PendingUrlRequest::kInvalidRequestId) {
+          ids.push_back(attempt.id);
+        }
+      }
+    }
+
+    for (const auto id : ids) {
+      network->Cancel(id);
+    }
+  };
+
+  auto send_attempt = [&](int index) {
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->attempts[index].send_time = std::chrono::steady_clock::now();
+    }
+
+    auto body = state->attempts[index].body;
+    auto outcome = network->Send(
+        request, body,
+        [=](const http::NetworkResponse& response) {
+          http::Headers headers;
+          {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            headers = std::move(state->attempts[index].headers);
+          }
+
+          const auto status = response.GetStatus();
+          HttpResponse http_response =
+              status < 0 ? HttpResponse{status, response.GetError()}
+                         : HttpResponse{status, std::move(body->GetBuffer()),
+                                        std::move(headers)};
+          http_response.SetNetworkStatistics(GetStatistics(response));
+          const bool retryable =
+              retry_condition && retry_condition(http_response);
+
+          {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->attempts[index].done = true;
+            if (state->winner >= 0) {
+              return;
+            }
+
+            const auto& other = state->attempts[1 - index];
+            const bool other_in_flight =
+                other.id != PendingUrlRequest::kInvalidRequestId &&
+                !other.done;
+            if (retryable && other_in_flight && !state->cancelled) {
+              return;
+            }
+
+            state->winner = index;
+            state->response = std::move(http_response);
+          }
+          state->condition.notify_all();
+          cancel_attempts(index);
+        },
+        [=](std::string key, std::string value) {
+          std::unique_lock<std::mutex> lock(state->mutex);
+          auto& attempt = state->attempts[index];
+          if (attempt.headers.empty()) {
+            hedger->RecordFirstByte(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - attempt.send_time));
+          }
+          ReserveResponseBody(key, value, body->GetBuffer());
+          attempt.headers.emplace_back(std::move(key), std::move(value));
+
+          if (!state->first_byte_received) {
+            state->first_byte_received = true;
+            lock.unlock();
+            state->condition.notify_all();
+          }
+        });
+
+    if (!outcome.IsSuccessful()) {
+      return outcome;
+    }
+
+    bool finished = false;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      auto& attempt = state->attempts[index];
+      if (!attempt.done) {
+        attempt.id = outcome.GetRequestId();
+      }
+      finished = state->cancelled ||
+                 (state->winner >= 0 && state->winner != index);
+    }
+
+    if (finished) {
+      network->Cancel(outcome.GetRequestId());
+    }
+    return outcome;
+  };
+
+  http::SendOutcome outcome{http::ErrorCode::CANCELLED_ERROR};
+  const auto start = std::chrono::steady_clock::now();
+  const auto timeout = std::chrono::seconds(retry_settings.timeout);
+  hedger->OnRequest();
+
+  context.ExecuteOrCancelled(
+      [&]() {
+        outcome = send_attempt(0);
+        if (!outcome.IsSuccessful()) {
+          OLP_SDK_LOG_WARNING_F(kLogTag,
+                                "SendRequest: sending request failed, url=%s",
+                                request.GetUrl().c_str());
+          return CancellationToken();
+        }
+
+        return CancellationToken([=]() {
+          {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->cancelled = true;
+          }
+          state->condition.notify_all();
+          cancel_attempts(-1);
+        });
+      },
+      [&]() {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->cancelled = true;
+      });
+
+  if (!outcome.IsSuccessful()) {
+    return ToHttpResponse(outcome);
+  }
+
+  // The pool may start another thread while this one waits for the response.
+  thread::ScopedBlockingRegion blocking_region;
+  std::unique_lock<std::mutex> lock(state->mutex);
+  const bool responding = state->condition.wait_for(
+      lock, std::min<std::chrono::milliseconds>(hedger->GetDelay(), timeout),
+      [&] {
+        return state->first_byte_received || state->winner >= 0 ||
+               state->cancelled;
+      });
+
+  if (!responding) {
+    lock.unlock();
+    if (hedger->TryHedge() && !context.IsCancelled()) {
+      OLP_SDK_LOG_DEBUG_F(kLogTag, "Hedging request, url='%s'",
+                          request.GetUrl().c_str());
+      send_attempt(1);
+    }
+    lock.lock();
+  }
+
+  const auto condition_triggered =
+      state->condition.wait_until(lock, start + timeout, [&] {
+        return state->winner >= 0 || state->cancelled;
+      });
+  lock.unlock();
+
+  if (!condition_triggered) {
+    OLP_SDK_LOG_WARNING_F(
+        kLogTag,
+        "Request timed out, request_id=%" PRIu64
+        ", timeout=%i, retry_count=%i, url='%s'",
+        outcome.GetRequestId(), static_cast<int>(timeout.count()),
+        retry_settings.max_attempts, request.GetUrl().c_str());
+    context.CancelOperation();
+  }
+
+  lock.lock();
+  if (context.IsCancelled() || state->winner < 0) {
+    return ToHttpResponse(condition_triggered ? kCancelledErrorResponse
+                                              : kTimeoutErrorResponse);
+  }
+
+  return std::move(state->response);
+}
+
 HttpResponse SendRequest(const http::NetworkRequest& request,
                          const http::Network::DataCallback& data_callback,
                          const olp::client::OlpClientSettings& settings,
                          const olp::client::RetrySettings& retry_settings,
-                         client::CancellationContext context) {
+                         client::CancellationContext context,
+                         const std::shared_ptr<RequestHedger>& hedger =
+                             nullptr) {
+  // The streamed data cannot be taken back once passed on, so only the
+  // buffered responses are hedged.
+  if (hedger && !data_callback && CanHedge(request)) {
+    return SendHedgedRequest(request, settings, retry_settings, hedger,
+                             std::move(context));
+  }
+
   struct ResponseData {
     Condition condition;
     http::NetworkResponse response{kCancelledErrorResponse};
@@ -347,7 +924,8 @@ HttpResponse SendRequest(const http::NetworkRequest& request,
 
   // We dont need a response body in case we want a stream
   auto response_body =
-      data_callback ? nullptr : std::make_shared<std::stringstream>();
+      data_callback ? nullptr
+                    : std::make_shared<http::BufferChainOutputStream>();
 
   auto data_callback_proxy =
       !data_callback
@@ -375,7 +953,11 @@ HttpResponse SendRequest(const http::NetworkRequest& request,
               response_data->response = std::move(response);
               response_data->condition.Notify();
             },
-            [response_data](std::string key, std::string value) {
+            [response_data, response_body](std::string key,
+                                           std::string value) {
+              if (response_body) {
+                ReserveResponseBody(key, value, response_body->GetBuffer());
+              }
               response_data->headers.emplace_back(std::move(key),
                                                   std::move(value));
             },
@@ -402,13 +984,17 @@ HttpResponse SendRequest(const http::NetworkRequest& request,
     return ToHttpResponse(outcome);
   }
 
+  bool condition_triggered = false;
+  {
+    thread::ScopedBlockingRegion blocking_region;
 #ifdef OLP_SDK_NETWORK_IOS_BACKGROUND_DOWNLOAD
-  auto backgroundSubscriber = gBackgroundSubscriber;
-  const auto condition_triggered = backgroundSubscriber->Wait(
-      response_data->condition, {timeout, background_timeout});
+    auto backgroundSubscriber = gBackgroundSubscriber;
+    condition_triggered = backgroundSubscriber->Wait(
+        response_data->condition, {timeout, background_timeout});
 #else
-  const auto condition_triggered = response_data->condition.Wait(timeout);
+    condition_triggered = response_data->condition.Wait(timeout);
 #endif  // OLP_SDK_NETWORK_IOS_BACKGROUND_DOWNLOAD
+  }
 
   if (!condition_triggered) {
     OLP_SDK_LOG_WARNING_F(
@@ -435,7 +1021,7 @@ HttpResponse SendRequest(const http::NetworkRequest& request,
     if (status < 0) {
       return HttpResponse{status, response_data->response.GetError()};
     } else if (response_body) {
-      return HttpResponse{status, std::move(*response_body),
+      return HttpResponse{status, std::move(response_body->GetBuffer()),
                           std::move(response_data->headers)};
     } else {
       return HttpResponse{status, std::stringstream(),
@@ -448,10 +1034,20 @@ HttpResponse SendRequest(const http::NetworkRequest& request,
   return response;
 }
 
+// Sleeps periodically and checks for the cancellation status in between.
+void SleepFor(std::chrono::milliseconds duration,
+              const CancellationContext& context) {
+  thread::ScopedBlockingRegion blocking_region;
+  while (duration.count() > 0 && !context.IsCancelled()) {
+    const auto sleep_ms = std::min(std::chrono::milliseconds(1000), duration);
+    std::this_thread::sleep_for(sleep_ms);
+    duration -= sleep_ms;
+  }
+}
+
 bool IsPending(const PendingUrlRequestPtr& request) {
-  // A request is pending when it already triggered a Network call
-  return request &&
-         request->GetRequestId() != PendingUrlRequest::kInvalidRequestId;
+  // A request is pending when it already triggered or scheduled a Network call
+  return request && request->IsPending();
 }
 
 }  // namespace
@@ -481,7 +1077,11 @@ class OlpClient::OlpClientImpl {
                        ParametersType header_params,
                        http::Network::DataCallback data_callback,
                        RequestBodyType post_body, std::string content_type,
-                       CancellationContext context) const;
+                       CancellationContext context,
+                       http::NetworkRequest::RequestBodyStreamType body_stream =
+                           nullptr,
+                       porting::optional<std::uint64_t> body_stream_size =
+                           porting::none) const;
 
   std::shared_ptr<http::NetworkRequest> CreateRequest(
       const std::string& path, const std::string& method,
@@ -500,6 +1100,7 @@ class OlpClient::OlpClientImpl {
   ParametersType default_headers_;
   OlpClientSettings settings_;
   PendingUrlRequestsPtr pending_requests_;
+  std::shared_ptr<RequestHedger> hedger_;
 
   bool ValidateBaseUrl() const;
 };
@@ -511,7 +1112,12 @@ OlpClient::OlpClientImpl::OlpClientImpl(const OlpClientSettings& settings,
                                         std::string base_url)
     : base_url_{std::move(base_url)},
       settings_{settings},
-      pending_requests_{std::make_shared<PendingUrlRequests>()} {}
+      pending_requests_{std::make_shared<PendingUrlRequests>()} {
+  const auto& hedging_settings = settings_.retry_settings.hedging_settings;
+  if (hedging_settings) {
+    hedger_ = std::make_shared<RequestHedger>(*hedging_settings);
+  }
+}
 
 void OlpClient::OlpClientImpl::SetBaseUrl(const std::string& base_url) {
   base_url_.lockedAssign(base_url);
@@ -697,11 +1303,71 @@ CancellationToken OlpClient::OlpClientImpl::CallApi(
 
   auto network = settings_.network_request_handler;
   auto request_settings = GetRequestSettings(retry_settings);
+  auto throttle = GetHostThrottle(retry_settings, url);
+
+  auto hedger = hedger_;
+  std::weak_ptr<thread::TaskScheduler> task_scheduler =
+      settings_.task_scheduler;
+  auto send = [=]() {
+    ExecuteSingleRequest(
+        network, request_ptr, *network_request,
+        GetRetryCallback(merge, request_settings, retry_settings, network,
+                         pending_requests, request_ptr, network_request,
+                         throttle, hedger, task_scheduler),
+        retry_settings, hedger, task_scheduler);
+  };
+
+  const auto send_delay = ReserveSendTime(throttle, retry_settings);
+  if (send_delay == std::chrono::milliseconds::zero()) {
+    send();
+    return cancellation_token;
+  }
+
+  // The calling thread must not wait for the rate limited host, so without a
+  // task scheduler the request fails right away.
+  if (!settings_.task_scheduler ||
+      send_delay > request_settings->max_wait_time) {
+    OLP_SDK_LOG_WARNING_F(kLogTag, "Host is rate limited, delay=%lld, url='%s'",
+                          static_cast<long long>(send_delay.count()),
+                          url.c_str());
+    HttpResponse response(http::HttpStatusCode::TOO_MANY_REQUESTS,
+                          "Request throttled, the host is rate limited");
+    if (merge) {
+      pending_requests->OnRequestCompleted(PendingUrlRequest::kInvalidRequestId,
+                                           url, std::move(response));
+    } else {
+      request_ptr->OnRequestCompleted(std::move(response));
+    }
+    return cancellation_token;
+  }
+
+  request_settings->accumulated_wait_time += send_delay;
+
+  // The request is pending while it waits for the rate limited host, so that
+  // the merged callers attach to it. If it is cancelled meanwhile, it is sent
+  // right away and completes with the cancellation error. The send is
+  // scheduled, as the cancellation may be called with the requests locked.
+  auto sent = std::make_shared<std::atomic<bool>>(false);
+  auto send_once = [=]() {
+    if (!sent->exchange(true)) {
+      send();
+    }
+  };
 
-  ExecuteSingleRequest(
-      network, request_ptr, *network_request,
-      GetRetryCallback(merge, request_settings, retry_settings, network,
-                       pending_requests, request_ptr, network_request));
+  request_ptr->SetScheduled();
+  const auto scheduled = request_ptr->ExecuteOrCancelled([&](http::RequestId&) {
+    auto timer = settings_.task_scheduler->ScheduleAfter(send_once, send_delay);
+    return CancellationToken([=]() {
+      timer.Cancel();
+      if (auto scheduler = task_scheduler.lock()) {
+        scheduler->ScheduleTask(send_once, thread::HIGH);
+      }
+    });
+  });
+
+  if (!scheduled) {
+    send_once();
+  }
 
   return cancellation_token;
 }
@@ -712,7 +1378,9 @@ HttpResponse OlpClient::OlpClientImpl::CallApi(
     OlpClient::ParametersType header_params,
     http::Network::DataCallback data_callback,
     OlpClient::RequestBodyType post_body, std::string content_type,
-    CancellationContext context) const {
+    CancellationContext context,
+    http::NetworkRequest::RequestBodyStreamType body_stream,
+    porting::optional<std::uint64_t> body_stream_size) const {
   if (!settings_.network_request_handler) {
     return HttpResponse(static_cast<int>(olp::http::ErrorCode::OFFLINE_ERROR),
                         "Network request handler is empty.");
@@ -743,6 +1411,13 @@ HttpResponse OlpClient::OlpClientImpl::CallApi(
       .WithBody(std::move(post_body))
       .WithSettings(std::move(network_settings));
 
+  // The body stream is rewound to this position before each retry.
+  std::streampos body_stream_start{-1};
+  if (body_stream) {
+    body_stream_start = body_stream->tellg();
+    network_request.WithBodyStream(body_stream, body_stream_size);
+  }
+
   for (const auto& header : default_headers_) {
     network_request.WithHeader(header.first, header.second);
   }
@@ -782,16 +1457,41 @@ HttpResponse OlpClient::OlpClientImpl::CallApi(
     return {status, optional_error->GetMessage()};
   }
 
-  auto response = SendRequest(network_request, data_callback, settings_,
-                              retry_settings, context);
-
-  NetworkStatistics accumulated_statistics = response.GetNetworkStatistics();
-
   // Make sure that we don't wait longer than `timeout` in retry settings
-  auto accumulated_wait_time = backdown_period;
   const auto max_wait_time =
       std::chrono::duration_cast<std::chrono::milliseconds>(
           std::chrono::seconds(retry_settings.timeout));
+
+  const auto throttle =
+      GetHostThrottle(retry_settings, network_request.GetUrl());
+
+  auto accumulated_wait_time = backdown_period;
+
+  // The wait for the rate limited host counts against the timeout.
+  auto send_request = [&]() -> HttpResponse {
+    const auto send_delay = ReserveSendTime(throttle, retry_settings);
+    if (send_delay > max_wait_time - accumulated_wait_time) {
+      OLP_SDK_LOG_WARNING_F(kLogTag,
+                            "Host is rate limited, delay=%lld, url='%s'",
+                            static_cast<long long>(send_delay.count()),
+                            network_request.GetUrl().c_str());
+      return HttpResponse(http::HttpStatusCode::TOO_MANY_REQUESTS,
+                          "Request throttled, the host is rate limited");
+    }
+
+    accumulated_wait_time += send_delay;
+    SleepFor(send_delay, context);
+
+    auto response = SendRequest(network_request, data_callback, settings_,
+                                retry_settings, context, hedger_);
+    OnResponse(throttle, retry_settings, response);
+    return response;
+  };
+
+  auto response = send_request();
+
+  NetworkStatistics accumulated_statistics = response.GetNetworkStatistics();
+
   for (int i = 1; i <= retry_settings.max_attempts && !context.IsCancelled() &&
                   accumulated_wait_time < max_wait_time;
        i++) {
@@ -803,21 +1503,33 @@ HttpResponse OlpClient::OlpClientImpl::CallApi(
       return response;
     }
 
-    // do the periodical sleep and check for cancellation status in between.
-    auto duration_to_sleep =
-        std::min(backdown_period, max_wait_time - accumulated_wait_time);
-    accumulated_wait_time += duration_to_sleep;
+    const auto retry_after = HostThrottle::GetRetryAfter(response);
+    if (!CanRetry(throttle, retry_settings, retry_after,
+                  max_wait_time - accumulated_wait_time,
+                  network_request.GetUrl())) {
+      break;
+    }
 
-    while (duration_to_sleep.count() > 0 && !context.IsCancelled()) {
-      const auto sleep_ms =
-          std::min(std::chrono::milliseconds(1000), duration_to_sleep);
-      std::this_thread::sleep_for(sleep_ms);
-      duration_to_sleep -= sleep_ms;
+    if (body_stream) {
+      body_stream->clear();
+      if (body_stream_start == std::streampos(-1) ||
+          body_stream->seekg(body_stream_start).fail()) {
+        OLP_SDK_LOG_WARNING_F(kLogTag,
+                              "Unable to rewind the request body, url='%s'",
+                              network_request.GetUrl().c_str());
+        break;
+      }
     }
 
+    const auto duration_to_sleep =
+        std::min(std::max(backdown_period,
+                          retry_after.value_or(std::chrono::milliseconds(0))),
+                 max_wait_time - accumulated_wait_time);
+    accumulated_wait_time += duration_to_sleep;
+    SleepFor(duration_to_sleep, context);
+
     backdown_period = CalculateNextWaitTime(retry_settings, i);
-    response = SendRequest(network_request, data_callback, settings_,
-                           retry_settings, context);
+    response = send_request();
 
     // In case we retry, accumulate the stats
     accumulated_statistics += response.GetNetworkStatistics();
@@ -874,6 +1586,18 @@ HttpResponse OlpClient::CallApi(std::string path, std::string method,
                         std::move(context));
 }
 
+HttpResponse OlpClient::CallApiWithBodyStream(
+    std::string path, std::string method, ParametersType query_params,
+    ParametersType header_params,
+    http::NetworkRequest::RequestBodyStreamType body_stream,
+    porting::optional<std::uint64_t> body_size, std::string content_type,
+    CancellationContext context) const {
+  return impl_->CallApi(std::move(path), std::move(method),
+                        std::move(query_params), std::move(header_params),
+                        nullptr, nullptr, std::move(content_type),
+                        std::move(context), std::move(body_stream), body_size);
+}
+
 HttpResponse OlpClient::CallApiStream(std::string path, std::string method,
                                       ParametersType query_params,
                                       ParametersType header_params,
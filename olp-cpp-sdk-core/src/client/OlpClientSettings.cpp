@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/client/OlpClientSettings.h"
+
+#include <utility>
+
+#include "olp/core/thread/TaskScheduler.h"
+
+namespace olp {
+namespace client {
+
+OlpClientSettings ApplySchedulingGroup(OlpClientSettings settings) {
+  if (settings.scheduling_group) {
+    settings.task_scheduler = thread::CreateGroupTaskScheduler(
+        std::move(settings.task_scheduler), *settings.scheduling_group);
+    settings.scheduling_group = porting::none;
+  }
+  return settings;
+}
+
+}  // namespace client
+}  // namespace olp
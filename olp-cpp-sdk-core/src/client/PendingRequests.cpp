@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,9 @@
 
 #include "olp/core/client/PendingRequests.h"
 
+#include <utility>
+#include <vector>
+
 #include <olp/core/client/TaskContext.h>
 #include <olp/core/logging/Log.h>
 
@@ -29,14 +32,18 @@ namespace {
 constexpr auto kLogTag = "PendingRequests";
 }
 
+constexpr size_t PendingRequests::kShardCount;
+
 bool PendingRequests::CancelAll() {
-  ContextMap contexts;
-  {
-    std::lock_guard<std::mutex> lock(task_contexts_lock_);
-    contexts = task_contexts_;
+  std::vector<TaskContext> contexts;
+  contexts.reserve(GetTaskCount());
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    contexts.insert(contexts.end(), shard.task_contexts.begin(),
+                    shard.task_contexts.end());
   }
 
-  for (auto context : contexts) {
+  for (const auto& context : contexts) {
     context.CancelToken().Cancel();
   }
 
@@ -46,15 +53,17 @@ bool PendingRequests::CancelAll() {
 bool PendingRequests::CancelAllAndWait() {
   CancelAll();
 
-  ContextMap contexts;
-  {
-    std::lock_guard<std::mutex> lock(task_contexts_lock_);
-    contexts = std::move(task_contexts_);
+  std::vector<ContextMap> shard_contexts(kShardCount);
+  for (size_t i = 0u; i < kShardCount; ++i) {
+    std::lock_guard<std::mutex> lock(shards_[i].mutex);
+    std::swap(shard_contexts[i], shards_[i].task_contexts);
   }
 
-  for (auto context : contexts) {
-    if (!context.BlockingCancel()) {
-      OLP_SDK_LOG_WARNING(kLogTag, "Timeout, when waiting on BlockingCancel");
+  for (const auto& contexts : shard_contexts) {
+    for (auto context : contexts) {
+      if (!context.BlockingCancel()) {
+        OLP_SDK_LOG_WARNING(kLogTag, "Timeout, when waiting on BlockingCancel");
+      }
     }
   }
 
@@ -62,18 +71,32 @@ bool PendingRequests::CancelAllAndWait() {
 }
 
 void PendingRequests::Insert(TaskContext task_context) {
-  std::lock_guard<std::mutex> lock(task_contexts_lock_);
-  task_contexts_.insert(task_context);
+  auto& shard = GetShard(task_context);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.task_contexts.insert(std::move(task_context));
 }
 
 void PendingRequests::Remove(TaskContext task_context) {
-  std::lock_guard<std::mutex> lock(task_contexts_lock_);
-  task_contexts_.erase(task_context);
+  auto& shard = GetShard(task_context);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.task_contexts.erase(task_context);
 }
 
 size_t PendingRequests::GetTaskCount() const {
-  std::lock_guard<std::mutex> lock(task_contexts_lock_);
-  return task_contexts_.size();
+  size_t count = 0u;
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    count += shard.task_contexts.size();
+  }
+  return count;
+}
+
+PendingRequests::Shard& PendingRequests::GetShard(
+    const TaskContext& task_context) {
+  // The hash is the address of the implementation. The tasks allocated close
+  // to each other share a shard, which keeps the shard hot in the cache.
+  const auto hash = TaskContextHash()(task_context);
+  return shards_[(hash >> 16) % kShardCount];
 }
 
 }  // namespace client
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -115,6 +115,7 @@ void PendingUrlRequest::OnRequestCompleted(HttpResponse response) {
     // a new request to be triggered but it was cancelled by the user in the
     // meantime, so that ExecuteOrCancelled() will work properly.
     http_request_id_ = kInvalidRequestId;
+    scheduled_ = false;
   }
 
   OLP_SDK_LOG_DEBUG_F(
@@ -144,8 +145,11 @@ void PendingUrlRequest::OnRequestCompleted(HttpResponse response) {
 
       // We need to reset the stringstream position else the next copy
       // constructor will not be able to read anything because the read
-      // position is at the end of the stream.
-      response_out.GetRawResponse().seekg(0, std::ios::beg);
+      // position is at the end of the stream. Bodies kept in the buffer chain
+      // are shared between the copies and need no reset.
+      if (response_out.GetResponseBuffer().Empty()) {
+        response_out.GetRawResponse().seekg(0, std::ios::beg);
+      }
     }
 
     if (!cancelled_callbacks.empty() &&
@@ -158,8 +162,11 @@ void PendingUrlRequest::OnRequestCompleted(HttpResponse response) {
 
       // We need to reset the stringstream position else the next copy
       // constructor will not be able to read anything because the read
-      // position is at the end of the stream.
-      response_out.GetRawResponse().seekg(0, std::ios::beg);
+      // position is at the end of the stream. Bodies kept in the buffer chain
+      // are shared between the copies and need no reset.
+      if (response_out.GetResponseBuffer().Empty()) {
+        response_out.GetRawResponse().seekg(0, std::ios::beg);
+      }
     }
   }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -67,6 +67,19 @@ class PendingUrlRequest {
     return http_request_id_;
   }
 
+  /// Marks the request as pending while its Network request waits to be sent,
+  /// so that the requests to the same URL are merged into it.
+  void SetScheduled() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    scheduled_ = true;
+  }
+
+  /// Checks whether the Network request is triggered or scheduled.
+  bool IsPending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return http_request_id_ != kInvalidRequestId || scheduled_;
+  }
+
   /// Cancels the ongoing Network request. Do not block for long!
   /// NOTE: This should only be called if you know what you are doing.
   void CancelOperation() { context_.CancelOperation(); }
@@ -96,6 +109,8 @@ class PendingUrlRequest {
   /// The id of the Network request to identify the correct response to the
   /// correct request.
   http::RequestId http_request_id_{kInvalidRequestId};
+  /// The Network request waits to be sent, e.g. for a rate limited host.
+  bool scheduled_{false};
   /// Notifies once this request has been completed. Will be used by
   /// CancelAndWait().
   Condition condition_;
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "RequestHedger.h"
+
+#include <algorithm>
+
+namespace olp {
+namespace client {
+
+constexpr uint64_t RequestHedger::kWindowSize;
+
+RequestHedger::RequestHedger(HedgingSettings settings)
+    : settings_(std::move(settings)) {}
+
+std::chrono::milliseconds RequestHedger::GetDelay() const {
+  http::LatencyHistogram histogram;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    histogram = current_;
+    histogram.Merge(previous_);
+  }
+
+  if (histogram.GetCount() < settings_.min_samples) {
+    return std::max(settings_.initial_delay, settings_.min_delay);
+  }
+
+  const auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+      histogram.GetPercentile(settings_.delay_percentile));
+  return std::max(delay, settings_.min_delay);
+}
+
+void RequestHedger::RecordFirstByte(std::chrono::microseconds time) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (current_.GetCount() >= kWindowSize) {
+    previous_ = current_;
+    current_ = http::LatencyHistogram();
+  }
+  current_.Add(time);
+}
+
+void RequestHedger::OnRequest() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  budget_ = std::min(budget_ + settings_.budget_ratio, settings_.max_budget);
+}
+
+bool RequestHedger::TryHedge() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (budget_ < 1.0) {
+    return false;
+  }
+
+  budget_ -= 1.0;
+  return true;
+}
+
+}  // namespace client
+}  // namespace olp
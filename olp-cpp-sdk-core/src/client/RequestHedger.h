@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include "olp/core/client/HedgingSettings.h"
+#include "olp/core/http/LatencyHistogram.h"
+
+namespace olp {
+namespace client {
+
+/**
+ * @brief Tracks the time to first byte and the budget of hedged requests.
+ *
+ * The time to first byte is recorded in two histograms that are rotated, so
+ * the hedging delay follows the recent latencies.
+ */
+class RequestHedger final {
+ public:
+  explicit RequestHedger(HedgingSettings settings);
+
+  /// Gets the time to wait for the first byte before the request is hedged.
+  std::chrono::milliseconds GetDelay() const;
+
+  /// Records the time to first byte of a request.
+  void RecordFirstByte(std::chrono::microseconds time);
+
+  /// Adds the budget earned by a sent request.
+  void OnRequest();
+
+  /// Spends the budget of a single hedge. Returns false if there is none.
+  bool TryHedge();
+
+ private:
+  /// The number of samples after which the histograms are rotated.
+  static constexpr uint64_t kWindowSize = 1000u;
+
+  const HedgingSettings settings_;
+
+  mutable std::mutex mutex_;
+  http::LatencyHistogram current_;
+  http::LatencyHistogram previous_;
+  double budget_{0.0};
+};
+
+}  // namespace client
+}  // namespace olp
@@ -32,11 +32,11 @@ namespace parser {
 
 template <typename OutputResult,
           typename ParsingType = typename OutputResult::ResultType,
-          typename... AdditionalArgs>
-OutputResult parse_result(std::stringstream& json_stream,
+          typename JsonInput, typename... AdditionalArgs>
+OutputResult parse_result(JsonInput& json_input,
                           const AdditionalArgs&... args) {
   bool res = true;
-  auto obj = parse<ParsingType>(json_stream, res);
+  auto obj = parse<ParsingType>(json_input, res);
 
   if (res) {
     return OutputResult({std::move(obj), args...});
@@ -75,8 +75,8 @@ PlatformApi::ApisResponse PlatformApi::GetApis(
     return {{response.GetStatus(), response.GetResponseAsString()}};
   }
 
-  return parser::parse_result<ApisResponse, Apis>(response.GetRawResponse(),
-                                                  GetExpiry(response.GetHeaders()));
+  return parser::parse_result<ApisResponse, Apis>(
+      response, GetExpiry(response.GetHeaders()));
 }
 
 CancellationToken PlatformApi::GetApis(const OlpClient& client,
@@ -91,7 +91,7 @@ CancellationToken PlatformApi::GetApis(const OlpClient& client,
       callback({{response.GetStatus(), response.GetResponseAsString()}});
     } else {
       callback(parser::parse_result<ApisResponse, Apis>(
-          response.GetRawResponse(), GetExpiry(response.GetHeaders())));
+          response, GetExpiry(response.GetHeaders())));
     }
   };
 
@@ -75,8 +75,8 @@ ResourcesApi::ApisResponse ResourcesApi::GetApis(
     return {{response.GetStatus(), response.GetResponseAsString()}};
   }
 
-  return parser::parse_result<ApisResponse, Apis>(response.GetRawResponse(),
-                                                  GetExpiry(response.GetHeaders()));
+  return parser::parse_result<ApisResponse, Apis>(
+      response, GetExpiry(response.GetHeaders()));
 }
 
 CancellationToken ResourcesApi::GetApis(const OlpClient& client,
@@ -93,7 +93,7 @@ CancellationToken ResourcesApi::GetApis(const OlpClient& client,
       callback({{response.GetStatus(), response.GetResponseAsString()}});
     } else {
       callback(parser::parse_result<ApisResponse, Apis>(
-          response.GetRawResponse(), GetExpiry(response.GetHeaders())));
+          response, GetExpiry(response.GetHeaders())));
     }
   };
   return client.CallApi(resource_url, "GET", {}, header_params, {}, nullptr, "",
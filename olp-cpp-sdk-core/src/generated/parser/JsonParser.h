@@ -25,6 +25,9 @@
 #include <vector>
 
 #include <boost/json/parse.hpp>
+#include <boost/json/stream_parser.hpp>
+#include <olp/core/client/HttpResponse.h>
+#include <olp/core/http/BufferChain.h>
 
 #include "ParserWrapper.h"
 
@@ -61,6 +64,40 @@ inline T parse(std::stringstream& json_stream) {
   return parse<T>(json_stream, res);
 }
 
+template <typename T>
+inline T parse(const http::BufferChain& json_buffer, bool& res) {
+  res = false;
+  boost::json::error_code ec;
+  boost::json::stream_parser parser;
+  for (const auto& chunk : json_buffer.GetChunks()) {
+    parser.write(reinterpret_cast<const char*>(chunk->data()), chunk->size(),
+                 ec);
+    if (ec) {
+      return T{};
+    }
+  }
+
+  parser.finish(ec);
+  if (ec || !parser.done()) {
+    return T{};
+  }
+
+  auto value = parser.release();
+  T result{};
+  if (value.is_object() || value.is_array()) {
+    from_json(value, result);
+    res = true;
+  }
+  return result;
+}
+
+template <typename T>
+inline T parse(client::HttpResponse& response, bool& res) {
+  const auto& buffer = response.GetResponseBuffer();
+  return buffer.Empty() ? parse<T>(response.GetRawResponse(), res)
+                        : parse<T>(buffer, res);
+}
+
 template <typename T>
 inline T parse(const std::shared_ptr<std::vector<unsigned char>>& json_bytes) {
   boost::json::string_view json(reinterpret_cast<char*>(json_bytes->data()),
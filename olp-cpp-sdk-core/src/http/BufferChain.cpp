@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/http/BufferChain.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace olp {
+namespace http {
+
+constexpr std::size_t BufferChain::kDefaultChunkSize;
+
+BufferChain::BufferChain(ChunkPtr chunk) {
+  if (chunk && !chunk->empty()) {
+    size_ = chunk->size();
+    chunks_.push_back(std::move(chunk));
+  }
+}
+
+BufferChain::BufferChain(BufferChain&& other) noexcept
+    : chunks_(std::move(other.chunks_)),
+      size_(other.size_),
+      reserve_(other.reserve_) {
+  other.Clear();
+}
+
+BufferChain& BufferChain::operator=(BufferChain&& other) noexcept {
+  if (this != &other) {
+    chunks_ = std::move(other.chunks_);
+    size_ = other.size_;
+    reserve_ = other.reserve_;
+    other.Clear();
+  }
+  return *this;
+}
+
+void BufferChain::Reserve(std::size_t size) {
+  reserve_ = size > size_ ? size - size_ : 0u;
+  if (reserve_ == 0u) {
+    return;
+  }
+
+  if (chunks_.empty()) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->reserve(reserve_);
+    chunks_.push_back(std::move(chunk));
+  } else if (chunks_.back().use_count() == 1) {
+    auto& chunk = *chunks_.back();
+    chunk.reserve(chunk.size() + reserve_);
+  }
+}
+
+void BufferChain::Append(const std::uint8_t* data, std::size_t size) {
+  if (size == 0u) {
+    return;
+  }
+
+  // Never write into a chunk that is shared with another chain, as the data
+  // of the other chain would change.
+  if (chunks_.empty() || chunks_.back().use_count() != 1 ||
+      chunks_.back()->capacity() - chunks_.back()->size() < size) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->reserve(std::max({size, reserve_, kDefaultChunkSize}));
+    chunks_.push_back(std::move(chunk));
+  }
+
+  auto& chunk = *chunks_.back();
+  chunk.insert(chunk.end(), data, data + size);
+  size_ += size;
+  reserve_ = reserve_ > size ? reserve_ - size : 0u;
+}
+
+void BufferChain::Truncate(std::size_t size) {
+  while (size_ > size && !chunks_.empty()) {
+    const auto chunk_size = chunks_.back()->size();
+    const auto excess = size_ - size;
+    if (chunk_size <= excess) {
+      chunks_.pop_back();
+      size_ -= chunk_size;
+    } else if (chunks_.back().use_count() == 1) {
+      chunks_.back()->resize(chunk_size - excess);
+      size_ = size;
+    } else {
+      // The chunk is shared, so make a private copy of the remaining part.
+      const auto& shared_chunk = *chunks_.back();
+      chunks_.back() = std::make_shared<Chunk>(
+          shared_chunk.begin(), shared_chunk.begin() + (chunk_size - excess));
+      size_ = size;
+    }
+  }
+}
+
+void BufferChain::Clear() {
+  chunks_.clear();
+  size_ = 0u;
+  reserve_ = 0u;
+}
+
+void BufferChain::CopyTo(std::uint8_t* output) const {
+  for (const auto& chunk : chunks_) {
+    if (!chunk->empty()) {
+      std::memcpy(output, chunk->data(), chunk->size());
+      output += chunk->size();
+    }
+  }
+}
+
+std::string BufferChain::ToString() const {
+  std::string result;
+  result.reserve(size_);
+  for (const auto& chunk : chunks_) {
+    result.append(reinterpret_cast<const char*>(chunk->data()), chunk->size());
+  }
+  return result;
+}
+
+BufferChain::ChunkPtr BufferChain::Release() {
+  ChunkPtr result;
+  if (chunks_.size() == 1u && chunks_.front().use_count() == 1) {
+    result = std::move(chunks_.front());
+  } else {
+    result = std::make_shared<Chunk>(size_);
+    CopyTo(result->data());
+  }
+
+  Clear();
+  return result;
+}
+
+BufferChainOutputStream::BufferChainOutputStream() : std::ostream(nullptr) {
+  rdbuf(&stream_buffer_);
+}
+
+BufferChainOutputStream::~BufferChainOutputStream() = default;
+
+BufferChain& BufferChainOutputStream::GetBuffer() {
+  return stream_buffer_.GetBuffer();
+}
+
+std::streamsize BufferChainOutputStream::StreamBuffer::xsputn(
+    const char_type* s, std::streamsize count) {
+  if (count > 0) {
+    buffer_.Append(reinterpret_cast<const std::uint8_t*>(s),
+                   static_cast<std::size_t>(count));
+  }
+  return count;
+}
+
+BufferChainOutputStream::int_type
+BufferChainOutputStream::StreamBuffer::overflow(int_type ch) {
+  if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+    const auto byte = static_cast<std::uint8_t>(traits_type::to_char_type(ch));
+    buffer_.Append(&byte, 1u);
+  }
+  return traits_type::not_eof(ch);
+}
+
+BufferChainOutputStream::pos_type
+BufferChainOutputStream::StreamBuffer::seekoff(off_type off,
+                                               std::ios_base::seekdir dir,
+                                               std::ios_base::openmode which) {
+  if (!(which & std::ios_base::out)) {
+    return pos_type(off_type(-1));
+  }
+
+  off_type target = off;
+  if (dir == std::ios_base::cur || dir == std::ios_base::end) {
+    target += static_cast<off_type>(buffer_.Size());
+  }
+
+  return seekpos(pos_type(target), which);
+}
+
+BufferChainOutputStream::pos_type
+BufferChainOutputStream::StreamBuffer::seekpos(pos_type pos,
+                                               std::ios_base::openmode which) {
+  // The chain is append-only, so the write position always stays at the end.
+  // Seeking within the written data is accepted but does not discard it, as
+  // the network implementations and mocks rewind the payload after writing.
+  const auto target = static_cast<off_type>(pos);
+  if (!(which & std::ios_base::out) || target < 0 ||
+      target > static_cast<off_type>(buffer_.Size())) {
+    return pos_type(off_type(-1));
+  }
+
+  return pos;
+}
+
+}  // namespace http
+}  // namespace olp
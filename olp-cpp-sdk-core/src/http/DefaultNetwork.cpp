@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,8 @@
  */
 
 #include <algorithm>
+#include <iterator>
+#include <vector>
 
 #include "DefaultNetwork.h"
 #include "olp/core/http/HttpStatusCode.h"
@@ -26,6 +28,42 @@
 
 namespace olp {
 namespace http {
+
+namespace {
+void RecordLatencies(const Diagnostics& diagnostics,
+                     Network::LatencyHistograms& histograms) {
+  for (size_t i = 0u; i < histograms.size(); ++i) {
+    if (diagnostics.available_timings.test(i)) {
+      histograms[i].Add(diagnostics.timings[i]);
+    }
+  }
+}
+
+#ifndef OLP_SDK_NETWORK_HAS_CURL
+/// The platform network implementations send the body from memory only.
+void ReadBodyStream(NetworkRequest& request) {
+  auto stream = request.GetBodyStream();
+  if (!stream) {
+    return;
+  }
+
+  auto body = std::make_shared<std::vector<std::uint8_t>>();
+  const auto& size = request.GetBodyStreamSize();
+  if (size) {
+    body->resize(static_cast<size_t>(*size));
+    stream->read(reinterpret_cast<char*>(body->data()),
+                 static_cast<std::streamsize>(body->size()));
+    body->resize(static_cast<size_t>(stream->gcount()));
+  } else {
+    body->assign(std::istreambuf_iterator<char>(*stream),
+                 std::istreambuf_iterator<char>());
+  }
+
+  request.WithBody(std::move(body)).WithBodyStream(nullptr);
+}
+#endif
+}  // namespace
+
 DefaultNetwork::DefaultNetwork(std::shared_ptr<Network> network)
     : current_statistics_bucket_{0}, network_{std::move(network)} {}
 
@@ -43,7 +81,12 @@ SendOutcome DefaultNetwork::Send(NetworkRequest request, Payload payload,
     AppendDefaultHeaders(request_headers);
   }
 
+#ifndef OLP_SDK_NETWORK_HAS_CURL
+  ReadBodyStream(request);
+#endif
+
   const auto bucket_id = current_statistics_bucket_.load();
+  const auto host = NetworkUtils::ExtractHost(request.GetUrl());
 
   auto user_callback = [=](NetworkResponse response) {
     LockStatistics(bucket_id, [&](Statistics& stats) {
@@ -56,6 +99,11 @@ SendOutcome DefaultNetwork::Send(NetworkRequest request, Payload payload,
       stats.total_requests++;
       stats.bytes_downloaded += response.GetBytesDownloaded();
       stats.bytes_uploaded += response.GetBytesUploaded();
+
+      const auto& diagnostics = response.GetDiagnostics();
+      if (diagnostics) {
+        RecordLatencies(*diagnostics, stats.host_latencies[host]);
+      }
     });
 
     if (callback) {
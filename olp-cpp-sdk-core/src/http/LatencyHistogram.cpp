@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/http/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace olp {
+namespace http {
+
+namespace {
+/// The number of buckets per power of two.
+constexpr std::size_t kSubBucketBits = 2u;
+constexpr std::size_t kSubBucketCount = 1u << kSubBucketBits;
+}  // namespace
+
+constexpr std::size_t LatencyHistogram::kBucketCount;
+
+void LatencyHistogram::Add(MicroSeconds value) {
+  value = std::max(value, MicroSeconds::zero());
+  ++buckets_[GetBucketIndex(value)];
+  ++count_;
+  sum_ += value;
+  max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+  for (std::size_t i = 0u; i < kBucketCount; ++i) {
+    buckets_[i] += other.buckets_[i];
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+  max_ = std::max(max_, other.max_);
+}
+
+LatencyHistogram::MicroSeconds LatencyHistogram::GetPercentile(
+    double percentile) const {
+  if (count_ == 0u) {
+    return MicroSeconds::zero();
+  }
+
+  percentile = std::min(std::max(percentile, 0.0), 100.0);
+  const auto rank = std::max<std::uint64_t>(
+      1u, static_cast<std::uint64_t>(
+              std::ceil(percentile / 100.0 * static_cast<double>(count_))));
+
+  std::uint64_t accumulated = 0u;
+  for (std::size_t i = 0u; i + 1u < kBucketCount; ++i) {
+    accumulated += buckets_[i];
+    if (accumulated >= rank) {
+      // The upper bound of the bucket is the lower bound of the next one.
+      return std::min(GetBucketLowerBound(i + 1u) - MicroSeconds(1), max_);
+    }
+  }
+
+  return max_;
+}
+
+LatencyHistogram::MicroSeconds LatencyHistogram::GetBucketLowerBound(
+    std::size_t index) {
+  if (index < kSubBucketCount) {
+    return MicroSeconds(index);
+  }
+
+  const auto shift = index / kSubBucketCount - 1u;
+  const auto sub_bucket = index % kSubBucketCount;
+  return MicroSeconds(static_cast<MicroSeconds::rep>(
+      (kSubBucketCount + sub_bucket) << shift));
+}
+
+std::size_t LatencyHistogram::GetBucketIndex(MicroSeconds value) {
+  const auto count = static_cast<std::uint64_t>(std::max<MicroSeconds::rep>(
+      value.count(), 0));
+  if (count < kSubBucketCount) {
+    return static_cast<std::size_t>(count);
+  }
+
+  // The position of the most significant bit selects the power of two, the
+  // next bits select the bucket within it.
+  std::size_t msb = 0u;
+  for (auto bits = count; bits > 1u; bits >>= 1u) {
+    ++msb;
+  }
+
+  const auto shift = msb - kSubBucketBits;
+  const auto sub_bucket = (count >> shift) & (kSubBucketCount - 1u);
+  const auto index = (shift + 1u) * kSubBucketCount + sub_bucket;
+  return std::min<std::size_t>(static_cast<std::size_t>(index),
+                               kBucketCount - 1u);
+}
+
+}  // namespace http
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,7 +19,11 @@
 
 #include "olp/core/http/Network.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "http/DefaultNetwork.h"
+#include "http/ShardedNetwork.h"
 #include "olp/core/utils/WarningWorkarounds.h"
 
 #ifdef OLP_SDK_NETWORK_OFFLINE
@@ -44,7 +48,23 @@ std::shared_ptr<Network> CreateDefaultNetworkImpl(
 #ifdef OLP_SDK_NETWORK_OFFLINE
   return std::make_shared<NetworkOffline>();
 #elif OLP_SDK_NETWORK_HAS_CURL
-  return std::make_shared<NetworkCurl>(settings);
+  const auto worker_count = settings.worker_count;
+  if (worker_count <= 1u) {
+    return std::make_shared<NetworkCurl>(settings);
+  }
+
+  auto shard_settings = settings;
+  shard_settings.max_requests_count = std::max<size_t>(
+      1u, (settings.max_requests_count + worker_count - 1u) / worker_count);
+
+  std::vector<std::shared_ptr<Network>> shards;
+  shards.reserve(worker_count);
+  for (size_t i = 0u; i < worker_count; ++i) {
+    shards.push_back(std::make_shared<NetworkCurl>(shard_settings));
+  }
+
+  return std::make_shared<ShardedNetwork>(std::move(shards),
+                                          settings.sharding_policy);
 #elif OLP_SDK_NETWORK_HAS_ANDROID
   return std::make_shared<NetworkAndroid>(settings.max_requests_count);
 #elif OLP_SDK_NETWORK_HAS_IOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -35,6 +35,15 @@ NetworkRequest::RequestBodyType NetworkRequest::GetBody() const {
   return body_;
 }
 
+NetworkRequest::RequestBodyStreamType NetworkRequest::GetBodyStream() const {
+  return body_stream_;
+}
+
+const porting::optional<std::uint64_t>& NetworkRequest::GetBodyStreamSize()
+    const {
+  return body_stream_size_;
+}
+
 const NetworkSettings& NetworkRequest::GetSettings() const { return settings_; }
 
 NetworkRequest& NetworkRequest::WithHeader(std::string name,
@@ -58,6 +67,13 @@ NetworkRequest& NetworkRequest::WithBody(RequestBodyType body) {
   return *this;
 }
 
+NetworkRequest& NetworkRequest::WithBodyStream(
+    RequestBodyStreamType stream, porting::optional<std::uint64_t> size) {
+  body_stream_ = std::move(stream);
+  body_stream_size_ = size;
+  return *this;
+}
+
 NetworkRequest& NetworkRequest::WithSettings(NetworkSettings settings) {
   settings_ = std::move(settings);
   return *this;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -93,6 +93,22 @@ std::string NetworkUtils::ExtractUserAgent(Headers& headers) {
   return user_agent;
 }
 
+std::string NetworkUtils::ExtractHost(const std::string& url) {
+  auto begin = url.find("://");
+  begin = begin == std::string::npos ? 0u : begin + 3u;
+
+  // Skip the user information.
+  const auto end = url.find_first_of("/?#", begin);
+  const auto at = url.rfind('@', end);
+  if (at != std::string::npos && at >= begin) {
+    begin = at + 1u;
+  }
+
+  const auto host_end = url.find_first_of(":/?#", begin);
+  return url.substr(begin, host_end == std::string::npos ? std::string::npos
+                                                         : host_end - begin);
+}
+
 std::string HttpErrorToString(int http_status) {
   switch (http_status) {
     case 100:
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "ShardedNetwork.h"
+
+#include <functional>
+
+#include "olp/core/http/NetworkUtils.h"
+#include "olp/core/logging/Log.h"
+
+namespace olp {
+namespace http {
+
+namespace {
+constexpr auto kLogTag = "ShardedNetwork";
+}  // namespace
+
+ShardedNetwork::ShardedNetwork(std::vector<std::shared_ptr<Network>> shards,
+                               ShardingPolicy policy)
+    : policy_(policy), pending_(shards.size(), 0u), shards_(std::move(shards)) {
+  OLP_SDK_LOG_DEBUG_F(kLogTag, "Created with %zu shards", shards_.size());
+}
+
+ShardedNetwork::~ShardedNetwork() {
+  // The shards may still call the completion callbacks while stopping.
+  shards_.clear();
+}
+
+SendOutcome ShardedNetwork::Send(NetworkRequest request, Payload payload,
+                                 Callback callback,
+                                 HeaderCallback header_callback,
+                                 DataCallback data_callback) {
+  RequestId id = SendOutcome::kInvalidRequestId;
+  size_t shard = 0u;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    id = request_id_counter_;
+    if (request_id_counter_ ==
+        static_cast<RequestId>(RequestIdConstants::RequestIdMax)) {
+      request_id_counter_ =
+          static_cast<RequestId>(RequestIdConstants::RequestIdMin);
+    } else {
+      ++request_id_counter_;
+    }
+
+    shard = SelectShardUnsafe(request, id);
+    requests_[id].shard = shard;
+    ++pending_[shard];
+  }
+
+  auto shard_callback = [=](NetworkResponse response) {
+    FinishRequest(id, shard);
+
+    if (callback) {
+      callback(std::move(response.WithRequestId(id)));
+    }
+  };
+
+  const auto outcome = shards_[shard]->Send(
+      std::move(request), std::move(payload), std::move(shard_callback),
+      std::move(header_callback), std::move(data_callback));
+
+  if (!outcome.IsSuccessful()) {
+    // No callbacks are triggered on failure.
+    FinishRequest(id, shard);
+    return outcome;
+  }
+
+  bool cancelled = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = requests_.find(id);
+    if (it == requests_.end()) {
+      // The request is already finished.
+      return SendOutcome(id);
+    }
+
+    it->second.shard_request_id = outcome.GetRequestId();
+    cancelled = it->second.cancelled;
+  }
+
+  if (cancelled) {
+    shards_[shard]->Cancel(outcome.GetRequestId());
+  }
+
+  return SendOutcome(id);
+}
+
+void ShardedNetwork::Cancel(RequestId id) {
+  size_t shard = 0u;
+  RequestId shard_request_id = SendOutcome::kInvalidRequestId;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = requests_.find(id);
+    if (it == requests_.end()) {
+      return;
+    }
+
+    if (it->second.shard_request_id == SendOutcome::kInvalidRequestId) {
+      // The shard has not returned its ID yet, `Send` cancels the request.
+      it->second.cancelled = true;
+      return;
+    }
+
+    shard = it->second.shard;
+    shard_request_id = it->second.shard_request_id;
+  }
+
+  shards_[shard]->Cancel(shard_request_id);
+}
+
+size_t ShardedNetwork::SelectShardUnsafe(const NetworkRequest& request,
+                                         RequestId id) const {
+  const auto count = shards_.size();
+  if (count == 1u) {
+    return 0u;
+  }
+
+  if (policy_ == ShardingPolicy::kByHost) {
+    const auto host = NetworkUtils::ExtractHost(request.GetUrl());
+    return std::hash<std::string>{}(host) % count;
+  }
+
+  // Start from a rotating position, so the shards with equal load are used
+  // in turn.
+  auto selected = static_cast<size_t>(id % count);
+  for (size_t i = 1u; i < count; ++i) {
+    const auto shard = (static_cast<size_t>(id) + i) % count;
+    if (pending_[shard] < pending_[selected]) {
+      selected = shard;
+    }
+  }
+
+  return selected;
+}
+
+void ShardedNetwork::FinishRequest(RequestId id, size_t shard) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (requests_.erase(id) > 0u) {
+    --pending_[shard];
+  }
+}
+
+}  // namespace http
+}  // namespace olp
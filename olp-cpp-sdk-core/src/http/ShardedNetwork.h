@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <olp/core/http/Network.h>
+#include <olp/core/http/NetworkInitializationSettings.h>
+
+namespace olp {
+namespace http {
+
+/**
+ * @brief Distributes requests between several `Network` instances.
+ *
+ * Each shard is a complete network implementation with its own worker
+ * thread, so the transfers of different shards are processed in parallel.
+ * The shards are hidden behind a single `RequestId` space: the IDs returned
+ * by `Send` and passed to the callbacks are assigned by this class and are
+ * translated to the shard IDs on `Cancel`.
+ */
+class ShardedNetwork final : public Network {
+ public:
+  using ShardingPolicy = NetworkInitializationSettings::ShardingPolicy;
+
+  /**
+   * @brief Creates the `ShardedNetwork` instance.
+   *
+   * @param shards The networks that handle the requests. Must not be empty.
+   * @param policy The policy used to select a shard for a request.
+   */
+  ShardedNetwork(std::vector<std::shared_ptr<Network>> shards,
+                 ShardingPolicy policy);
+  ~ShardedNetwork() override;
+
+  /// Implements the `Send` method of the `Network` class.
+  SendOutcome Send(NetworkRequest request, Payload payload, Callback callback,
+                   HeaderCallback header_callback = nullptr,
+                   DataCallback data_callback = nullptr) override;
+
+  /// Implements the `Cancel` method of the `Network` class.
+  void Cancel(RequestId id) override;
+
+ private:
+  struct RequestState {
+    size_t shard{0u};
+    RequestId shard_request_id{SendOutcome::kInvalidRequestId};
+    bool cancelled{false};
+  };
+
+  /// Must be called under the `mutex_`.
+  size_t SelectShardUnsafe(const NetworkRequest& request,
+                           RequestId id) const;
+
+  void FinishRequest(RequestId id, size_t shard);
+
+  const ShardingPolicy policy_;
+
+  std::mutex mutex_;
+  RequestId request_id_counter_{
+      static_cast<RequestId>(RequestIdConstants::RequestIdMin)};
+  std::unordered_map<RequestId, RequestState> requests_;
+  std::vector<size_t> pending_;
+
+  /// Declared last, so the shards are stopped before the state used by their
+  /// callbacks is destroyed.
+  std::vector<std::shared_ptr<Network>> shards_;
+};
+
+}  // namespace http
+}  // namespace olp
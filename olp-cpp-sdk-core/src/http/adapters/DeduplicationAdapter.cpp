@@ -0,0 +1,396 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <olp/core/http/adapters/DeduplicationAdapter.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "olp/core/logging/Log.h"
+
+namespace olp {
+namespace http {
+namespace {
+
+constexpr auto kLogTag = "DeduplicationAdapter";
+
+/// Gets the key that identifies the identical requests, or an empty string
+/// if the request must not be coalesced.
+std::string GetRequestKey(const NetworkRequest& request) {
+  const auto verb = request.GetVerb();
+  if (verb != NetworkRequest::HttpVerb::GET &&
+      verb != NetworkRequest::HttpVerb::HEAD) {
+    return {};
+  }
+
+  const auto body = request.GetBody();
+  if ((body && !body->empty()) || request.GetBodyStream()) {
+    return {};
+  }
+
+  auto headers = request.GetHeaders();
+  for (auto& header : headers) {
+    std::transform(header.first.begin(), header.first.end(),
+                   header.first.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+  }
+  std::sort(headers.begin(), headers.end());
+
+  auto key = std::to_string(static_cast<int>(verb)) + ' ' + request.GetUrl();
+  for (const auto& header : headers) {
+    key += '\n' + header.first + ": " + header.second;
+  }
+  return key;
+}
+
+}  // namespace
+
+class DeduplicationAdapter::DeduplicationAdapterImpl final
+    : public std::enable_shared_from_this<DeduplicationAdapterImpl> {
+ public:
+  explicit DeduplicationAdapterImpl(std::shared_ptr<Network> network)
+      : network_(std::move(network)) {}
+
+  SendOutcome Send(NetworkRequest request, Payload payload, Callback callback,
+                   HeaderCallback header_callback,
+                   DataCallback data_callback) {
+    auto subscriber = std::make_shared<Subscriber>();
+    subscriber->payload = std::move(payload);
+    subscriber->callback = std::move(callback);
+    subscriber->header_callback = std::move(header_callback);
+    subscriber->data_callback = std::move(data_callback);
+
+    auto key = GetRequestKey(request);
+    auto group = std::make_shared<Group>();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      subscriber->id = NextRequestIdUnsafe();
+
+      auto it = key.empty() ? groups_.end() : groups_.find(key);
+      if (it != groups_.end()) {
+        auto& existing_group = it->second;
+        std::lock_guard<std::mutex> group_lock(existing_group->mutex);
+        if (!existing_group->started && existing_group->active > 0u) {
+          existing_group->subscribers.push_back(subscriber);
+          ++existing_group->active;
+          requests_[subscriber->id] = existing_group;
+          ++coalesced_count_;
+          return SendOutcome(subscriber->id);
+        }
+      }
+
+      group->key = key;
+      group->subscribers.push_back(subscriber);
+      group->active = 1u;
+      requests_[subscriber->id] = group;
+      if (!key.empty()) {
+        groups_[key] = group;
+      }
+    }
+
+    auto self = shared_from_this();
+    const auto outcome = network_->Send(
+        std::move(request), nullptr,
+        [=](NetworkResponse response) {
+          self->OnCompleted(group, std::move(response));
+        },
+        [=](std::string name, std::string value) {
+          self->OnHeader(group, name, value);
+        },
+        [=](const std::uint8_t* data, std::uint64_t offset,
+            std::size_t length) {
+          self->OnData(group, data, offset, length);
+        });
+
+    if (!outcome.IsSuccessful()) {
+      // No callbacks are triggered for the caller, but the requests that
+      // joined meanwhile are already sent from their point of view.
+      auto subscribers = Detach(group);
+      for (const auto& joined : subscribers) {
+        if (joined != subscriber && joined->callback) {
+          joined->callback(
+              NetworkResponse()
+                  .WithRequestId(joined->id)
+                  .WithStatus(static_cast<int>(outcome.GetErrorCode()))
+                  .WithError(ErrorCodeToString(outcome.GetErrorCode())));
+        }
+      }
+      return outcome;
+    }
+
+    bool cancelled = false;
+    {
+      std::lock_guard<std::mutex> lock(group->mutex);
+      group->request_id = outcome.GetRequestId();
+      cancelled = !group->completed && group->active == 0u;
+    }
+
+    if (cancelled) {
+      network_->Cancel(outcome.GetRequestId());
+    }
+
+    return SendOutcome(subscriber->id);
+  }
+
+  void Cancel(RequestId id) {
+    std::shared_ptr<Group> group;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = requests_.find(id);
+      if (it == requests_.end()) {
+        return;
+      }
+      group = it->second;
+    }
+
+    RequestId request_id = SendOutcome::kInvalidRequestId;
+    {
+      std::lock_guard<std::mutex> lock(group->mutex);
+      auto it = std::find_if(group->subscribers.begin(),
+                             group->subscribers.end(),
+                             [&](const std::shared_ptr<Subscriber>& item) {
+                               return item->id == id;
+                             });
+      if (it == group->subscribers.end() || (*it)->cancelled.exchange(true)) {
+        return;
+      }
+
+      if (--group->active > 0u || group->completed) {
+        return;
+      }
+
+      // Send cancels the request when the ID is not known yet.
+      request_id = group->request_id;
+    }
+
+    // Nobody waits for the response anymore, so do not let others join.
+    RemoveJoinable(group);
+
+    if (request_id != SendOutcome::kInvalidRequestId) {
+      network_->Cancel(request_id);
+    }
+  }
+
+  void SetDefaultHeaders(Headers headers) {
+    network_->SetDefaultHeaders(std::move(headers));
+  }
+
+  void SetCurrentBucket(uint8_t bucket_id) {
+    network_->SetCurrentBucket(bucket_id);
+  }
+
+  Statistics GetStatistics(uint8_t bucket_id) {
+    return network_->GetStatistics(bucket_id);
+  }
+
+  size_t GetCoalescedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return coalesced_count_;
+  }
+
+ private:
+  struct Subscriber {
+    RequestId id{SendOutcome::kInvalidRequestId};
+    Payload payload;
+    Callback callback;
+    HeaderCallback header_callback;
+    DataCallback data_callback;
+    std::atomic<bool> cancelled{false};
+  };
+
+  /// The callers that share one network request.
+  struct Group {
+    std::string key;
+    std::mutex mutex;
+    /// Not modified after the request is started, so the response is passed
+    /// to the subscribers without holding the lock.
+    std::vector<std::shared_ptr<Subscriber>> subscribers;
+    size_t active{0u};
+    RequestId request_id{SendOutcome::kInvalidRequestId};
+    bool started{false};
+    bool completed{false};
+  };
+
+  /// Must be called under the `mutex_`.
+  RequestId NextRequestIdUnsafe() {
+    const auto id = request_id_counter_;
+    if (request_id_counter_ ==
+        static_cast<RequestId>(RequestIdConstants::RequestIdMax)) {
+      request_id_counter_ =
+          static_cast<RequestId>(RequestIdConstants::RequestIdMin);
+    } else {
+      ++request_id_counter_;
+    }
+    return id;
+  }
+
+  void RemoveJoinable(const std::shared_ptr<Group>& group) {
+    if (group->key.empty()) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = groups_.find(group->key);
+    if (it != groups_.end() && it->second == group) {
+      groups_.erase(it);
+    }
+  }
+
+  /// Marks the group as started, so the subscribers do not change anymore.
+  void Start(const std::shared_ptr<Group>& group) {
+    {
+      std::lock_guard<std::mutex> lock(group->mutex);
+      if (group->started) {
+        return;
+      }
+      group->started = true;
+    }
+    RemoveJoinable(group);
+  }
+
+  /// Removes the group and returns its subscribers.
+  std::vector<std::shared_ptr<Subscriber>> Detach(
+      const std::shared_ptr<Group>& group) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = group->key.empty() ? groups_.end() : groups_.find(group->key);
+    if (it != groups_.end() && it->second == group) {
+      groups_.erase(it);
+    }
+
+    std::lock_guard<std::mutex> group_lock(group->mutex);
+    group->completed = true;
+    for (const auto& subscriber : group->subscribers) {
+      requests_.erase(subscriber->id);
+    }
+    return std::move(group->subscribers);
+  }
+
+  void OnHeader(const std::shared_ptr<Group>& group, const std::string& name,
+                const std::string& value) {
+    Start(group);
+    for (const auto& subscriber : group->subscribers) {
+      if (subscriber->header_callback && !subscriber->cancelled) {
+        subscriber->header_callback(name, value);
+      }
+    }
+  }
+
+  void OnData(const std::shared_ptr<Group>& group, const std::uint8_t* data,
+              std::uint64_t offset, std::size_t length) {
+    Start(group);
+    for (const auto& subscriber : group->subscribers) {
+      if (subscriber->cancelled) {
+        continue;
+      }
+
+      if (subscriber->data_callback) {
+        subscriber->data_callback(data, offset, length);
+      }
+
+      const auto& stream = subscriber->payload;
+      if (stream) {
+        if (stream->tellp() != static_cast<std::streamoff>(offset)) {
+          stream->seekp(static_cast<std::streamoff>(offset));
+          if (stream->fail()) {
+            OLP_SDK_LOG_WARNING(kLogTag, "Payload seekp() failed, id="
+                                             << subscriber->id);
+            stream->clear();
+          }
+        }
+
+        stream->write(reinterpret_cast<const char*>(data),
+                      static_cast<std::streamsize>(length));
+      }
+    }
+  }
+
+  void OnCompleted(const std::shared_ptr<Group>& group,
+                   NetworkResponse response) {
+    const auto subscribers = Detach(group);
+    for (const auto& subscriber : subscribers) {
+      if (!subscriber->callback) {
+        continue;
+      }
+
+      if (subscriber->cancelled) {
+        subscriber->callback(
+            NetworkResponse()
+                .WithRequestId(subscriber->id)
+                .WithStatus(static_cast<int>(ErrorCode::CANCELLED_ERROR))
+                .WithError("Cancelled"));
+      } else {
+        auto subscriber_response = response;
+        subscriber->callback(
+            std::move(subscriber_response.WithRequestId(subscriber->id)));
+      }
+    }
+  }
+
+  std::shared_ptr<Network> network_;
+
+  mutable std::mutex mutex_;
+  RequestId request_id_counter_{
+      static_cast<RequestId>(RequestIdConstants::RequestIdMin)};
+  /// The requests that can be joined by the key.
+  std::unordered_map<std::string, std::shared_ptr<Group>> groups_;
+  /// All the pending requests by ID.
+  std::unordered_map<RequestId, std::shared_ptr<Group>> requests_;
+  size_t coalesced_count_{0u};
+};
+
+DeduplicationAdapter::DeduplicationAdapter(std::shared_ptr<Network> network)
+    : impl_(std::make_shared<DeduplicationAdapterImpl>(std::move(network))) {}
+
+DeduplicationAdapter::~DeduplicationAdapter() = default;
+
+SendOutcome DeduplicationAdapter::Send(NetworkRequest request,
+                                       Payload payload, Callback callback,
+                                       HeaderCallback header_callback,
+                                       DataCallback data_callback) {
+  return impl_->Send(std::move(request), std::move(payload),
+                     std::move(callback), std::move(header_callback),
+                     std::move(data_callback));
+}
+
+void DeduplicationAdapter::Cancel(RequestId id) { impl_->Cancel(id); }
+
+void DeduplicationAdapter::SetDefaultHeaders(Headers headers) {
+  impl_->SetDefaultHeaders(std::move(headers));
+}
+
+void DeduplicationAdapter::SetCurrentBucket(uint8_t bucket_id) {
+  impl_->SetCurrentBucket(bucket_id);
+}
+
+Network::Statistics DeduplicationAdapter::GetStatistics(uint8_t bucket_id) {
+  return impl_->GetStatistics(bucket_id);
+}
+
+size_t DeduplicationAdapter::GetCoalescedCount() const {
+  return impl_->GetCoalescedCount();
+}
+
+}  // namespace http
+}  // namespace olp
@@ -31,8 +31,10 @@
 #include <sstream>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "olp/core/logging/Log.h"
+#include "olp/core/utils/Base64.h"
 
 namespace olp {
 namespace http {
@@ -166,8 +168,10 @@ void PrettyPrint(std::ostream& os, boost::json::value const& jv,
 class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
  public:
   HarCaptureAdapterImpl(std::shared_ptr<Network> network,
-                        std::string har_out_path)
-      : network_{std::move(network)}, har_out_path_{std::move(har_out_path)} {}
+                        std::string har_out_path, bool capture_content)
+      : network_{std::move(network)},
+        har_out_path_{std::move(har_out_path)},
+        capture_content_{capture_content} {}
 
   ~HarCaptureAdapterImpl() override { SaveSessionToFile(); }
 
@@ -177,14 +181,29 @@ class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
     const auto session_request_id = RecordRequest(request);
 
     const auto response_headers = std::make_shared<Headers>();
+    const auto response_body =
+        capture_content_ ? std::make_shared<std::vector<std::uint8_t>>()
+                         : nullptr;
 
     auto header_callback_proxy = [=](std::string key, std::string value) {
       header_callback(key, value);
       response_headers->emplace_back(std::move(key), std::move(value));
     };
 
+    if (response_body) {
+      auto user_data_callback = std::move(data_callback);
+      data_callback = [=](const std::uint8_t* data, std::uint64_t offset,
+                          std::size_t length) {
+        if (user_data_callback) {
+          user_data_callback(data, offset, length);
+        }
+        response_body->insert(response_body->end(), data, data + length);
+      };
+    }
+
     auto callback_proxy = [=](NetworkResponse response) {
-      RecordResponse(session_request_id, response, *response_headers);
+      RecordResponse(session_request_id, response, *response_headers,
+                     response_body);
       callback(std::move(response));
     };
 
@@ -201,7 +220,7 @@ class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
     std::chrono::system_clock::time_point start_time;
     std::chrono::system_clock::time_point end_time;
     uint8_t method{};
-    uint8_t status_code{};
+    int16_t status_code{};
     uint16_t request_headers_offset{};
     uint16_t request_headers_count{};
     uint16_t response_headers_offset{};
@@ -236,12 +255,19 @@ class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
 
     requests_.emplace_back(request_entry);
 
+    const auto& body = request.GetBody();
+    if (capture_content_ && body && !body->empty()) {
+      request_bodies_.resize(size + 1);
+      request_bodies_[size] = body;
+    }
+
     return size;
   }
 
-  void RecordResponse(const RequestId request_id,
-                      const NetworkResponse& response,
-                      const Headers& response_headers) {
+  void RecordResponse(
+      const RequestId request_id, const NetworkResponse& response,
+      const Headers& response_headers,
+      std::shared_ptr<const std::vector<std::uint8_t>> response_body) {
     std::lock_guard<std::mutex> lock(mutex_);
     constexpr std::hash<std::string> hasher{};
 
@@ -268,6 +294,14 @@ class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
 
       diagnostics_[request_id] = *diagnostics;
     }
+
+    if (response_body) {
+      if (response_bodies_.size() <= request_id) {
+        response_bodies_.resize(request_id + 1);
+      }
+
+      response_bodies_[request_id] = std::move(response_body);
+    }
   }
 
   void SaveSessionToFile() const {
@@ -333,6 +367,15 @@ class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
           value["headersSize"] = -1;
           value["bodySize"] = -1;
 
+          const auto* body = GetBody(request_bodies_, request_index);
+          if (body) {
+            value["bodySize"] = static_cast<std::uint64_t>(body->size());
+            value["postData"] = boost::json::object(
+                {{"mimeType", ""},
+                 {"text", utils::Base64Encode(*body)},
+                 {"_encoding", "base64"}});
+          }
+
           return value;
         }());
 
@@ -346,6 +389,14 @@ class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
                                             request.response_headers_count);
           value["content"] =
               boost::json::object({{"size", 0}, {"mimeType", ""}});
+
+          const auto* body = GetBody(response_bodies_, request_index);
+          if (body) {
+            auto& content = value["content"].as_object();
+            content["size"] = static_cast<std::uint64_t>(body->size());
+            content["text"] = utils::Base64Encode(*body);
+            content["encoding"] = "base64";
+          }
           value["redirectURL"] = "";
           value["headersSize"] = -1;
           value["bodySize"] = -1;
@@ -389,20 +440,32 @@ class HarCaptureAdapter::HarCaptureAdapterImpl final : public Network {
                      "Session is saved to: " << har_out_path_);
   }
 
+  using Body = std::shared_ptr<const std::vector<std::uint8_t>>;
+
+  static const std::vector<std::uint8_t>* GetBody(
+      const std::deque<Body>& bodies, size_t request_index) {
+    return request_index < bodies.size() ? bodies[request_index].get()
+                                         : nullptr;
+  }
+
   std::mutex mutex_;
   std::unordered_map<size_t, std::string> cache_{};
   std::deque<std::pair<size_t, size_t> > headers_{};
   std::deque<RequestEntry> requests_{};
   std::deque<Diagnostics> diagnostics_{};
+  std::deque<Body> request_bodies_{};
+  std::deque<Body> response_bodies_{};
 
   std::shared_ptr<Network> network_;
   std::string har_out_path_;
+  const bool capture_content_;
 };
 
 HarCaptureAdapter::HarCaptureAdapter(std::shared_ptr<Network> network,
-                                     std::string har_out_path)
-    : impl_(std::make_shared<HarCaptureAdapterImpl>(std::move(network),
-                                                    std::move(har_out_path))) {}
+                                     std::string har_out_path,
+                                     bool capture_content)
+    : impl_(std::make_shared<HarCaptureAdapterImpl>(
+          std::move(network), std::move(har_out_path), capture_content)) {}
 
 HarCaptureAdapter::~HarCaptureAdapter() = default;
 
@@ -0,0 +1,440 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <olp/core/http/adapters/HarReplayNetwork.h>
+
+#include <boost/json/parse.hpp>
+#include <boost/json/value.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "olp/core/http/HttpStatusCode.h"
+#include "olp/core/http/NetworkUtils.h"
+#include "olp/core/logging/Log.h"
+#include "olp/core/utils/Base64.h"
+#include "olp/core/utils/Thread.h"
+
+namespace olp {
+namespace http {
+namespace {
+
+constexpr auto kLogTag = "HarReplayNetwork";
+constexpr auto kReplayThreadName = "OLPSDKHARREPLAY";
+
+using Bytes = std::vector<std::uint8_t>;
+
+bool StringToVerb(const std::string& method, NetworkRequest::HttpVerb& verb) {
+  static const std::pair<const char*, NetworkRequest::HttpVerb> kVerbs[] = {
+      {"GET", NetworkRequest::HttpVerb::GET},
+      {"POST", NetworkRequest::HttpVerb::POST},
+      {"HEAD", NetworkRequest::HttpVerb::HEAD},
+      {"PUT", NetworkRequest::HttpVerb::PUT},
+      {"DELETE", NetworkRequest::HttpVerb::DEL},
+      {"DEL", NetworkRequest::HttpVerb::DEL},
+      {"PATCH", NetworkRequest::HttpVerb::PATCH},
+      {"OPTIONS", NetworkRequest::HttpVerb::OPTIONS}};
+
+  for (const auto& item : kVerbs) {
+    if (method == item.first) {
+      verb = item.second;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string MakeKey(NetworkRequest::HttpVerb verb, const std::string& url) {
+  return std::to_string(static_cast<int>(verb)) + ' ' + url;
+}
+
+const boost::json::value* Find(const boost::json::value* value,
+                               const char* key) {
+  const auto* object = value ? value->if_object() : nullptr;
+  return object ? object->if_contains(key) : nullptr;
+}
+
+std::string GetString(const boost::json::value* value) {
+  if (!value || !value->is_string()) {
+    return {};
+  }
+  const auto& string = value->get_string();
+  return std::string(string.data(), string.size());
+}
+
+double GetNumber(const boost::json::value* value, double default_value) {
+  if (!value) {
+    return default_value;
+  }
+
+  switch (value->kind()) {
+    case boost::json::kind::int64:
+      return static_cast<double>(value->get_int64());
+    case boost::json::kind::uint64:
+      return static_cast<double>(value->get_uint64());
+    case boost::json::kind::double_:
+      return value->get_double();
+    default:
+      return default_value;
+  }
+}
+
+/// Reads the HAR text that is either plain or Base64 encoded.
+Bytes GetContent(const boost::json::value* content,
+                 const char* encoding_key) {
+  const auto text = GetString(Find(content, "text"));
+  if (GetString(Find(content, encoding_key)) != "base64") {
+    return Bytes(text.begin(), text.end());
+  }
+
+  Bytes bytes;
+  if (!utils::Base64Decode(text, bytes)) {
+    OLP_SDK_LOG_WARNING(kLogTag, "Failed to decode the Base64 content");
+    bytes.clear();
+  }
+  return bytes;
+}
+
+}  // namespace
+
+class HarReplayNetwork::HarReplayNetworkImpl final {
+ public:
+  HarReplayNetworkImpl(const std::string& har_path, TimingMode timing_mode,
+                       bool match_body)
+      : timing_mode_{timing_mode}, match_body_{match_body} {
+    Load(har_path);
+    thread_ = std::thread(&HarReplayNetworkImpl::Run, this);
+  }
+
+  ~HarReplayNetworkImpl() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+  }
+
+  SendOutcome Send(NetworkRequest request, Payload payload, Callback callback,
+                   HeaderCallback header_callback,
+                   DataCallback data_callback) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return SendOutcome(ErrorCode::OFFLINE_ERROR);
+    }
+
+    const auto entry_index = MatchUnsafe(request);
+    if (entry_index == kNoEntry) {
+      lock.unlock();
+      OLP_SDK_LOG_WARNING(kLogTag, "No recorded response, url="
+                                       << request.GetUrl());
+      return SendOutcome(ErrorCode::OFFLINE_ERROR);
+    }
+
+    const auto id = request_id_counter_;
+    if (request_id_counter_ ==
+        static_cast<RequestId>(RequestIdConstants::RequestIdMax)) {
+      request_id_counter_ =
+          static_cast<RequestId>(RequestIdConstants::RequestIdMin);
+    } else {
+      ++request_id_counter_;
+    }
+
+    auto due_time = std::chrono::steady_clock::now();
+    if (timing_mode_ == TimingMode::kRecorded) {
+      due_time += entries_[entry_index].time;
+    }
+
+    auto& pending_request = requests_[id];
+    pending_request.entry = entry_index;
+    pending_request.payload = std::move(payload);
+    pending_request.callback = std::move(callback);
+    pending_request.header_callback = std::move(header_callback);
+    pending_request.data_callback = std::move(data_callback);
+    schedule_.emplace(due_time, id);
+
+    lock.unlock();
+    condition_.notify_one();
+    return SendOutcome(id);
+  }
+
+  void Cancel(RequestId id) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = requests_.find(id);
+      if (it == requests_.end() || it->second.cancelled) {
+        return;
+      }
+
+      // Complete the request right away.
+      it->second.cancelled = true;
+      schedule_.emplace(std::chrono::steady_clock::now(), id);
+    }
+    condition_.notify_one();
+  }
+
+  size_t GetEntryCount() const { return entries_.size(); }
+
+ private:
+  static constexpr size_t kNoEntry = static_cast<size_t>(-1);
+
+  struct Entry {
+    NetworkRequest::HttpVerb verb{NetworkRequest::HttpVerb::GET};
+    std::string url;
+    Bytes request_body;
+    int status{0};
+    Headers headers;
+    Bytes body;
+    std::chrono::microseconds time{0};
+  };
+
+  /// The entries recorded for the same method and URL.
+  struct Matches {
+    std::vector<size_t> entries;
+    size_t next{0};
+  };
+
+  struct PendingRequest {
+    size_t entry{kNoEntry};
+    Payload payload;
+    Callback callback;
+    HeaderCallback header_callback;
+    DataCallback data_callback;
+    bool cancelled{false};
+  };
+
+  void Load(const std::string& har_path) {
+    std::ifstream file(har_path, std::ios::binary);
+    if (!file.is_open()) {
+      OLP_SDK_LOG_ERROR(kLogTag, "Failed to open, path=" << har_path);
+      return;
+    }
+
+    std::stringstream content;
+    content << file.rdbuf();
+
+    boost::json::error_code error;
+    const auto document = boost::json::parse(content.str(), error);
+    if (error) {
+      OLP_SDK_LOG_ERROR(kLogTag, "Failed to parse, path="
+                                     << har_path
+                                     << ", error=" << error.message());
+      return;
+    }
+
+    const auto* entries = Find(Find(&document, "log"), "entries");
+    if (!entries || !entries->is_array()) {
+      OLP_SDK_LOG_ERROR(kLogTag, "No entries found, path=" << har_path);
+      return;
+    }
+
+    for (const auto& value : entries->get_array()) {
+      const auto* request = Find(&value, "request");
+      const auto* response = Find(&value, "response");
+
+      Entry entry;
+      entry.url = GetString(Find(request, "url"));
+      if (!response || entry.url.empty() ||
+          !StringToVerb(GetString(Find(request, "method")), entry.verb)) {
+        OLP_SDK_LOG_WARNING(kLogTag, "Skipping invalid entry");
+        continue;
+      }
+
+      entry.request_body = GetContent(Find(request, "postData"), "_encoding");
+      entry.status = static_cast<int>(GetNumber(Find(response, "status"), 0));
+      entry.body = GetContent(Find(response, "content"), "encoding");
+      entry.time = std::chrono::microseconds(static_cast<int64_t>(
+          std::max(GetNumber(Find(&value, "time"), 0.0), 0.0) * 1000.0));
+
+      const auto* headers = Find(response, "headers");
+      if (headers && headers->is_array()) {
+        for (const auto& header : headers->get_array()) {
+          entry.headers.emplace_back(GetString(Find(&header, "name")),
+                                     GetString(Find(&header, "value")));
+        }
+      }
+
+      matches_[MakeKey(entry.verb, entry.url)].entries.push_back(
+          entries_.size());
+      entries_.push_back(std::move(entry));
+    }
+
+    OLP_SDK_LOG_INFO(kLogTag, "Loaded " << entries_.size()
+                                        << " entries, path=" << har_path);
+  }
+
+  /// Must be called under the `mutex_`.
+  size_t MatchUnsafe(const NetworkRequest& request) {
+    auto it = matches_.find(MakeKey(request.GetVerb(), request.GetUrl()));
+    if (it == matches_.end()) {
+      return kNoEntry;
+    }
+
+    auto& matches = it->second;
+    const auto& body = request.GetBody();
+    const auto count = matches.entries.size();
+    for (size_t i = 0; i < count; ++i) {
+      const auto index = matches.entries[(matches.next + i) % count];
+      const auto& recorded_body = entries_[index].request_body;
+      if (!match_body_ || (body ? *body == recorded_body
+                                : recorded_body.empty())) {
+        matches.next = (matches.next + i + 1) % count;
+        return index;
+      }
+    }
+
+    return kNoEntry;
+  }
+
+  void Run() {
+    utils::Thread::SetCurrentThreadName(kReplayThreadName);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_) {
+      if (schedule_.empty()) {
+        condition_.wait(lock);
+        continue;
+      }
+
+      auto next = schedule_.begin();
+      if (next->first > std::chrono::steady_clock::now()) {
+        condition_.wait_until(lock, next->first);
+        continue;
+      }
+
+      const auto id = next->second;
+      schedule_.erase(next);
+
+      auto it = requests_.find(id);
+      if (it == requests_.end()) {
+        continue;
+      }
+
+      auto request = std::move(it->second);
+      requests_.erase(it);
+
+      lock.unlock();
+      Complete(id, request);
+      lock.lock();
+    }
+
+    // Cancel the requests that are not completed yet.
+    auto requests = std::move(requests_);
+    requests_.clear();
+    schedule_.clear();
+    lock.unlock();
+
+    for (auto& request : requests) {
+      request.second.cancelled = true;
+      Complete(request.first, request.second);
+    }
+  }
+
+  void Complete(RequestId id, const PendingRequest& request) const {
+    auto response = NetworkResponse().WithRequestId(id);
+    if (request.cancelled) {
+      response.WithStatus(static_cast<int>(ErrorCode::CANCELLED_ERROR))
+          .WithError("Cancelled");
+    } else {
+      const auto& entry = entries_[request.entry];
+      if (request.header_callback) {
+        for (const auto& header : entry.headers) {
+          request.header_callback(header.first, header.second);
+        }
+      }
+
+      if (!entry.body.empty()) {
+        if (request.data_callback) {
+          request.data_callback(entry.body.data(), 0u, entry.body.size());
+        }
+        if (request.payload) {
+          request.payload->write(
+              reinterpret_cast<const char*>(entry.body.data()),
+              static_cast<std::streamsize>(entry.body.size()));
+        }
+      }
+
+      Diagnostics diagnostics;
+      diagnostics.timings[Diagnostics::Total] =
+          std::chrono::duration_cast<Diagnostics::MicroSeconds>(entry.time);
+      diagnostics.available_timings.set(Diagnostics::Total);
+
+      response.WithStatus(entry.status)
+          .WithError(HttpErrorToString(entry.status))
+          .WithBytesDownloaded(entry.body.size())
+          .WithDiagnostics(diagnostics);
+    }
+
+    if (request.callback) {
+      request.callback(std::move(response));
+    }
+  }
+
+  const TimingMode timing_mode_;
+  const bool match_body_;
+
+  std::vector<Entry> entries_;
+  std::unordered_map<std::string, Matches> matches_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::multimap<std::chrono::steady_clock::time_point, RequestId> schedule_;
+  std::unordered_map<RequestId, PendingRequest> requests_;
+  RequestId request_id_counter_{
+      static_cast<RequestId>(RequestIdConstants::RequestIdMin)};
+  bool stopped_{false};
+
+  std::thread thread_;
+};
+
+constexpr size_t HarReplayNetwork::HarReplayNetworkImpl::kNoEntry;
+
+HarReplayNetwork::HarReplayNetwork(const std::string& har_path,
+                                   TimingMode timing_mode, bool match_body)
+    : impl_(std::make_shared<HarReplayNetworkImpl>(har_path, timing_mode,
+                                                   match_body)) {}
+
+HarReplayNetwork::~HarReplayNetwork() = default;
+
+SendOutcome HarReplayNetwork::Send(NetworkRequest request, Payload payload,
+                                   Callback callback,
+                                   HeaderCallback header_callback,
+                                   DataCallback data_callback) {
+  return impl_->Send(std::move(request), std::move(payload),
+                     std::move(callback), std::move(header_callback),
+                     std::move(data_callback));
+}
+
+void HarReplayNetwork::Cancel(RequestId id) { impl_->Cancel(id); }
+
+size_t HarReplayNetwork::GetEntryCount() const {
+  return impl_->GetEntryCount();
+}
+
+}  // namespace http
+}  // namespace olp
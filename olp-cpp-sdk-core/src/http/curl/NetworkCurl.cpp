@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <cstdio>
 #include <cstring>
 #include <memory>
 #include <utility>
@@ -309,6 +310,13 @@ std::shared_ptr<curl_slist> SetupHeaders(const Headers& headers) {
   return {list, curl_slist_free_all};
 }
 
+void AppendHeader(std::shared_ptr<curl_slist>& headers, const char* header) {
+  curl_slist* list = curl_slist_append(headers.get(), header);
+  if (list && !headers) {
+    headers.reset(list, curl_slist_free_all);
+  }
+}
+
 void SetupProxy(CURL* curl_handle, const NetworkProxySettings& proxy) {
   if (proxy.GetType() == NetworkProxySettings::Type::NONE) {
     return;
@@ -354,7 +362,8 @@ void SetupDns(CURL* curl_handle, const std::vector<std::string>& dns_servers) {
 #endif
 }
 
-void WithDiagnostics(NetworkResponse& response, CURL* handle) {
+void WithDiagnostics(NetworkResponse& response, CURL* handle,
+                     std::chrono::microseconds dispatch_delay) {
 #if CURL_AT_LEAST_VERSION(7, 61, 0)
   Diagnostics diagnostics;
   static const std::pair<Diagnostics::Timings, CURLINFO> available_timings[] = {
@@ -392,11 +401,17 @@ void WithDiagnostics(NetworkResponse& response, CURL* handle) {
     }
   }
 
-  add_timing(Diagnostics::Total, Diagnostics::MicroSeconds(last_time_point));
+  // The requests also wait in the event queue before cURL receives them.
+  const auto dispatch_us =
+      std::chrono::duration_cast<Diagnostics::MicroSeconds>(dispatch_delay);
+  add_timing(Diagnostics::Queue,
+             diagnostics.timings[Diagnostics::Queue] + dispatch_us);
+  add_timing(Diagnostics::Total,
+             Diagnostics::MicroSeconds(last_time_point) + dispatch_us);
 
   response.WithDiagnostics(diagnostics);
 #else
-  OLP_SDK_CORE_UNUSED(response, handle);
+  OLP_SDK_CORE_UNUSED(response, handle, dispatch_delay);
 #endif
 }
 
@@ -716,6 +731,8 @@ ErrorCode NetworkCurl::SendImplementation(
       request_handle->out_data_callback = std::move(data_callback);
       request_handle->out_data_stream = payload;
       request_handle->request_body = request.GetBody();
+      request_handle->request_body_stream = request.GetBodyStream();
+      request_handle->request_body_stream_size = request.GetBodyStreamSize();
       request_handle->request_headers = SetupHeaders(request.GetHeaders());
     }
 
@@ -771,9 +788,35 @@ ErrorCode NetworkCurl::SendImplementation(
 
   if (verb != NetworkRequest::HttpVerb::GET &&
       verb != NetworkRequest::HttpVerb::HEAD) {
-    // These can also be used to add body data to a CURLOPT_CUSTOMREQUEST
-    // such as delete.
-    SetupRequestBody(curl_handle, handle->request_body);
+    if (handle->request_body_stream) {
+      // The body is read by the worker thread while the request is sent.
+      auto& stream = *handle->request_body_stream;
+      handle->request_body_stream_start = stream.tellg();
+      if (handle->request_body_stream_start == std::streampos(-1)) {
+        // Not seekable, so cURL is not able to rewind the body.
+        stream.clear();
+      }
+
+      const auto& size = handle->request_body_stream_size;
+      curl_easy_setopt(curl_handle, CURLOPT_POST, 1L);
+      curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDSIZE_LARGE,
+                       size ? static_cast<curl_off_t>(*size)
+                            : static_cast<curl_off_t>(-1));
+      curl_easy_setopt(curl_handle, CURLOPT_READFUNCTION,
+                       &NetworkCurl::ReadFunction);
+      curl_easy_setopt(curl_handle, CURLOPT_READDATA, handle);
+      curl_easy_setopt(curl_handle, CURLOPT_SEEKFUNCTION,
+                       &NetworkCurl::SeekFunction);
+      curl_easy_setopt(curl_handle, CURLOPT_SEEKDATA, handle);
+
+      if (!size) {
+        AppendHeader(handle->request_headers, "Transfer-Encoding: chunked");
+      }
+    } else {
+      // These can also be used to add body data to a CURLOPT_CUSTOMREQUEST
+      // such as delete.
+      SetupRequestBody(curl_handle, handle->request_body);
+    }
   }
 
   SetupProxy(curl_handle, config.GetProxySettings());
@@ -940,6 +983,7 @@ NetworkCurl::RequestHandle* NetworkCurl::InitRequestHandleUnsafe() {
   unused_handle_it->in_use = true;
   unused_handle_it->self = shared_from_this();
   unused_handle_it->send_time = std::chrono::steady_clock::now();
+  unused_handle_it->dispatch_delay = std::chrono::microseconds(0);
   unused_handle_it->log_context = logging::GetContext();
 
   return &*unused_handle_it;
@@ -1025,6 +1069,54 @@ size_t NetworkCurl::RxFunction(void* ptr, size_t size, size_t nmemb,
   return len;
 }
 
+size_t NetworkCurl::ReadFunction(char* buffer, size_t size, size_t nitems,
+                                 RequestHandle* handle) {
+  std::shared_ptr<NetworkCurl> that = handle->self.lock();
+  if (!that || !that->IsStarted() || handle->is_cancelled) {
+    return CURL_READFUNC_ABORT;
+  }
+
+  auto length = static_cast<std::uint64_t>(size * nitems);
+  const auto& body_size = handle->request_body_stream_size;
+  if (body_size) {
+    // Never send more than announced in the Content-Length header.
+    length = std::min(length, *body_size - std::min(*body_size,
+                                                    handle->bytes_sent));
+  }
+
+  auto& stream = *handle->request_body_stream;
+  stream.read(buffer, static_cast<std::streamsize>(length));
+  if (stream.bad()) {
+    OLP_SDK_LOG_WARNING(kLogTag,
+                        "Request body read failed, id=" << handle->id);
+    return CURL_READFUNC_ABORT;
+  }
+
+  const auto count = static_cast<size_t>(stream.gcount());
+  handle->bytes_sent += count;
+  return count;
+}
+
+int NetworkCurl::SeekFunction(RequestHandle* handle, curl_off_t offset,
+                              int origin) {
+  if (origin != SEEK_SET ||
+      handle->request_body_stream_start == std::streampos(-1)) {
+    return CURL_SEEKFUNC_CANTSEEK;
+  }
+
+  auto& stream = *handle->request_body_stream;
+  stream.clear();
+  stream.seekg(handle->request_body_stream_start +
+               static_cast<std::streamoff>(offset));
+  if (stream.fail()) {
+    stream.clear();
+    return CURL_SEEKFUNC_FAIL;
+  }
+
+  handle->bytes_sent = static_cast<std::uint64_t>(offset);
+  return CURL_SEEKFUNC_OK;
+}
+
 size_t NetworkCurl::HeaderFunction(char* ptr, size_t size, size_t nitems,
                                    RequestHandle* handle) {
   const size_t len = size * nitems;
@@ -1100,7 +1192,7 @@ void NetworkCurl::CompleteMessage(CURL* curl_handle, CURLcode result) {
                       .WithBytesDownloaded(download_bytes)
                       .WithBytesUploaded(upload_bytes);
 
-  WithDiagnostics(response, curl_handle);
+  WithDiagnostics(response, curl_handle, request_handle->dispatch_delay);
 
   if (request_handle->is_cancelled) {
     response.WithStatus(static_cast<int>(ErrorCode::CANCELLED_ERROR))
@@ -1196,6 +1288,10 @@ void NetworkCurl::Run() {
         CURL* curl_handle = request_handle->curl_handle.get();
 
         if (event.type == EventInfo::Type::SEND_EVENT) {
+          request_handle->dispatch_delay =
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() -
+                  request_handle->send_time);
           auto res = curl_multi_add_handle(curl_, curl_handle);
           if (res != CURLM_OK && res != CURLM_CALL_MULTI_PERFORM) {
             OLP_SDK_LOG_ERROR(
@@ -1298,7 +1394,8 @@ void NetworkCurl::Run() {
                     .WithBytesDownloaded(download_bytes)
                     .WithBytesUploaded(upload_bytes);
 
-            WithDiagnostics(response, curl_handle);
+            WithDiagnostics(response, curl_handle,
+                            request_handle->dispatch_delay);
 
             callback(response);
             lock.lock();
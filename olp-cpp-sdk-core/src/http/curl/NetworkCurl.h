@@ -25,6 +25,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <istream>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -116,6 +117,10 @@ class NetworkCurl : public Network,
    */
   struct RequestHandle {
     NetworkRequest::RequestBodyType request_body;
+    NetworkRequest::RequestBodyStreamType request_body_stream;
+    porting::optional<std::uint64_t> request_body_stream_size;
+    std::streampos request_body_stream_start{-1};
+    std::uint64_t bytes_sent{0};
     std::shared_ptr<curl_slist> request_headers;
 
     HeaderCallback out_header_callback;
@@ -125,6 +130,8 @@ class NetworkCurl : public Network,
     std::uint64_t bytes_received{0};
 
     std::chrono::steady_clock::time_point send_time{};
+    /// The time between `Send` and handing the request over to cURL.
+    std::chrono::microseconds dispatch_delay{0};
     std::weak_ptr<NetworkCurl> self{};
 
     std::shared_ptr<CURL> curl_handle;
@@ -268,6 +275,18 @@ class NetworkCurl : public Network,
   static size_t RxFunction(void* ptr, size_t size, size_t nmemb,
                            RequestHandle* handle);
 
+  /**
+   * @brief CURL callback that reads the streamed request body.
+   */
+  static size_t ReadFunction(char* buffer, size_t size, size_t nitems,
+                             RequestHandle* handle);
+
+  /**
+   * @brief CURL callback that rewinds the streamed request body.
+   */
+  static int SeekFunction(RequestHandle* handle, curl_off_t offset,
+                          int origin);
+
   /**
    * @brief CURL header callback.
    */
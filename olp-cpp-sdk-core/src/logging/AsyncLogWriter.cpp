@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "AsyncLogWriter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <olp/core/utils/Thread.h>
+#include "ThreadId.h"
+
+namespace olp {
+namespace logging {
+
+namespace {
+constexpr auto kThreadName = "OLPSDKLOG";
+constexpr auto kLogTag = "Log";
+constexpr size_t kMaxTagSize = 64u;
+
+thread_local bool t_is_writer_thread = false;
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1u;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+constexpr size_t kStringSizeBytes = sizeof(uint32_t);
+constexpr size_t kValueBytes = sizeof(uint64_t);
+
+size_t EncodedSize(const LogArgument* arguments, size_t count) {
+  size_t size = 0u;
+  for (size_t i = 0u; i < count; ++i) {
+    size += 1u;
+    if (arguments[i].getType() == LogArgument::Type::kString) {
+      size += kStringSizeBytes + arguments[i].getSize();
+    } else {
+      size += kValueBytes;
+    }
+  }
+  return size;
+}
+
+/// Stores every argument as its type followed by the value, or by the size
+/// and the characters for strings.
+size_t EncodeArguments(const LogArgument* arguments, size_t count,
+                       char* destination) {
+  char* output = destination;
+  for (size_t i = 0u; i < count; ++i) {
+    const auto& argument = arguments[i];
+    *output++ = static_cast<char>(argument.getType());
+    switch (argument.getType()) {
+      case LogArgument::Type::kString: {
+        const auto size = static_cast<uint32_t>(argument.getSize());
+        std::memcpy(output, &size, kStringSizeBytes);
+        std::memcpy(output + kStringSizeBytes, argument.getData(), size);
+        output += kStringSizeBytes + size;
+        break;
+      }
+      case LogArgument::Type::kDouble: {
+        const auto value = argument.getDouble();
+        std::memcpy(output, &value, kValueBytes);
+        output += kValueBytes;
+        break;
+      }
+      case LogArgument::Type::kSigned: {
+        const auto value = argument.getSigned();
+        std::memcpy(output, &value, kValueBytes);
+        output += kValueBytes;
+        break;
+      }
+      case LogArgument::Type::kNone:
+      case LogArgument::Type::kBool:
+      case LogArgument::Type::kChar:
+      case LogArgument::Type::kUnsigned: {
+        const auto value = argument.getUnsigned();
+        std::memcpy(output, &value, kValueBytes);
+        output += kValueBytes;
+        break;
+      }
+    }
+  }
+  return static_cast<size_t>(output - destination);
+}
+
+size_t CopyTruncated(const std::string& source, char* destination,
+                     size_t max_size) {
+  const auto size = std::min(source.size(), max_size);
+  std::memcpy(destination, source.data(), size);
+  destination[size] = '\0';
+  return size;
+}
+}  // namespace
+
+AsyncLogWriter::AsyncLogWriter(Configuration configuration,
+                               std::shared_ptr<const Censor> censor)
+    : configuration_(std::move(configuration)),
+      overflow_policy_(configuration_.getAsync()->overflowPolicy),
+      flush_interval_(configuration_.getAsync()->flushInterval),
+      mask_(RoundUpToPowerOfTwo(
+                std::max<size_t>(configuration_.getAsync()->queueSize, 2u)) -
+            1u),
+      max_message_size_(configuration_.getAsync()->maxMessageSize),
+      slots_(new Slot[mask_ + 1u]),
+      storage_((mask_ + 1u) * (kMaxTagSize + max_message_size_ + 2u)),
+      enqueue_pos_(0u),
+      dequeue_pos_(0u),
+      dropped_(0u),
+      censor_(std::move(censor)),
+      waiting_(false),
+      stopping_(false) {
+  for (size_t i = 0u; i <= mask_; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  thread_ = std::thread([this] { Run(); });
+}
+
+AsyncLogWriter::~AsyncLogWriter() { Stop(); }
+
+char* AsyncLogWriter::TagStorage(size_t index) {
+  return storage_.data() + index * (kMaxTagSize + max_message_size_ + 2u);
+}
+
+char* AsyncLogWriter::MessageStorage(size_t index) {
+  return TagStorage(index) + kMaxTagSize + 1u;
+}
+
+void AsyncLogWriter::Push(Level level, const std::string& tag,
+                          const std::string& message, const char* file,
+                          unsigned int line, const char* function,
+                          const char* full_function) {
+  const Payload payload = {&message, nullptr, nullptr, 0u};
+  PushPayload(level, tag, payload, file, line, function, full_function);
+}
+
+void AsyncLogWriter::PushRecord(Level level, const std::string& tag,
+                                const char* format,
+                                const LogArgument* arguments, size_t count,
+                                const char* file, unsigned int line,
+                                const char* function,
+                                const char* full_function) {
+  if (EncodedSize(arguments, count) > max_message_size_) {
+    Push(level, tag, LogArgument::format(format, arguments, count), file,
+         line, function, full_function);
+    return;
+  }
+
+  const Payload payload = {nullptr, format, arguments, count};
+  PushPayload(level, tag, payload, file, line, function, full_function);
+}
+
+void AsyncLogWriter::PushPayload(Level level, const std::string& tag,
+                                 const Payload& payload, const char* file,
+                                 unsigned int line, const char* function,
+                                 const char* full_function) {
+  while (!TryPush(level, tag, payload, file, line, function, full_function)) {
+    // The writer thread can't wait for itself, e.g. when an appender logs.
+    if (overflow_policy_ == Configuration::OverflowPolicy::DropNewest ||
+        t_is_writer_thread || stopping_.load(std::memory_order_relaxed)) {
+      dropped_.fetch_add(1u, std::memory_order_relaxed);
+      return;
+    }
+
+    Notify();
+    std::this_thread::yield();
+  }
+
+  Notify();
+}
+
+bool AsyncLogWriter::TryPush(Level level, const std::string& tag,
+                             const Payload& payload, const char* file,
+                             unsigned int line, const char* function,
+                             const char* full_function) {
+  auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Slot* slot = nullptr;
+  while (true) {
+    slot = &slots_[pos & mask_];
+    const auto sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                      static_cast<std::ptrdiff_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1u,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  const auto index = pos & mask_;
+  slot->level = level;
+  slot->line = line;
+  slot->file = file;
+  slot->function = function;
+  slot->full_function = full_function;
+  slot->time = std::chrono::system_clock::now();
+  slot->thread_id = getThreadId();
+  slot->tag_size = CopyTruncated(tag, TagStorage(index), kMaxTagSize);
+  slot->format = payload.format;
+  slot->argument_count = payload.count;
+  if (payload.format) {
+    slot->message_size = EncodeArguments(payload.arguments, payload.count,
+                                         MessageStorage(index));
+  } else {
+    slot->message_size = CopyTruncated(*payload.message,
+                                       MessageStorage(index),
+                                       max_message_size_);
+  }
+  slot->sequence.store(pos + 1u, std::memory_order_release);
+  return true;
+}
+
+bool AsyncLogWriter::HasMessages() const {
+  const auto& slot = slots_[dequeue_pos_ & mask_];
+  return slot.sequence.load(std::memory_order_acquire) == dequeue_pos_ + 1u;
+}
+
+void AsyncLogWriter::Notify() {
+  // Pairs with the fence in `Run`: either the writer sees the new message
+  // before it waits, or the producer sees the `waiting_` flag.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiting_.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    condition_.notify_one();
+  }
+}
+
+void AsyncLogWriter::SetCensor(std::shared_ptr<const Censor> censor) {
+  std::lock_guard<std::mutex> lock(censor_mutex_);
+  censor_.swap(censor);
+}
+
+void AsyncLogWriter::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_.store(true, std::memory_order_relaxed);
+    condition_.notify_one();
+  }
+
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void AsyncLogWriter::Run() {
+  utils::Thread::SetCurrentThreadName(kThreadName);
+  t_is_writer_thread = true;
+
+  while (true) {
+    Drain();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopping_.load(std::memory_order_relaxed)) {
+      break;
+    }
+
+    waiting_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!HasMessages()) {
+      condition_.wait_for(lock, flush_interval_);
+    }
+    waiting_.store(false, std::memory_order_relaxed);
+  }
+
+  Drain();
+}
+
+void AsyncLogWriter::Drain() {
+  std::shared_ptr<const Censor> censor;
+  {
+    std::lock_guard<std::mutex> lock(censor_mutex_);
+    censor = censor_;
+  }
+
+  size_t count = 0u;
+  while (HasMessages()) {
+    const auto index = dequeue_pos_ & mask_;
+    auto& slot = slots_[index];
+
+    const char* text = MessageStorage(index);
+    auto text_size = slot.message_size;
+    std::string formatted;
+    if (slot.format) {
+      formatted = FormatRecord(slot, text);
+      text = formatted.c_str();
+      text_size = formatted.size();
+    }
+
+    LogMessage message;
+    message.level = slot.level;
+    message.tag = TagStorage(index);
+    message.message = text;
+    message.file = slot.file;
+    message.line = slot.line;
+    message.function = slot.function;
+    message.fullFunction = slot.full_function;
+    message.time = slot.time;
+    message.threadId = slot.thread_id;
+
+    const auto censored = censor->Apply(text, text_size);
+    if (censored) {
+      message.message = censored->c_str();
+    }
+
+    Append(message);
+
+    slot.sequence.store(dequeue_pos_ + mask_ + 1u, std::memory_order_release);
+    ++dequeue_pos_;
+    ++count;
+  }
+
+  const auto dropped = dropped_.exchange(0u, std::memory_order_relaxed);
+  if (dropped > 0u) {
+    const auto text = "Dropped " + std::to_string(dropped) +
+                      " log messages, the queue is full";
+    LogMessage message;
+    message.level = Level::Warning;
+    message.tag = kLogTag;
+    message.message = text.c_str();
+    message.file = __FILE__;
+    message.line = __LINE__;
+    message.function = __FUNCTION__;
+    message.fullFunction = __FUNCTION__;
+    message.time = std::chrono::system_clock::now();
+    message.threadId = getThreadId();
+    Append(message);
+    ++count;
+  }
+
+  if (count > 0u) {
+    for (const auto& appender : configuration_.getAppenders()) {
+      appender.appender->flush();
+    }
+  }
+}
+
+std::string AsyncLogWriter::FormatRecord(const Slot& slot, const char* data) {
+  arguments_.clear();
+  for (size_t i = 0u; i < slot.argument_count; ++i) {
+    const auto type = static_cast<LogArgument::Type>(*data++);
+    switch (type) {
+      case LogArgument::Type::kString: {
+        uint32_t size = 0u;
+        std::memcpy(&size, data, kStringSizeBytes);
+        arguments_.emplace_back(data + kStringSizeBytes, size);
+        data += kStringSizeBytes + size;
+        break;
+      }
+      case LogArgument::Type::kDouble: {
+        double value = 0.0;
+        std::memcpy(&value, data, kValueBytes);
+        arguments_.emplace_back(value);
+        data += kValueBytes;
+        break;
+      }
+      case LogArgument::Type::kSigned: {
+        int64_t value = 0;
+        std::memcpy(&value, data, kValueBytes);
+        arguments_.emplace_back(value);
+        data += kValueBytes;
+        break;
+      }
+      case LogArgument::Type::kBool:
+      case LogArgument::Type::kChar:
+      case LogArgument::Type::kUnsigned: {
+        uint64_t value = 0u;
+        std::memcpy(&value, data, kValueBytes);
+        if (type == LogArgument::Type::kBool) {
+          arguments_.emplace_back(value != 0u);
+        } else if (type == LogArgument::Type::kChar) {
+          arguments_.emplace_back(static_cast<char>(value));
+        } else {
+          arguments_.emplace_back(value);
+        }
+        data += kValueBytes;
+        break;
+      }
+      case LogArgument::Type::kNone:
+        arguments_.emplace_back();
+        data += kValueBytes;
+        break;
+    }
+  }
+
+  return LogArgument::format(slot.format, arguments_.data(),
+                             arguments_.size());
+}
+
+void AsyncLogWriter::Append(const LogMessage& message) {
+  for (const auto& appender : configuration_.getAppenders()) {
+    if (appender.isEnabled(message.level)) {
+      appender.appender->append(message);
+    }
+  }
+}
+
+}  // namespace logging
+}  // namespace olp
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <olp/core/logging/Configuration.h>
+#include <olp/core/logging/LogArgument.h>
+#include "Censor.h"
+
+namespace olp {
+namespace logging {
+
+/**
+ * @brief Passes the log messages to the appenders on a background thread.
+ *
+ * The producers copy the messages into the preallocated slots of a bounded
+ * multi-producer, single-consumer ring without taking any lock. The
+ * background thread drains the ring in batches, censors the messages, calls
+ * the appenders, and flushes them once per batch.
+ */
+class AsyncLogWriter {
+ public:
+  /**
+   * @brief Creates the writer and starts its thread.
+   *
+   * @param configuration The appenders and the asynchronous settings.
+   * @param censor The censor of the messages.
+   */
+  AsyncLogWriter(Configuration configuration,
+                 std::shared_ptr<const Censor> censor);
+  ~AsyncLogWriter();
+
+  /// Queues the message, or drops it if the queue is full and the overflow
+  /// policy allows it.
+  void Push(Level level, const std::string& tag, const std::string& message,
+            const char* file, unsigned int line, const char* function,
+            const char* full_function);
+
+  /// Queues the structured message with the arguments encoded into the slot,
+  /// so the message is formatted on the writer thread. Formats the message
+  /// right away if the encoded arguments don't fit into the slot.
+  void PushRecord(Level level, const std::string& tag, const char* format,
+                  const LogArgument* arguments, size_t count,
+                  const char* file, unsigned int line, const char* function,
+                  const char* full_function);
+
+  /// Replaces the censor of the messages that are not yet written.
+  void SetCensor(std::shared_ptr<const Censor> censor);
+
+  /// Writes the queued messages and stops the thread. Messages pushed
+  /// afterwards are ignored.
+  void Stop();
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    Level level;
+    unsigned int line;
+    const char* file;
+    const char* function;
+    const char* full_function;
+    std::chrono::system_clock::time_point time;
+    unsigned long thread_id;
+    size_t tag_size;
+    /// The format of a structured message, `nullptr` for a formatted one.
+    const char* format;
+    /// The size of the message, or of the encoded arguments.
+    size_t message_size;
+    size_t argument_count;
+  };
+
+  /// Either the formatted message or the format and the arguments.
+  struct Payload {
+    const std::string* message;
+    const char* format;
+    const LogArgument* arguments;
+    size_t count;
+  };
+
+  void PushPayload(Level level, const std::string& tag, const Payload& payload,
+                   const char* file, unsigned int line, const char* function,
+                   const char* full_function);
+  bool TryPush(Level level, const std::string& tag, const Payload& payload,
+               const char* file, unsigned int line, const char* function,
+               const char* full_function);
+  std::string FormatRecord(const Slot& slot, const char* data);
+  bool HasMessages() const;
+  void Notify();
+  void Run();
+  void Drain();
+  void Append(const LogMessage& message);
+
+  char* TagStorage(size_t index);
+  char* MessageStorage(size_t index);
+
+  const Configuration configuration_;
+  const Configuration::OverflowPolicy overflow_policy_;
+  const std::chrono::milliseconds flush_interval_;
+  const size_t mask_;
+  const size_t max_message_size_;
+
+  std::unique_ptr<Slot[]> slots_;
+  std::vector<char> storage_;
+  std::atomic<size_t> enqueue_pos_;
+  size_t dequeue_pos_;
+  std::atomic<size_t> dropped_;
+  /// The decoded arguments, used only by the writer thread.
+  std::vector<LogArgument> arguments_;
+
+  std::mutex censor_mutex_;
+  std::shared_ptr<const Censor> censor_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::atomic<bool> waiting_;
+  std::atomic<bool> stopping_;
+  std::thread thread_;
+};
+
+}  // namespace logging
+}  // namespace olp
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "Censor.h"
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+namespace olp {
+namespace logging {
+
+namespace {
+constexpr auto kSecretMask = "*****";
+constexpr uint32_t kNoState = 0xFFFFFFFFu;
+}  // namespace
+
+Censor::Censor(const std::vector<std::string>& secrets)
+    : class_count_(1u), secret_count_(secrets.size()) {
+  std::fill(std::begin(byte_classes_), std::end(byte_classes_), 0u);
+  for (const auto& secret : secrets) {
+    for (const auto byte : secret) {
+      auto& byte_class = byte_classes_[static_cast<unsigned char>(byte)];
+      if (byte_class == 0u) {
+        byte_class = static_cast<uint16_t>(class_count_++);
+      }
+    }
+  }
+
+  // Build the trie of the secrets.
+  transitions_.assign(class_count_, kNoState);
+  match_lengths_.assign(1u, 0u);
+  match_secrets_.assign(1u, 0u);
+  for (size_t secret_index = 0u; secret_index < secrets.size();
+       ++secret_index) {
+    const auto& secret = secrets[secret_index];
+    if (secret.empty()) {
+      continue;
+    }
+
+    State state = 0u;
+    for (const auto byte : secret) {
+      const auto index = state * class_count_ +
+                         byte_classes_[static_cast<unsigned char>(byte)];
+      if (transitions_[index] == kNoState) {
+        transitions_[index] = static_cast<State>(match_lengths_.size());
+        transitions_.resize(transitions_.size() + class_count_, kNoState);
+        match_lengths_.push_back(0u);
+        match_secrets_.push_back(0u);
+      }
+      state = transitions_[index];
+    }
+    match_lengths_[state] = static_cast<uint32_t>(secret.size());
+    match_secrets_[state] = static_cast<uint32_t>(secret_index);
+  }
+
+  // Resolve the failure links breadth-first into a complete transition table.
+  failures_.assign(match_lengths_.size(), 0u);
+  outputs_.assign(match_lengths_.size(), kNoState);
+  std::queue<State> states;
+  for (size_t byte_class = 0u; byte_class < class_count_; ++byte_class) {
+    auto& next = transitions_[byte_class];
+    if (next == kNoState) {
+      next = 0u;
+    } else {
+      states.push(next);
+    }
+  }
+
+  while (!states.empty()) {
+    const auto state = states.front();
+    states.pop();
+
+    const auto failure = failures_[state];
+    outputs_[state] = match_lengths_[state] > 0u ? state : outputs_[failure];
+
+    for (size_t byte_class = 0u; byte_class < class_count_; ++byte_class) {
+      auto& next = transitions_[state * class_count_ + byte_class];
+      const auto fallback = transitions_[failure * class_count_ + byte_class];
+      if (next == kNoState) {
+        next = fallback;
+      } else {
+        failures_[next] = fallback;
+        states.push(next);
+      }
+    }
+  }
+}
+
+porting::optional<std::string> Censor::Apply(const char* message,
+                                             size_t size) const {
+  if (match_lengths_.size() == 1u) {
+    return porting::none;
+  }
+
+  // The merged ranges of the found secrets, ordered by their ends.
+  std::vector<std::pair<size_t, size_t>> ranges;
+  // The end of the last occurrence of every secret.
+  std::vector<size_t> secret_ends;
+  State state = 0u;
+  for (size_t i = 0u; i < size; ++i) {
+    state = Next(state, static_cast<unsigned char>(message[i]));
+    auto output = outputs_[state];
+    if (output == kNoState) {
+      continue;
+    }
+
+    if (secret_ends.empty()) {
+      secret_ends.resize(secret_count_, 0u);
+    }
+
+    // Take the longest secret ending here that doesn't overlap its previous
+    // occurrence, it covers the shorter ones.
+    for (; output != kNoState; output = outputs_[failures_[output]]) {
+      auto begin = i + 1u - match_lengths_[output];
+      auto& secret_end = secret_ends[match_secrets_[output]];
+      if (begin < secret_end) {
+        continue;
+      }
+      secret_end = i + 1u;
+
+      while (!ranges.empty() && begin < ranges.back().second) {
+        begin = std::min(begin, ranges.back().first);
+        ranges.pop_back();
+      }
+      ranges.emplace_back(begin, i + 1u);
+      break;
+    }
+  }
+
+  if (ranges.empty()) {
+    return porting::none;
+  }
+
+  std::string censored;
+  size_t position = 0u;
+  for (const auto& range : ranges) {
+    censored.append(message + position, range.first - position);
+    censored.append(kSecretMask);
+    position = range.second;
+  }
+  censored.append(message + position, size - position);
+
+  return censored;
+}
+
+}  // namespace logging
+}  // namespace olp
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <olp/core/porting/optional.h>
+
+namespace olp {
+namespace logging {
+
+/**
+ * @brief Hides secrets in the log messages.
+ *
+ * The secrets are compiled into an Aho-Corasick automaton, so a message is
+ * scanned once regardless of the number of secrets. The automaton is a dense
+ * transition table over the byte classes that occur in the secrets.
+ *
+ * The secrets are matched on the original message. The occurrences of
+ * a secret are found without overlapping, as with a repeated `find`. Every
+ * occurrence is replaced with a mask, and the occurrences of different
+ * secrets that overlap share one mask.
+ */
+class Censor {
+ public:
+  /**
+   * @brief Compiles the secrets.
+   *
+   * @param secrets The strings to hide. Empty strings are ignored.
+   */
+  explicit Censor(const std::vector<std::string>& secrets);
+
+  /**
+   * @brief Replaces the secrets in the message with a mask.
+   *
+   * @param message The message.
+   * @param size The size of the message.
+   *
+   * @return The censored copy of the message if it contains any of the
+   * secrets; an empty optional otherwise.
+   */
+  porting::optional<std::string> Apply(const char* message,
+                                       size_t size) const;
+
+ private:
+  using State = uint32_t;
+
+  State Next(State state, unsigned char byte) const {
+    return transitions_[state * class_count_ + byte_classes_[byte]];
+  }
+
+  /// Maps every byte to its class, 0 for the bytes not used by the secrets.
+  uint16_t byte_classes_[256];
+  size_t class_count_;
+  /// The transitions of the states, `class_count_` entries per state.
+  std::vector<State> transitions_;
+  /// The failure links of the states.
+  std::vector<State> failures_;
+  /// The nearest state among the state and its failure links that completes
+  /// a secret.
+  std::vector<State> outputs_;
+  /// The length of the secret completed in the state, or 0.
+  std::vector<uint32_t> match_lengths_;
+  /// The index of the secret completed in the state.
+  std::vector<uint32_t> match_secrets_;
+  size_t secret_count_;
+};
+
+}  // namespace logging
+}  // namespace olp
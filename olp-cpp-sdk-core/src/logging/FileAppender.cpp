@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,7 +44,12 @@ bool FileAppender::isValid() const { return m_stream.good(); }
 IAppender& FileAppender::append(const LogMessage& message) {
   if (!isValid()) return *this;
 
-  m_stream << m_formatter.format(message) << std::endl;
+  m_stream << m_formatter.format(message) << '\n';
+  return *this;
+}
+
+IAppender& FileAppender::flush() {
+  m_stream.flush();
   return *this;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 
 #include <olp/core/logging/Log.h>
 
+#include "AsyncLogWriter.h"
+#include "Censor.h"
 #include "ThreadId.h"
 
 #include <olp/core/logging/Configuration.h>
@@ -27,16 +29,96 @@
 #include <olp/core/thread/Atomic.h>
 
 #include <algorithm>
-#include <cstring>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace olp {
 namespace logging {
 
 namespace {
-constexpr auto kSecretMask = "*****";
-const auto kSecretMaskLength = std::strlen(kSecretMask);
+/// The writer of the asynchronous mode. Read without the `LogImpl` lock, so
+/// the messages are queued without blocking on other threads.
+std::atomic<AsyncLogWriter*> g_async_writer{nullptr};
+
+/// The number of producers that may still use the writer they loaded. A
+/// replaced writer is stopped and freed only once there are none.
+std::atomic<size_t> g_async_producers{0u};
+
+/// Passes the message to the asynchronous writer. Returns false if there is
+/// no writer, so the message is written synchronously.
+template <typename PushFunc>
+bool pushAsync(const PushFunc& push) {
+  // Sequentially consistent, so either the producer is counted before the
+  // writer is replaced, or it loads the new writer.
+  g_async_producers.fetch_add(1u);
+  auto* async_writer = g_async_writer.load();
+  if (async_writer) {
+    push(*async_writer);
+  }
+  g_async_producers.fetch_sub(1u, std::memory_order_release);
+  return async_writer != nullptr;
+}
+
+/// Waits for the producers that may use a writer that is no longer set. The
+/// new producers do not wait, as they see no writer and count themselves out
+/// before taking the `LogImpl` lock.
+void waitForAsyncProducers() {
+  while (g_async_producers.load() != 0u) {
+    std::this_thread::yield();
+  }
+}
+
+/// A summary of the log levels that answers most of the level checks with
+/// a single atomic load. Bits 0-7 hold the default level, bits 8-15 and
+/// 16-23 the lowest and the highest level set for a tag.
+constexpr uint32_t kHasTagLevels = 1u << 24;
+std::atomic<uint32_t> g_level_summary{static_cast<uint32_t>(Level::Debug)};
+
+/// Incremented on every change of the levels, which invalidates the
+/// `LogLevelCache` instances. Only the low `kGenerationBits` are compared.
+constexpr uint32_t kGenerationBits = 24u;
+constexpr uint32_t kGenerationMask = (1u << kGenerationBits) - 1u;
+std::atomic<uint32_t> g_level_generation{1u};
+
+/// Packs the `LogLevelCache` state: the generation in the bits 40-63, the
+/// enabled levels in the bits 32-39, and the low bits of the tag address.
+uint64_t packLevelCache(uint32_t generation, uint32_t levels,
+                        const char* tag) {
+  return (static_cast<uint64_t>(generation & kGenerationMask) << 40) |
+         (static_cast<uint64_t>(levels & 0xFFu) << 32) |
+         static_cast<uint64_t>(reinterpret_cast<uintptr_t>(tag) & 0xFFFFFFFFu);
+}
+
+enum class LevelCheck { kDisabled, kEnabled, kUnknown };
+
+LevelCheck checkLevel(Level level) {
+  if (level == Level::Off) {
+    return LevelCheck::kDisabled;
+  }
+
+  const auto summary = g_level_summary.load(std::memory_order_acquire);
+  const auto value = static_cast<uint32_t>(level);
+  const auto default_level = summary & 0xFFu;
+  if ((summary & kHasTagLevels) == 0u) {
+    return value >= default_level ? LevelCheck::kEnabled
+                                  : LevelCheck::kDisabled;
+  }
+
+  const auto lowest = std::min(default_level, (summary >> 8) & 0xFFu);
+  const auto highest = std::max(default_level, (summary >> 16) & 0xFFu);
+  if (value < lowest) {
+    return LevelCheck::kDisabled;
+  }
+  if (value >= highest) {
+    return LevelCheck::kEnabled;
+  }
+  return LevelCheck::kUnknown;
+}
 }  // namespace
 
 struct LogMessageExt : public LogMessage {
@@ -72,9 +154,11 @@ class LogImpl {
   void clearLevel(const std::string& tag);
   void clearLevels();
 
-  bool isEnabled(Level level) const;
   bool isEnabled(Level level, const std::string& tag) const;
 
+  /// Gets the bit mask of the levels enabled for the tag.
+  uint32_t getEnabledLevels(const std::string& tag) const;
+
   void logMessage(Level level, const std::string& tag,
                   const std::string& message, const char* file,
                   unsigned int line, const char* function,
@@ -91,17 +175,29 @@ class LogImpl {
   template <class LogItem>
   void censorLogItem(LogItem& log_item, const std::string& original);
 
+  void replaceAsyncWriter();
+  void updateLevelSummary();
+  void updateCensor();
+
   Configuration m_configuration;
   std::unordered_map<std::string, Level> m_logLevels;
   Level m_defaultLevel;
   std::vector<std::string> m_toCensor;
+  std::shared_ptr<const Censor> m_censor;
+  std::unique_ptr<AsyncLogWriter> m_asyncWriter;
 };
 
 LogImpl::LogImpl()
     : m_configuration(Configuration::createDefault()),
-      m_defaultLevel(Level::Debug) {}
-
-LogImpl::~LogImpl() { aliveStatus() = false; }
+      m_defaultLevel(Level::Debug),
+      m_censor(std::make_shared<Censor>(m_toCensor)) {}
+
+LogImpl::~LogImpl() {
+  aliveStatus() = false;
+  g_async_writer.store(nullptr);
+  waitForAsyncProducers();
+  m_asyncWriter.reset();
+}
 
 bool& LogImpl::aliveStatus() {
   static bool s_alive = true;
@@ -119,14 +215,34 @@ bool LogImpl::configure(Configuration configuration) {
   const bool is_valid = configuration.isValid();
   if (is_valid) {
     m_configuration = std::move(configuration);
+    replaceAsyncWriter();
   }
 
   return is_valid;
 }
 
+void LogImpl::replaceAsyncWriter() {
+  // The new messages go to the synchronous path, which waits for the lock
+  // held here. The old writer is stopped once its producers are done, so it
+  // writes all their messages before it is freed.
+  g_async_writer.store(nullptr);
+  if (m_asyncWriter) {
+    waitForAsyncProducers();
+    m_asyncWriter.reset();
+  }
+
+  if (m_configuration.getAsync()) {
+    m_asyncWriter.reset(new AsyncLogWriter(m_configuration, m_censor));
+    g_async_writer.store(m_asyncWriter.get());
+  }
+}
+
 Configuration LogImpl::getConfiguration() const { return m_configuration; }
 
-void LogImpl::setLevel(Level level) { m_defaultLevel = level; }
+void LogImpl::setLevel(Level level) {
+  m_defaultLevel = level;
+  updateLevelSummary();
+}
 
 Level LogImpl::getLevel() const { return m_defaultLevel; }
 
@@ -137,6 +253,7 @@ void LogImpl::setLevel(Level level, const std::string& tag) {
   }
 
   m_logLevels[tag] = level;
+  updateLevelSummary();
 }
 
 porting::optional<Level> LogImpl::getLevel(const std::string& tag) const {
@@ -155,15 +272,39 @@ void LogImpl::clearLevel(const std::string& tag) {
     return;
 
   m_logLevels.erase(tag);
+  updateLevelSummary();
 }
 
-void LogImpl::clearLevels() { m_logLevels.clear(); }
+void LogImpl::clearLevels() {
+  m_logLevels.clear();
+  updateLevelSummary();
+}
 
-bool LogImpl::isEnabled(Level level) const {
-  if (level == Level::Off)
-    return false;
+void LogImpl::updateLevelSummary() {
+  auto summary = static_cast<uint32_t>(m_defaultLevel);
+  if (!m_logLevels.empty()) {
+    uint32_t lowest = 0xFFu;
+    uint32_t highest = 0u;
+    for (const auto& tag_level : m_logLevels) {
+      const auto value = static_cast<uint32_t>(tag_level.second);
+      lowest = std::min(lowest, value);
+      highest = std::max(highest, value);
+    }
+    summary |= (lowest << 8) | (highest << 16) | kHasTagLevels;
+  }
 
-  return static_cast<int>(level) >= static_cast<int>(m_defaultLevel);
+  g_level_summary.store(summary, std::memory_order_release);
+  g_level_generation.fetch_add(1u, std::memory_order_release);
+}
+
+uint32_t LogImpl::getEnabledLevels(const std::string& tag) const {
+  uint32_t levels = 0u;
+  for (uint32_t level = 0u; level < levelCount; ++level) {
+    if (isEnabled(static_cast<Level>(level), tag)) {
+      levels |= 1u << level;
+    }
+  }
+  return levels;
 }
 
 bool LogImpl::isEnabled(Level level, const std::string& tag) const {
@@ -201,30 +342,18 @@ void LogImpl::logMessage(Level level, const std::string& tag,
 template <class LogItem>
 void LogImpl::appendLogItem(const LogItem& log_item) {
   for (const auto& appender_with_log_level : m_configuration.getAppenders()) {
-    if (appender_with_log_level.isEnabled(log_item.level))
+    if (appender_with_log_level.isEnabled(log_item.level)) {
       appender_with_log_level.appender->append(log_item);
+      appender_with_log_level.appender->flush();
+    }
   }
 }
 
 template <class LogItem>
 void LogImpl::censorLogItem(LogItem& log_item, const std::string& original) {
-  bool has_copy = log_item.adjusted_message.has_value();
-  const std::string& src =
-      has_copy ? log_item.adjusted_message.value() : original;
-
-  for (const std::string& secret : m_toCensor) {
-    auto found_pos = src.find(secret);
-    while (found_pos != std::string::npos) {
-      if (!has_copy) {
-        log_item.adjusted_message = original;
-        has_copy = true;
-        log_item.message = log_item.adjusted_message.value().c_str();
-      }
-      log_item.adjusted_message.value().replace(found_pos, secret.length(),
-                                                kSecretMask);
-      found_pos = log_item.adjusted_message.value().find(
-          secret, found_pos + kSecretMaskLength);
-    }
+  log_item.adjusted_message = m_censor->Apply(original.data(), original.size());
+  if (log_item.adjusted_message) {
+    log_item.message = log_item.adjusted_message.value().c_str();
   }
 }
 
@@ -234,6 +363,7 @@ void LogImpl::addCensor(const std::string& msg) {
   }
 
   m_toCensor.emplace_back(msg);
+  updateCensor();
 }
 
 void LogImpl::removeCensor(const std::string& msg) {
@@ -244,6 +374,14 @@ void LogImpl::removeCensor(const std::string& msg) {
   auto it = std::find(m_toCensor.begin(), m_toCensor.end(), msg);
   if (it != m_toCensor.end()) {
     m_toCensor.erase(it);
+    updateCensor();
+  }
+}
+
+void LogImpl::updateCensor() {
+  m_censor = std::make_shared<Censor>(m_toCensor);
+  if (m_asyncWriter) {
+    m_asyncWriter->SetCensor(m_censor);
   }
 }
 
@@ -340,21 +478,67 @@ void Log::applyFilterGroup(const FilterGroup& filters) {
 }
 
 bool Log::isEnabled(Level level) {
-  if (!LogImpl::aliveStatus())
+  if (!LogImpl::aliveStatus() || level == Level::Off)
     return false;
 
-  return LogImpl::getInstance().locked(
-      [level](const LogImpl& log) { return log.isEnabled(level); });
+  const auto summary = g_level_summary.load(std::memory_order_acquire);
+  return static_cast<uint32_t>(level) >= (summary & 0xFFu);
 }
 
 bool Log::isEnabled(Level level, const std::string& tag) {
   if (!LogImpl::aliveStatus())
     return false;
 
+  const auto check = checkLevel(level);
+  if (check != LevelCheck::kUnknown)
+    return check == LevelCheck::kEnabled;
+
   return LogImpl::getInstance().locked(
       [level, &tag](const LogImpl& log) { return log.isEnabled(level, tag); });
 }
 
+bool Log::isEnabled(Level level, const char* tag) {
+  if (!LogImpl::aliveStatus())
+    return false;
+
+  const auto check = checkLevel(level);
+  if (check != LevelCheck::kUnknown)
+    return check == LevelCheck::kEnabled;
+
+  const std::string tag_string(tag ? tag : "");
+  return LogImpl::getInstance().locked([level, &tag_string](
+                                           const LogImpl& log) {
+    return log.isEnabled(level, tag_string);
+  });
+}
+
+bool LogLevelCache::isEnabled(Level level, const char* tag) {
+  if (!LogImpl::aliveStatus())
+    return false;
+
+  const auto check = checkLevel(level);
+  if (check != LevelCheck::kUnknown)
+    return check == LevelCheck::kEnabled;
+
+  const auto level_bit = 1u << static_cast<uint32_t>(level);
+  const auto generation = g_level_generation.load(std::memory_order_acquire);
+  const auto state = state_.load(std::memory_order_relaxed);
+  if (state == packLevelCache(generation, static_cast<uint32_t>(state >> 32),
+                              tag)) {
+    return ((state >> 32) & level_bit) != 0u;
+  }
+
+  // The generation is read under the lock, as the levels change under it.
+  const std::string tag_string(tag ? tag : "");
+  uint32_t levels = 0u;
+  LogImpl::getInstance().locked([&](const LogImpl& log) {
+    levels = log.getEnabledLevels(tag_string);
+    state_.store(packLevelCache(g_level_generation.load(), levels, tag),
+                 std::memory_order_relaxed);
+  });
+  return (levels & level_bit) != 0u;
+}
+
 void Log::logMessage(Level level, const std::string& tag,
                      const std::string& message, const char* file,
                      unsigned int line, const char* function,
@@ -362,6 +546,34 @@ void Log::logMessage(Level level, const std::string& tag,
   if (!LogImpl::aliveStatus())
     return;
 
+  const auto pushed = pushAsync([&](AsyncLogWriter& async_writer) {
+    async_writer.Push(level, tag, message, file, line, function, fullFunction);
+  });
+  if (pushed) {
+    return;
+  }
+
+  LogImpl::getInstance().locked([&](LogImpl& log) {
+    log.logMessage(level, tag, message, file, line, function, fullFunction);
+  });
+}
+
+void Log::logRecord(Level level, const std::string& tag, const char* format,
+                     const LogArgument* arguments, size_t count,
+                     const char* file, unsigned int line,
+                     const char* function, const char* fullFunction) {
+  if (!LogImpl::aliveStatus())
+    return;
+
+  const auto pushed = pushAsync([&](AsyncLogWriter& async_writer) {
+    async_writer.PushRecord(level, tag, format, arguments, count, file, line,
+                            function, fullFunction);
+  });
+  if (pushed) {
+    return;
+  }
+
+  const auto message = LogArgument::format(format, arguments, count);
   LogImpl::getInstance().locked([&](LogImpl& log) {
     log.logMessage(level, tag, message, file, line, function, fullFunction);
   });
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <olp/core/logging/LogArgument.h>
+
+#include <cstdio>
+
+namespace olp {
+namespace logging {
+
+void LogArgument::appendTo(std::string& output) const {
+  switch (type_) {
+    case Type::kNone:
+      break;
+    case Type::kBool:
+      output.append(value_.unsigned_value ? "true" : "false");
+      break;
+    case Type::kChar:
+      output.push_back(static_cast<char>(value_.unsigned_value));
+      break;
+    case Type::kSigned:
+      output.append(
+          std::to_string(static_cast<long long>(value_.signed_value)));
+      break;
+    case Type::kUnsigned:
+      output.append(std::to_string(
+          static_cast<unsigned long long>(value_.unsigned_value)));
+      break;
+    case Type::kDouble: {
+      char buffer[32];
+      const auto size = std::snprintf(buffer, sizeof(buffer), "%g",
+                                      value_.double_value);
+      if (size > 0) {
+        output.append(buffer, static_cast<size_t>(size));
+      }
+      break;
+    }
+    case Type::kString:
+      output.append(value_.string_value.data, value_.string_value.size);
+      break;
+  }
+}
+
+std::string LogArgument::format(const char* format,
+                                const LogArgument* arguments, size_t count) {
+  std::string result;
+  if (format == nullptr) {
+    return result;
+  }
+
+  size_t next_argument = 0u;
+  const char* text = format;
+  for (const char* it = format; *it != '\0'; ++it) {
+    const bool placeholder = it[0] == '{' && it[1] == '}';
+    const bool escape =
+        (it[0] == '{' && it[1] == '{') || (it[0] == '}' && it[1] == '}');
+    if (!escape && (!placeholder || next_argument == count)) {
+      continue;
+    }
+
+    result.append(text, it);
+    if (escape) {
+      result.push_back(it[0]);
+    } else {
+      arguments[next_argument++].appendTo(result);
+    }
+    ++it;
+    text = it + 1;
+  }
+  result.append(text);
+
+  return result;
+}
+
+}  // namespace logging
+}  // namespace olp
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+namespace olp {
+namespace thread {
+
+/// Receives the blocking regions entered by the tasks of a worker thread.
+class BlockingRegionHandler {
+ public:
+  /// Called when the current thread enters the outermost blocking region.
+  virtual void OnBlockingBegin() = 0;
+
+  /// Called when the current thread leaves the outermost blocking region.
+  virtual void OnBlockingEnd() = 0;
+
+ protected:
+  ~BlockingRegionHandler() = default;
+};
+
+/**
+ * @brief Sets the handler of the blocking regions of the current thread.
+ *
+ * @param handler The handler, or `nullptr` to ignore the regions. Must
+ * outlive the tasks executed on the thread.
+ */
+void SetBlockingRegionHandler(BlockingRegionHandler* handler);
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <olp/core/porting/make_unique.h>
+
+namespace olp {
+namespace thread {
+
+/**
+ * @brief FIFO aware priority queue with a bucket per priority.
+ *
+ * Elements with the same priority are kept in a FIFO bucket, and the buckets
+ * are ordered by priority, highest first. Unlike `PriorityQueueExtended`, the
+ * elements are never moved around a heap: push and pop are O(1) for the
+ * priorities that already have a bucket, which is the common case with the
+ * `LOW`, `NORMAL` and `HIGH` priorities. A new priority costs a binary search
+ * and an insertion into the bucket list.
+ *
+ * @tparam T The element type.
+ * @tparam PRIORITY The functor that returns the `uint32_t` priority of an
+ * element.
+ */
+template <class T, class PRIORITY>
+class BucketedPriorityQueue {
+ public:
+  /// Constructor
+  explicit BucketedPriorityQueue(const PRIORITY& priority = PRIORITY());
+
+  /// Check for queue emptiness
+  bool empty() const;
+
+  /// The number of elements in the queue
+  size_t size() const;
+
+  /// Push copy of an object in priority queue
+  void push(const T& value);
+
+  /// Push a moveable object in priority queue
+  void push(T&& value);
+
+  /// Getter for front element in queue (with highest priority)
+  T& front();
+
+  /// Const getter for front element in queue (with highest priority)
+  const T& front() const;
+
+  /// Remove top element from queue
+  void pop();
+
+ private:
+  struct Bucket {
+    explicit Bucket(std::uint32_t priority) : priority(priority) {}
+
+    std::uint32_t priority;
+    std::deque<T> elements;
+  };
+
+  /// Gets the index of the bucket of the priority, creates it if needed.
+  size_t GetBucket(std::uint32_t priority);
+
+  /// The empty buckets kept for reuse before they are removed.
+  static constexpr size_t kMaxIdleBuckets = 8u;
+
+  /// The buckets ordered by priority, highest first. Stored by pointer, so
+  /// inserting a bucket does not move the elements of the others.
+  std::vector<std::unique_ptr<Bucket>> buckets_;
+  /// The index of the first non-empty bucket, valid if not empty.
+  size_t top_ = 0u;
+  /// The number of elements in all the buckets.
+  size_t size_ = 0u;
+  /// The index of the last used bucket, checked before the search.
+  size_t last_ = 0u;
+  PRIORITY priority_;
+};
+
+template <class T, class PRIORITY>
+constexpr size_t BucketedPriorityQueue<T, PRIORITY>::kMaxIdleBuckets;
+
+template <class T, class PRIORITY>
+BucketedPriorityQueue<T, PRIORITY>::BucketedPriorityQueue(
+    const PRIORITY& priority)
+    : priority_(priority) {}
+
+template <class T, class PRIORITY>
+bool BucketedPriorityQueue<T, PRIORITY>::empty() const {
+  return size_ == 0u;
+}
+
+template <class T, class PRIORITY>
+size_t BucketedPriorityQueue<T, PRIORITY>::size() const {
+  return size_;
+}
+
+template <class T, class PRIORITY>
+void BucketedPriorityQueue<T, PRIORITY>::push(const T& value) {
+  push(T(value));
+}
+
+template <class T, class PRIORITY>
+void BucketedPriorityQueue<T, PRIORITY>::push(T&& value) {
+  const auto index = GetBucket(priority_(value));
+  buckets_[index]->elements.push_back(std::move(value));
+
+  if (size_ == 0u || index < top_) {
+    top_ = index;
+  }
+  ++size_;
+}
+
+template <class T, class PRIORITY>
+T& BucketedPriorityQueue<T, PRIORITY>::front() {
+  return buckets_[top_]->elements.front();
+}
+
+template <class T, class PRIORITY>
+const T& BucketedPriorityQueue<T, PRIORITY>::front() const {
+  return buckets_[top_]->elements.front();
+}
+
+template <class T, class PRIORITY>
+void BucketedPriorityQueue<T, PRIORITY>::pop() {
+  if (size_ == 0u) {
+    return;
+  }
+
+  auto& elements = buckets_[top_]->elements;
+  elements.pop_front();
+  --size_;
+
+  if (!elements.empty()) {
+    return;
+  }
+
+  // Remove the bucket of a rarely used priority, so arbitrary priorities do
+  // not accumulate empty buckets.
+  if (buckets_.size() > kMaxIdleBuckets) {
+    buckets_.erase(buckets_.begin() + top_);
+    last_ = 0u;
+  } else {
+    ++top_;
+  }
+
+  while (size_ > 0u && buckets_[top_]->elements.empty()) {
+    ++top_;
+  }
+}
+
+template <class T, class PRIORITY>
+size_t BucketedPriorityQueue<T, PRIORITY>::GetBucket(std::uint32_t priority) {
+  if (last_ < buckets_.size() && buckets_[last_]->priority == priority) {
+    return last_;
+  }
+
+  const auto it = std::lower_bound(
+      buckets_.begin(), buckets_.end(), priority,
+      [](const std::unique_ptr<Bucket>& bucket, std::uint32_t priority) {
+        return bucket->priority > priority;
+      });
+  const auto index = static_cast<size_t>(it - buckets_.begin());
+
+  if (it == buckets_.end() || (*it)->priority != priority) {
+    buckets_.insert(it, std::make_unique<Bucket>(priority));
+    if (size_ > 0u && index <= top_) {
+      ++top_;
+    }
+  }
+
+  last_ = index;
+  return index;
+}
+
+}  // namespace thread
+}  // namespace olp
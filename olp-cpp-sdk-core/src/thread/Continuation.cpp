@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 HERE Europe B.V.
+ * Copyright (C) 2022-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,9 +20,12 @@
 #include <olp/core/thread/Continuation.h>
 
 #include <atomic>
+#include <deque>
+#include <iterator>
 #include <memory>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <olp/core/client/CancellationToken.h>
 #include <olp/core/thread/SyncQueue.h>
@@ -41,7 +44,7 @@ class Processor {
 
  public:
   Processor(ExecutionContext execution_context,
-            std::deque<ContinuationImpl::ContinuationTask> tasks,
+            std::vector<ContinuationImpl::ContinuationTask> tasks,
             ContinuationImpl::FinalCallbackType final_callback)
       : processor_(std::make_shared<ProcessorInternal>(
             std::move(tasks), std::move(final_callback),
@@ -138,10 +141,11 @@ class Processor {
     // an execution
     ExecutionContext public_execution_context_;
 
-    ProcessorInternal(std::deque<ContinuationImpl::ContinuationTask> tasks,
+    ProcessorInternal(std::vector<ContinuationImpl::ContinuationTask> tasks,
                       ContinuationImpl::FinalCallbackType&& final_callback,
                       ExecutionContext execution_context)
-        : tasks_(std::move(tasks)),
+        : tasks_(std::make_move_iterator(tasks.begin()),
+                 std::make_move_iterator(tasks.end())),
           final_callback_(std::move(final_callback)),
           public_execution_context_(execution_context) {}
 
@@ -167,6 +171,11 @@ ContinuationImpl::ContinuationImpl(
   }
 }
 
+ContinuationImpl::ContinuationImpl(
+    std::shared_ptr<TaskScheduler> task_scheduler, ExecutionContext context)
+    : task_scheduler_(std::move(task_scheduler)),
+      execution_context_(std::move(context)) {}
+
 ContinuationImpl ContinuationImpl::Then(ContinuationTask task) {
   if (change_allowed) {
     tasks_.push_back(std::move(task));
@@ -185,6 +194,13 @@ void ContinuationImpl::Run(FinalCallbackType callback) {
   }
 }
 
+void ContinuationImpl::Start(std::function<void()> task) {
+  if (change_allowed) {
+    change_allowed = false;
+    task_scheduler_->ScheduleTask(std::move(task));
+  }
+}
+
 const ExecutionContext& ContinuationImpl::GetExecutionContext() const {
   return execution_context_;
 }
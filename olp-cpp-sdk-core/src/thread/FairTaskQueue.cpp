@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "thread/FairTaskQueue.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace olp {
+namespace thread {
+
+namespace {
+/// The stride of a group with weight one.
+constexpr uint64_t kStride = 1u << 20;
+
+/// The number of groups kept while they have no tasks, so the groups in use
+/// do not allocate their queues again.
+constexpr size_t kMaxGroups = 64u;
+}  // namespace
+
+bool FairTaskQueue::empty() const { return size_ == 0u; }
+
+size_t FairTaskQueue::size() const { return size_; }
+
+void FairTaskQueue::push(PrioritizedTask&& task) {
+  auto& group = groups_[task.group];
+  if (group.tasks.empty()) {
+    group.id = task.group;
+    group.pass = std::max(group.pass, pass_);
+    active_.push_back(&group);
+  }
+
+  // The latest weight of the group is used.
+  group.stride = kStride / std::max(task.group_weight, 1u);
+  group.tasks.push(std::move(task));
+  ++size_;
+}
+
+PrioritizedTask FairTaskQueue::pop() {
+  auto& group = Select();
+  auto task = std::move(group.tasks.front());
+  group.tasks.pop();
+  --size_;
+
+  pass_ = group.pass;
+  group.pass += group.stride;
+
+  if (group.tasks.empty()) {
+    active_.erase(std::find(active_.begin(), active_.end(), &group));
+    if (groups_.size() > kMaxGroups) {
+      groups_.erase(group.id);
+    }
+  }
+
+  return task;
+}
+
+FairTaskQueue::Group& FairTaskQueue::Select() {
+  auto selected = active_.front();
+  for (auto it = active_.begin() + 1; it != active_.end(); ++it) {
+    const auto priority = (*it)->tasks.front().priority;
+    const auto selected_priority = selected->tasks.front().priority;
+    if (priority > selected_priority ||
+        (priority == selected_priority && (*it)->pass < selected->pass)) {
+      selected = *it;
+    }
+  }
+  return *selected;
+}
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "thread/BucketedPriorityQueue.h"
+#include "thread/PrioritizedTask.h"
+
+namespace olp {
+namespace thread {
+
+/**
+ * @brief The task queue that shares the execution fairly between
+ * the scheduling groups.
+ *
+ * Each group has its own `BucketedPriorityQueue`, so the priorities and
+ * the FIFO order are kept within a group. The next task is the highest
+ * priority task of all the groups. When several groups have a task of that
+ * priority, the group with the smallest pass goes first, and its pass grows by
+ * the stride inversely proportional to its weight (stride scheduling). A group
+ * joining the queue starts at the current pass, so it does not catch up for
+ * the time it was idle.
+ *
+ * A limited number of the empty groups is kept, so the queue does not grow
+ * with the number of the groups that were ever used.
+ */
+class FairTaskQueue {
+ public:
+  /// Checks whether the queue is empty.
+  bool empty() const;
+
+  /// The number of tasks in the queue.
+  size_t size() const;
+
+  /// Pushes the task to the queue of its group.
+  void push(PrioritizedTask&& task);
+
+  /// Removes the next task from the queue and returns it. Must not be empty.
+  PrioritizedTask pop();
+
+ private:
+  struct Group {
+    BucketedPriorityQueue<PrioritizedTask, GetTaskPriority> tasks;
+    uint64_t id{0u};
+    uint64_t stride{1u};
+    uint64_t pass{0u};
+  };
+
+  /// Selects the group of the next task.
+  Group& Select();
+
+  std::unordered_map<uint64_t, Group> groups_;
+  /// The groups with tasks.
+  std::vector<Group*> active_;
+  /// The pass of the last selected group.
+  uint64_t pass_{0u};
+  size_t size_{0u};
+};
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace olp {
+namespace thread {
+
+/**
+ * @brief A move-only task that keeps small callables in an inline buffer.
+ *
+ * Unlike `std::function`, it does not require the callable to be copyable,
+ * and it stores the callables up to `kCapacity` bytes without a heap
+ * allocation, e.g. a `std::function` together with a `std::shared_ptr`.
+ * Larger callables, and the ones that might throw on move, are allocated on
+ * the heap.
+ */
+class InplaceTask final {
+ public:
+  /// The size of the inline buffer.
+  static constexpr size_t kCapacity = 64u;
+
+  InplaceTask() = default;
+
+  /// Creates the task from a callable with the `void()` signature.
+  template <class Function,
+            typename std::enable_if<!std::is_same<
+                typename std::decay<Function>::type,
+                InplaceTask>::value>::type* = nullptr>
+  InplaceTask(Function&& function) {  // NOLINT: implicit like std::function
+    using Callable = typename std::decay<Function>::type;
+    Holder<Callable, IsInline<Callable>::value>::Create(
+        storage_, std::forward<Function>(function));
+    operations_ = &Holder<Callable, IsInline<Callable>::value>::kOperations;
+  }
+
+  InplaceTask(InplaceTask&& other) noexcept { MoveFrom(other); }
+
+  InplaceTask& operator=(InplaceTask&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  InplaceTask& operator=(std::nullptr_t) noexcept {
+    Reset();
+    return *this;
+  }
+
+  InplaceTask(const InplaceTask&) = delete;
+  InplaceTask& operator=(const InplaceTask&) = delete;
+
+  ~InplaceTask() { Reset(); }
+
+  /// Checks whether the task holds a callable.
+  explicit operator bool() const { return operations_ != nullptr; }
+
+  /// Executes the task. The task must not be empty.
+  void operator()() { operations_->invoke(storage_); }
+
+ private:
+  using Storage = typename std::aligned_storage<kCapacity>::type;
+
+  struct Operations {
+    void (*invoke)(Storage&);
+    /// Moves the callable to the empty storage and destroys the source.
+    void (*relocate)(Storage& from, Storage& to);
+    void (*destroy)(Storage&);
+  };
+
+  template <class Callable>
+  struct IsInline
+      : std::integral_constant<
+            bool, sizeof(Callable) <= sizeof(Storage) &&
+                      alignof(Storage) % alignof(Callable) == 0u &&
+                      std::is_nothrow_move_constructible<Callable>::value> {};
+
+  template <class Callable, bool Inline>
+  struct Holder;
+
+  void MoveFrom(InplaceTask& other) noexcept {
+    if (other.operations_) {
+      other.operations_->relocate(other.storage_, storage_);
+      operations_ = other.operations_;
+      other.operations_ = nullptr;
+    }
+  }
+
+  void Reset() noexcept {
+    if (operations_) {
+      operations_->destroy(storage_);
+      operations_ = nullptr;
+    }
+  }
+
+  Storage storage_;
+  const Operations* operations_{nullptr};
+};
+
+/// Keeps the callable in the inline buffer.
+template <class Callable>
+struct InplaceTask::Holder<Callable, true> {
+  static Callable& Get(Storage& storage) {
+    return *reinterpret_cast<Callable*>(&storage);
+  }
+
+  template <class Function>
+  static void Create(Storage& storage, Function&& function) {
+    new (&storage) Callable(std::forward<Function>(function));
+  }
+
+  static void Invoke(Storage& storage) { Get(storage)(); }
+
+  static void Relocate(Storage& from, Storage& to) {
+    new (&to) Callable(std::move(Get(from)));
+    Get(from).~Callable();
+  }
+
+  static void Destroy(Storage& storage) { Get(storage).~Callable(); }
+
+  static constexpr Operations kOperations = {&Invoke, &Relocate, &Destroy};
+};
+
+/// Keeps the callable on the heap and the pointer in the inline buffer.
+template <class Callable>
+struct InplaceTask::Holder<Callable, false> {
+  static Callable*& Get(Storage& storage) {
+    return *reinterpret_cast<Callable**>(&storage);
+  }
+
+  template <class Function>
+  static void Create(Storage& storage, Function&& function) {
+    new (&storage) Callable*(new Callable(std::forward<Function>(function)));
+  }
+
+  static void Invoke(Storage& storage) { (*Get(storage))(); }
+
+  static void Relocate(Storage& from, Storage& to) {
+    new (&to) Callable*(Get(from));
+  }
+
+  static void Destroy(Storage& storage) { delete Get(storage); }
+
+  static constexpr Operations kOperations = {&Invoke, &Relocate, &Destroy};
+};
+
+template <class Callable>
+constexpr InplaceTask::Operations
+    InplaceTask::Holder<Callable, true>::kOperations;
+
+template <class Callable>
+constexpr InplaceTask::Operations
+    InplaceTask::Holder<Callable, false>::kOperations;
+
+}  // namespace thread
+}  // namespace olp
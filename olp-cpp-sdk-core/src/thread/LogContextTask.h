@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "olp/core/logging/LogContext.h"
+#include "olp/core/thread/TaskScheduler.h"
+#include "thread/InplaceTask.h"
+
+namespace olp {
+namespace thread {
+
+/// Executes the task with the given log context.
+struct LogContextTask {
+  void operator()() const {
+    olp::logging::ScopedLogContext scoped_context(context);
+    func();
+  }
+
+  std::shared_ptr<const logging::LogContext> context;
+  TaskScheduler::CallFuncType func;
+};
+
+/// Wraps the task, so it is executed with the log context of the caller. The
+/// task is not wrapped when the caller has no log context, and the wrapper
+/// fits into the inline buffer of `InplaceTask`.
+inline InplaceTask WithLogContext(TaskScheduler::CallFuncType&& func) {
+  auto context = logging::GetContext();
+  if (!context) {
+    return InplaceTask(std::move(func));
+  }
+  return InplaceTask(LogContextTask{std::move(context), std::move(func)});
+}
+
+}  // namespace thread
+}  // namespace olp
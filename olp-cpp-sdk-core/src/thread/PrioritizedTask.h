@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "thread/InplaceTask.h"
+
+namespace olp {
+namespace thread {
+
+/// A task in the queue of a scheduler.
+struct PrioritizedTask {
+  InplaceTask function;
+  uint32_t priority;
+  /// The time the task is enqueued at, used for the statistics.
+  std::chrono::steady_clock::time_point enqueue_time;
+  /// The identifier of the scheduling group, zero without a group.
+  uint64_t group;
+  /// The weight of the scheduling group.
+  uint32_t group_weight;
+};
+
+/// Gets the priority of a `PrioritizedTask` for the priority queues.
+struct GetTaskPriority {
+  uint32_t operator()(const PrioritizedTask& task) const {
+    return task.priority;
+  }
+};
+
+}  // namespace thread
+}  // namespace olp
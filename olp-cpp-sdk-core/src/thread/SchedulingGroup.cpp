@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/thread/SchedulingGroup.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace olp {
+namespace thread {
+
+namespace {
+/// Set in the identifiers of the unique groups, cleared in the keyed ones.
+constexpr uint64_t kUniqueGroupBit = 1ull << 63;
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+uint64_t NextUniqueId() {
+  static std::atomic<uint64_t> counter{0u};
+  return kUniqueGroupBit | ++counter;
+}
+
+/// The FNV-1a hash, the same on all the platforms.
+uint64_t HashKey(const std::string& key) {
+  auto hash = kFnvOffsetBasis;
+  for (const auto c : key) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * kFnvPrime;
+  }
+  return hash;
+}
+}  // namespace
+
+SchedulingGroup::SchedulingGroup(uint32_t weight)
+    : SchedulingGroup(NextUniqueId(), weight) {}
+
+SchedulingGroup::SchedulingGroup(uint64_t id, uint32_t weight)
+    : id_(id), weight_(std::max(weight, 1u)) {}
+
+SchedulingGroup SchedulingGroup::FromKey(const std::string& key,
+                                         uint32_t weight) {
+  // Zero is the identifier of the tasks without a group.
+  const auto id = HashKey(key) & ~kUniqueGroupBit;
+  return SchedulingGroup(std::max<uint64_t>(id, 1u), weight);
+}
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/thread/ScopedBlockingRegion.h"
+
+#include <cstddef>
+
+#include "thread/BlockingRegionHandler.h"
+
+namespace olp {
+namespace thread {
+
+namespace {
+thread_local BlockingRegionHandler* tls_handler = nullptr;
+thread_local size_t tls_depth = 0u;
+}  // namespace
+
+void SetBlockingRegionHandler(BlockingRegionHandler* handler) {
+  tls_handler = handler;
+}
+
+ScopedBlockingRegion::ScopedBlockingRegion() {
+  if (tls_depth++ == 0u && tls_handler) {
+    tls_handler->OnBlockingBegin();
+  }
+}
+
+ScopedBlockingRegion::~ScopedBlockingRegion() {
+  if (--tls_depth == 0u && tls_handler) {
+    tls_handler->OnBlockingEnd();
+  }
+}
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/thread/TaskScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace olp {
+namespace thread {
+
+namespace {
+using Clock = std::chrono::steady_clock;
+using CancelledFlag = std::shared_ptr<std::atomic<bool>>;
+
+/// The maximal time a delayed task sleeps before checking the cancellation.
+constexpr auto kMaxSleepStep = std::chrono::milliseconds(100);
+
+/// Schedules the tasks to another scheduler in a scheduling group.
+class GroupTaskScheduler final : public TaskScheduler {
+ public:
+  GroupTaskScheduler(std::shared_ptr<TaskScheduler> scheduler,
+                     SchedulingGroup group)
+      : scheduler_(std::move(scheduler)), group_(group) {}
+
+  Statistics GetStatistics() const override {
+    return scheduler_->GetStatistics();
+  }
+
+  void SetSlowTaskCallback(std::chrono::milliseconds threshold,
+                           SlowTaskCallback callback) override {
+    scheduler_->SetSlowTaskCallback(threshold, std::move(callback));
+  }
+
+ protected:
+  void EnqueueTask(CallFuncType&& func) override {
+    EnqueueTask(std::move(func), NORMAL);
+  }
+
+  void EnqueueTask(CallFuncType&& func, uint32_t priority) override {
+    scheduler_->ScheduleTask(std::move(func), priority, group_);
+  }
+
+  void EnqueueTask(CallFuncType&& func, uint32_t priority,
+                   const SchedulingGroup& group) override {
+    scheduler_->ScheduleTask(std::move(func), priority, group);
+  }
+
+  client::CancellationToken EnqueueDelayedTask(CallFuncType&& func,
+                                               Clock::time_point time,
+                                               uint32_t priority) override {
+    // The timer of the scheduler enqueues the task to the group once the time
+    // is reached.
+    auto task = std::bind(
+        [priority](const std::shared_ptr<TaskScheduler>& scheduler,
+                   const SchedulingGroup& group, CallFuncType& func) {
+          scheduler->ScheduleTask(std::move(func), priority, group);
+        },
+        scheduler_, group_, std::move(func));
+    return scheduler_->ScheduleAt(std::move(task), time, priority);
+  }
+
+ private:
+  const std::shared_ptr<TaskScheduler> scheduler_;
+  const SchedulingGroup group_;
+};
+}  // namespace
+
+client::CancellationToken TaskScheduler::ScheduleAt(CallFuncType&& func,
+                                                    Clock::time_point time,
+                                                    uint32_t priority) {
+  // The flag skips the task that is already enqueued when cancelled.
+  auto cancelled = std::make_shared<std::atomic<bool>>(false);
+  auto task = std::bind(
+      [](const CancelledFlag& cancelled, CallFuncType& func) {
+        if (!cancelled->load()) {
+          func();
+        }
+      },
+      cancelled, std::move(func));
+
+  auto token = EnqueueDelayedTask(std::move(task), time, priority);
+  return client::CancellationToken([cancelled, token]() {
+    cancelled->store(true);
+    token.Cancel();
+  });
+}
+
+client::CancellationToken TaskScheduler::EnqueueDelayedTask(
+    CallFuncType&& func, Clock::time_point time, uint32_t priority) {
+  auto cancelled = std::make_shared<std::atomic<bool>>(false);
+  auto task = std::bind(
+      [](const CancelledFlag& cancelled, Clock::time_point time,
+         CallFuncType& func) {
+        for (auto now = Clock::now(); now < time && !cancelled->load();
+             now = Clock::now()) {
+          std::this_thread::sleep_for(
+              std::min<Clock::duration>(time - now, kMaxSleepStep));
+        }
+
+        if (!cancelled->load()) {
+          func();
+        }
+      },
+      cancelled, time, std::move(func));
+
+  EnqueueTask(std::move(task), priority);
+  return client::CancellationToken([cancelled]() { cancelled->store(true); });
+}
+
+TaskScheduler::Statistics TaskScheduler::GetStatistics() const { return {}; }
+
+void TaskScheduler::SetSlowTaskCallback(std::chrono::milliseconds threshold,
+                                        SlowTaskCallback callback) {
+  OLP_SDK_CORE_UNUSED(threshold, callback);
+}
+
+std::shared_ptr<TaskScheduler> CreateGroupTaskScheduler(
+    std::shared_ptr<TaskScheduler> scheduler, SchedulingGroup group) {
+  if (!scheduler) {
+    return nullptr;
+  }
+  return std::make_shared<GroupTaskScheduler>(std::move(scheduler), group);
+}
+
+}  // namespace thread
+}  // namespace olp
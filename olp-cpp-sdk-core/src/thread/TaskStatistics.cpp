@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "thread/TaskStatistics.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <olp/core/porting/make_unique.h>
+
+namespace olp {
+namespace thread {
+
+namespace {
+using MicroSeconds = std::chrono::microseconds;
+
+MicroSeconds ToMicroSeconds(TaskStatistics::Clock::duration duration) {
+  return std::chrono::duration_cast<MicroSeconds>(duration);
+}
+}  // namespace
+
+constexpr size_t TaskStatistics::kMaxPriorities;
+
+TaskStatistics::TaskStatistics(size_t worker_count)
+    : created_(Clock::now()),
+      slow_task_threshold_(std::numeric_limits<Clock::rep>::max()) {
+  workers_.reserve(worker_count);
+  for (size_t i = 0u; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+}
+
+TaskStatistics::Clock::time_point TaskStatistics::OnEnqueued(
+    uint32_t priority) {
+  GetQueueDepth(priority).depth.fetch_add(1, std::memory_order_relaxed);
+  return Clock::now();
+}
+
+TaskStatistics::Clock::time_point TaskStatistics::OnStarted(
+    size_t worker, uint32_t priority) {
+  GetQueueDepth(priority).depth.fetch_sub(1, std::memory_order_relaxed);
+
+  const auto now = Clock::now();
+  auto& slot = *workers_[worker];
+  slot.current_priority.store(priority, std::memory_order_relaxed);
+  slot.current_start.store(now.time_since_epoch().count(),
+                           std::memory_order_relaxed);
+  return now;
+}
+
+void TaskStatistics::OnFinished(size_t worker, uint32_t priority,
+                                Clock::time_point enqueued,
+                                Clock::time_point started) {
+  const auto now = Clock::now();
+  const auto execution_time = now - started;
+  auto& slot = *workers_[worker];
+
+  {
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    auto it = std::find_if(
+        slot.priorities.begin(), slot.priorities.end(),
+        [=](const std::pair<uint32_t, TaskScheduler::PriorityStatistics>&
+                item) { return item.first == priority; });
+    if (it == slot.priorities.end()) {
+      slot.priorities.emplace_back(priority,
+                                   TaskScheduler::PriorityStatistics());
+      it = std::prev(slot.priorities.end());
+    }
+
+    it->second.wait_time.Add(ToMicroSeconds(started - enqueued));
+    it->second.execution_time.Add(ToMicroSeconds(execution_time));
+    slot.busy_time += execution_time;
+    if (execution_time > slot.longest_task_time) {
+      slot.longest_task_time = execution_time;
+      slot.longest_task_priority = priority;
+    }
+  }
+
+  // Released after the task is recorded, so the reader that sees the idle
+  // worker sees the task as well.
+  slot.current_start.store(0, std::memory_order_release);
+
+  if (execution_time.count() <
+      slow_task_threshold_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  TaskScheduler::SlowTaskCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callback = slow_task_callback_;
+  }
+
+  if (callback) {
+    callback(ToMicroSeconds(execution_time), priority);
+  }
+}
+
+TaskScheduler::Statistics TaskStatistics::Get() const {
+  TaskScheduler::Statistics statistics;
+  const auto now = Clock::now();
+  const auto lifetime = now - created_;
+
+  for (const auto& counter : depths_) {
+    const auto key = counter.key.load(std::memory_order_acquire);
+    if (key != 0u) {
+      const auto depth = counter.depth.load(std::memory_order_relaxed);
+      statistics.priorities[static_cast<uint32_t>(key - 1u)].queue_depth =
+          static_cast<size_t>(std::max<int64_t>(depth, 0));
+    }
+  }
+
+  Clock::duration longest_task_time{0};
+  statistics.threads.reserve(workers_.size());
+  for (const auto& worker : workers_) {
+    TaskScheduler::ThreadStatistics thread;
+    Clock::duration busy_time{0};
+    const auto current_start =
+        worker->current_start.load(std::memory_order_acquire);
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      for (const auto& item : worker->priorities) {
+        auto& priority = statistics.priorities[item.first];
+        priority.wait_time.Merge(item.second.wait_time);
+        priority.execution_time.Merge(item.second.execution_time);
+      }
+
+      busy_time = worker->busy_time;
+      if (worker->longest_task_time > longest_task_time) {
+        longest_task_time = worker->longest_task_time;
+        statistics.longest_task_priority = worker->longest_task_priority;
+      }
+    }
+
+    if (current_start != 0) {
+      const auto current_task_time =
+          std::max(now - Clock::time_point(Clock::duration(current_start)),
+                   Clock::duration::zero());
+      thread.current_task_time = ToMicroSeconds(current_task_time);
+      busy_time += current_task_time;
+      if (current_task_time > longest_task_time) {
+        longest_task_time = current_task_time;
+        statistics.longest_task_priority =
+            worker->current_priority.load(std::memory_order_relaxed);
+      }
+    }
+
+    thread.busy_time = ToMicroSeconds(busy_time);
+    if (lifetime.count() > 0) {
+      thread.busy_ratio =
+          std::min(static_cast<double>(busy_time.count()) /
+                       static_cast<double>(lifetime.count()),
+                   1.0);
+    }
+    statistics.threads.push_back(thread);
+  }
+
+  statistics.longest_task_time = ToMicroSeconds(longest_task_time);
+  return statistics;
+}
+
+void TaskStatistics::SetSlowTaskCallback(
+    std::chrono::milliseconds threshold,
+    TaskScheduler::SlowTaskCallback callback) {
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  slow_task_threshold_.store(
+      callback ? std::chrono::duration_cast<Clock::duration>(threshold).count()
+               : std::numeric_limits<Clock::rep>::max(),
+      std::memory_order_relaxed);
+  slow_task_callback_ = std::move(callback);
+}
+
+TaskStatistics::QueueDepth& TaskStatistics::GetQueueDepth(uint32_t priority) {
+  const uint64_t key = static_cast<uint64_t>(priority) + 1u;
+  for (auto& counter : depths_) {
+    auto current = counter.key.load(std::memory_order_acquire);
+    if (current == 0u &&
+        counter.key.compare_exchange_strong(current, key,
+                                            std::memory_order_acq_rel)) {
+      return counter;
+    }
+
+    if (current == key) {
+      return counter;
+    }
+  }
+
+  return depths_.back();
+}
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <olp/core/thread/TaskScheduler.h>
+
+namespace olp {
+namespace thread {
+
+/**
+ * @brief Collects the statistics of the tasks executed by a scheduler.
+ *
+ * Cheap enough to stay enabled: a task costs three clock reads, a few
+ * relaxed atomic operations, and one lock of the worker's own slot, which
+ * is only contended while the statistics are read.
+ */
+class TaskStatistics final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Creates the statistics for the given number of workers.
+  explicit TaskStatistics(size_t worker_count);
+
+  TaskStatistics(const TaskStatistics&) = delete;
+  TaskStatistics& operator=(const TaskStatistics&) = delete;
+
+  /// Records a task pushed to the queue, returns the enqueue time.
+  Clock::time_point OnEnqueued(uint32_t priority);
+
+  /// Records a task taken from the queue by the worker, returns the start
+  /// time.
+  Clock::time_point OnStarted(size_t worker, uint32_t priority);
+
+  /// Records a task finished by the worker.
+  void OnFinished(size_t worker, uint32_t priority, Clock::time_point enqueued,
+                  Clock::time_point started);
+
+  /// Gets the collected statistics.
+  TaskScheduler::Statistics Get() const;
+
+  /// Sets the callback for the tasks that take longer than the threshold.
+  void SetSlowTaskCallback(std::chrono::milliseconds threshold,
+                           TaskScheduler::SlowTaskCallback callback);
+
+ private:
+  /// The number of tasks in the queue with one priority.
+  struct QueueDepth {
+    /// The priority plus one, zero if the counter is not used yet.
+    std::atomic<uint64_t> key{0u};
+    std::atomic<int64_t> depth{0};
+  };
+
+  /// The statistics recorded by one worker.
+  struct Worker {
+    std::mutex mutex;
+    /// Few priorities are expected, so they are searched linearly.
+    std::vector<std::pair<uint32_t, TaskScheduler::PriorityStatistics>>
+        priorities;
+    Clock::duration busy_time{0};
+    Clock::duration longest_task_time{0};
+    uint32_t longest_task_priority{0u};
+
+    /// The start time of the running task since the clock epoch, zero if
+    /// the worker is idle.
+    std::atomic<Clock::rep> current_start{0};
+    std::atomic<uint32_t> current_priority{0u};
+  };
+
+  /// The maximal number of priorities with own queue depth counters. The
+  /// further priorities share the last counter.
+  static constexpr size_t kMaxPriorities = 32u;
+
+  QueueDepth& GetQueueDepth(uint32_t priority);
+
+  const Clock::time_point created_;
+  std::array<QueueDepth, kMaxPriorities> depths_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  /// The threshold of the slow tasks, the maximum if there is no callback.
+  std::atomic<Clock::rep> slow_task_threshold_;
+  mutable std::mutex callback_mutex_;
+  TaskScheduler::SlowTaskCallback slow_task_callback_;
+};
+
+}  // namespace thread
+}  // namespace olp
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,13 +29,23 @@
 #endif
 #include <pthread.h>
 #endif
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "olp/core/logging/Log.h"
-#include "olp/core/logging/LogContext.h"
+#include "olp/core/porting/make_unique.h"
 #include "olp/core/porting/platform.h"
-#include "olp/core/thread/SyncQueue.h"
-#include "thread/PriorityQueueExtended.h"
+#include "thread/BlockingRegionHandler.h"
+#include "thread/FairTaskQueue.h"
+#include "thread/InplaceTask.h"
+#include "thread/LogContextTask.h"
+#include "thread/PrioritizedTask.h"
+#include "thread/TaskStatistics.h"
+#include "thread/TimerWheel.h"
 
 namespace olp {
 namespace thread {
@@ -43,18 +53,6 @@ namespace thread {
 namespace {
 constexpr auto kLogTag = "ThreadPoolTaskScheduler";
 
-struct PrioritizedTask {
-  TaskScheduler::CallFuncType function;
-  uint32_t priority;
-};
-
-struct ComparePrioritizedTask {
-  bool operator()(const PrioritizedTask& lhs,
-                  const PrioritizedTask& rhs) const {
-    return lhs.priority < rhs.priority;
-  }
-};
-
 void SetExecutorName(size_t idx) {
   std::string thread_name = "OLPSDKPOOL_" + std::to_string(idx);
   olp::utils::Thread::SetCurrentThreadName(thread_name);
@@ -63,48 +61,196 @@ void SetExecutorName(size_t idx) {
 
 }  // namespace
 
-class ThreadPoolTaskScheduler::QueueImpl {
+class ThreadPoolTaskScheduler::QueueImpl final : public BlockingRegionHandler {
  public:
-  using ElementType = PrioritizedTask;
+  QueueImpl(ElasticSettings settings, bool elastic, TaskStatistics& statistics)
+      : settings_(std::move(settings)),
+        elastic_(elastic),
+        statistics_(statistics) {
+    free_indexes_.reserve(settings_.max_thread_count);
+    for (auto index = settings_.max_thread_count; index > 0u; --index) {
+      free_indexes_.push_back(index - 1u);
+    }
+  }
 
-  bool Pull(ElementType& element) { return sync_queue_.Pull(element); }
-  void Push(ElementType&& element) { sync_queue_.Push(std::move(element)); }
-  void Close() { sync_queue_.Close(); }
+  /// Starts the core threads.
+  void Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (workers_.size() < settings_.core_thread_count) {
+      StartWorkerUnsafe();
+    }
+  }
+
+  void Push(PrioritizedTask&& task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      // Do not push on a closed queue
+      if (closed_) {
+        return;
+      }
+
+      queue_.push(std::move(task));
+      if (NeedsWorkerUnsafe()) {
+        StartWorkerUnsafe();
+      }
+    }
+    ready_.notify_one();
+  }
+
+  /// Discards the queued tasks and joins the threads.
+  void Close() {
+    FairTaskQueue queue;
+    std::unordered_map<size_t, std::thread> workers;
+    std::vector<std::thread> retired;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      std::swap(queue_, queue);
+      std::swap(workers_, workers);
+      std::swap(retired_, retired);
+    }
+    ready_.notify_all();
+
+    for (auto& worker : workers) {
+      worker.second.join();
+    }
+    for (auto& thread : retired) {
+      thread.join();
+    }
+  }
+
+  void OnBlockingBegin() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++blocked_;
+    if (!queue_.empty() && NeedsWorkerUnsafe()) {
+      StartWorkerUnsafe();
+    }
+  }
+
+  void OnBlockingEnd() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --blocked_;
+  }
 
  private:
-  using PriorityQueue =
-      PriorityQueueExtended<ElementType, ComparePrioritizedTask>;
-  SyncQueue<ElementType, PriorityQueue> sync_queue_;
-};
+  /// Must be called under the `mutex_`.
+  bool NeedsWorkerUnsafe() const {
+    // The blocked workers are compensated up to the core thread count.
+    return !closed_ && idle_ == 0u &&
+           workers_.size() < settings_.max_thread_count &&
+           workers_.size() - blocked_ < settings_.core_thread_count;
+  }
 
-ThreadPoolTaskScheduler::ThreadPoolTaskScheduler(size_t thread_count)
-    : queue_{std::make_unique<QueueImpl>()} {
-  thread_pool_.reserve(thread_count);
+  /// Must be called under the `mutex_`.
+  void StartWorkerUnsafe() {
+    // The retired threads have already released the mutex and are exiting.
+    for (auto& thread : retired_) {
+      thread.join();
+    }
+    retired_.clear();
+
+    const auto index = free_indexes_.back();
+    free_indexes_.pop_back();
+    workers_.emplace(index, std::thread(&QueueImpl::Run, this, index));
+  }
 
-  for (size_t idx = 0; idx < thread_count; ++idx) {
-    std::thread executor([this, idx]() {
-      // Set thread name for easy profiling and debugging
-      SetExecutorName(idx);
+  void Run(size_t index) {
+    // Set thread name for easy profiling and debugging
+    SetExecutorName(index);
+    SetBlockingRegionHandler(this);
 
-      for (;;) {
-        PrioritizedTask task;
-        if (!queue_->Pull(task)) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!closed_) {
+      if (queue_.empty()) {
+        const auto ready = [this]() { return closed_ || !queue_.empty(); };
+        auto woken = true;
+
+        ++idle_;
+        if (elastic_) {
+          woken = ready_.wait_for(lock, settings_.idle_timeout, ready);
+        } else {
+          ready_.wait(lock, ready);
+        }
+        --idle_;
+
+        if (!woken &&
+            workers_.size() - blocked_ > settings_.core_thread_count) {
+          Retire(index);
           return;
         }
-        task.function();
+        continue;
       }
-    });
 
-    thread_pool_.push_back(std::move(executor));
+      auto task = queue_.pop();
+      lock.unlock();
+
+      const auto start_time = statistics_.OnStarted(index, task.priority);
+      task.function();
+      statistics_.OnFinished(index, task.priority, task.enqueue_time,
+                             start_time);
+      // Release the captured state before the lock is taken.
+      task.function = nullptr;
+
+      lock.lock();
+    }
+  }
+
+  /// Must be called under the `mutex_`.
+  void Retire(size_t index) {
+    OLP_SDK_LOG_DEBUG_F(kLogTag, "Stopping idle thread %zu", index);
+    auto it = workers_.find(index);
+    if (it != workers_.end()) {
+      retired_.push_back(std::move(it->second));
+      workers_.erase(it);
+    }
+    free_indexes_.push_back(index);
   }
+
+  const ElasticSettings settings_;
+  const bool elastic_;
+  TaskStatistics& statistics_;
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  FairTaskQueue queue_;
+  bool closed_{false};
+
+  /// The running threads by the worker index.
+  std::unordered_map<size_t, std::thread> workers_;
+  /// The threads that exited after the idle timeout, not joined yet.
+  std::vector<std::thread> retired_;
+  std::vector<size_t> free_indexes_;
+  /// The number of workers waiting for a task.
+  size_t idle_{0u};
+  /// The number of workers in a blocking region.
+  size_t blocked_{0u};
+};
+
+ThreadPoolTaskScheduler::ThreadPoolTaskScheduler(size_t thread_count)
+    : timers_{std::make_shared<TimerWheel>()},
+      statistics_{std::make_unique<TaskStatistics>(thread_count)} {
+  ElasticSettings settings;
+  settings.core_thread_count = thread_count;
+  settings.max_thread_count = thread_count;
+  queue_ = std::make_unique<QueueImpl>(settings, false, *statistics_);
+  queue_->Start();
+}
+
+ThreadPoolTaskScheduler::ThreadPoolTaskScheduler(ElasticSettings settings)
+    : timers_{std::make_shared<TimerWheel>()} {
+  settings.core_thread_count = std::max<size_t>(settings.core_thread_count, 1u);
+  settings.max_thread_count =
+      std::max(settings.max_thread_count, settings.core_thread_count);
+  statistics_ = std::make_unique<TaskStatistics>(settings.max_thread_count);
+  queue_ = std::make_unique<QueueImpl>(settings, true, *statistics_);
+  queue_->Start();
 }
 
 ThreadPoolTaskScheduler::~ThreadPoolTaskScheduler() {
+  // Discards the delayed tasks, so no task is pushed to the closed queue.
+  timers_->Stop();
   queue_->Close();
-  for (auto& thread : thread_pool_) {
-    thread.join();
-  }
-  thread_pool_.clear();
 }
 
 void ThreadPoolTaskScheduler::EnqueueTask(TaskScheduler::CallFuncType&& func) {
@@ -113,27 +259,39 @@ void ThreadPoolTaskScheduler::EnqueueTask(TaskScheduler::CallFuncType&& func) {
 
 void ThreadPoolTaskScheduler::EnqueueTask(TaskScheduler::CallFuncType&& func,
                                           uint32_t priority) {
-  auto logContext = logging::GetContext();
-
-#if __cplusplus >= 201402L
-  // At least C++14, use generalized lambda capture
-  auto funcWithCapturedLogContext = [logContext = std::move(logContext),
-                                     func = std::move(func)]() {
-    olp::logging::ScopedLogContext scopedContext(logContext);
-    func();
-  };
-#else
-  // C++11 does not support generalized lambda capture :(
-  auto funcWithCapturedLogContext = std::bind(
-      [](std::shared_ptr<const olp::logging::LogContext>& logContext,
-         TaskScheduler::CallFuncType& func) {
-        olp::logging::ScopedLogContext scopedContext(logContext);
-        func();
+  const auto enqueue_time = statistics_->OnEnqueued(priority);
+  queue_->Push(
+      {WithLogContext(std::move(func)), priority, enqueue_time, 0u, 1u});
+}
+
+void ThreadPoolTaskScheduler::EnqueueTask(TaskScheduler::CallFuncType&& func,
+                                          uint32_t priority,
+                                          const SchedulingGroup& group) {
+  const auto enqueue_time = statistics_->OnEnqueued(priority);
+  queue_->Push({WithLogContext(std::move(func)), priority, enqueue_time,
+                group.GetId(), group.GetWeight()});
+}
+
+client::CancellationToken ThreadPoolTaskScheduler::EnqueueDelayedTask(
+    TaskScheduler::CallFuncType&& func,
+    std::chrono::steady_clock::time_point time, uint32_t priority) {
+  // The log context is taken now, as the timer thread has none. The timers
+  // are stopped before the queue is closed, so `this` outlives them.
+  auto task = std::bind(
+      [this, priority](LogContextTask& task) {
+        EnqueueTask(std::move(task), priority);
       },
-      std::move(logContext), std::move(func));
-#endif
+      LogContextTask{logging::GetContext(), std::move(func)});
+  return TimerWheel::Schedule(timers_, time, std::move(task));
+}
+
+TaskScheduler::Statistics ThreadPoolTaskScheduler::GetStatistics() const {
+  return statistics_->Get();
+}
 
-  queue_->Push({std::move(funcWithCapturedLogContext), priority});
+void ThreadPoolTaskScheduler::SetSlowTaskCallback(
+    std::chrono::milliseconds threshold, SlowTaskCallback callback) {
+  statistics_->SetSlowTaskCallback(threshold, std::move(callback));
 }
 
 }  // namespace thread
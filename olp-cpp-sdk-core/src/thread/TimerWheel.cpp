@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "thread/TimerWheel.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "olp/core/utils/Thread.h"
+
+namespace olp {
+namespace thread {
+
+namespace {
+constexpr auto kNoTick = std::numeric_limits<uint64_t>::max();
+}  // namespace
+
+constexpr size_t TimerWheel::kLevels;
+constexpr size_t TimerWheel::kSlotBits;
+constexpr size_t TimerWheel::kSlots;
+
+TimerWheel::TimerWheel() : start_(Clock::now()) {}
+
+TimerWheel::~TimerWheel() { Stop(); }
+
+uint64_t TimerWheel::Add(Clock::time_point time, Callback callback) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (stopped_) {
+    return 0u;
+  }
+
+  const auto id = ++next_id_;
+  Slot timer;
+  timer.push_back({id, ToTick(time), std::move(callback)});
+  PlaceUnsafe(timer, timer.begin());
+
+  if (!thread_.joinable()) {
+    thread_ = std::thread(&TimerWheel::Run, this);
+  }
+  condition_.notify_one();
+  return id;
+}
+
+void TimerWheel::Cancel(uint64_t id) {
+  // Destroyed outside of the lock, as the callback might own anything.
+  Callback callback;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = timers_.find(id);
+  if (it == timers_.end()) {
+    return;
+  }
+
+  const auto& location = it->second;
+  callback = std::move(location.timer->callback);
+  location.slot->erase(location.timer);
+  if (location.level < kLevels) {
+    --level_sizes_[location.level];
+  }
+  timers_.erase(it);
+}
+
+void TimerWheel::Stop() {
+  decltype(slots_) slots;
+  Slot overflow;
+  Slot expired;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    std::swap(slots, slots_);
+    overflow.swap(overflow_);
+    expired.swap(expired_);
+    level_sizes_.fill(0u);
+    timers_.clear();
+  }
+  condition_.notify_all();
+
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+size_t TimerWheel::Size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return timers_.size();
+}
+
+client::CancellationToken TimerWheel::Schedule(
+    const std::shared_ptr<TimerWheel>& wheel, Clock::time_point time,
+    Callback callback) {
+  const auto id = wheel->Add(time, std::move(callback));
+  std::weak_ptr<TimerWheel> weak_wheel = wheel;
+  return client::CancellationToken([weak_wheel, id]() {
+    if (auto wheel = weak_wheel.lock()) {
+      wheel->Cancel(id);
+    }
+  });
+}
+
+uint64_t TimerWheel::ToTick(Clock::time_point time) const {
+  // Rounded up, so the timers never fire early.
+  const auto duration = time - start_;
+  if (duration <= Clock::duration::zero()) {
+    return 0u;
+  }
+
+  const auto ticks =
+      std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+  return static_cast<uint64_t>(ticks.count()) +
+         (ticks < duration ? 1u : 0u);
+}
+
+TimerWheel::Clock::time_point TimerWheel::FromTick(uint64_t tick) const {
+  return start_ + std::chrono::milliseconds(tick);
+}
+
+void TimerWheel::PlaceUnsafe(Slot& from, Slot::iterator timer) {
+  const auto tick = timer->tick;
+
+  // The timer goes to the lowest level where it shares the upper bits with
+  // the current tick, so it cascades down before the current tick reaches it.
+  auto level = kLevels;
+  Slot* slot = &overflow_;
+  if (tick <= current_tick_) {
+    slot = &expired_;
+  } else {
+    for (level = 0u; level < kLevels; ++level) {
+      const auto upper_shift = kSlotBits * (level + 1u);
+      if ((tick >> upper_shift) == (current_tick_ >> upper_shift)) {
+        slot = &slots_[level][(tick >> (kSlotBits * level)) & (kSlots - 1u)];
+        ++level_sizes_[level];
+        break;
+      }
+    }
+  }
+
+  slot->splice(slot->end(), from, timer);
+  timers_[timer->id] = {slot, level, timer};
+}
+
+void TimerWheel::AdvanceUnsafe(uint64_t tick) {
+  while (current_tick_ < tick) {
+    // Jump over the ticks without any timers.
+    current_tick_ = std::min(tick, GetNextTickUnsafe());
+
+    if (!overflow_.empty() &&
+        (current_tick_ & ((uint64_t{1} << (kSlotBits * kLevels)) - 1u)) ==
+            0u) {
+      // The timers beyond the next block go back to the overflow slot.
+      Slot overflow;
+      overflow.swap(overflow_);
+      while (!overflow.empty()) {
+        PlaceUnsafe(overflow, overflow.begin());
+      }
+    }
+
+    // Cascade the slots that start at the current tick, from the top level.
+    for (auto level = kLevels; level-- > 0u;) {
+      const auto shift = kSlotBits * level;
+      if ((current_tick_ & ((uint64_t{1} << shift) - 1u)) != 0u) {
+        continue;
+      }
+
+      auto& slot = slots_[level][(current_tick_ >> shift) & (kSlots - 1u)];
+      level_sizes_[level] -= slot.size();
+      while (!slot.empty()) {
+        PlaceUnsafe(slot, slot.begin());
+      }
+    }
+  }
+}
+
+uint64_t TimerWheel::GetNextTickUnsafe() const {
+  auto next_tick = kNoTick;
+  for (size_t level = 0u; level < kLevels; ++level) {
+    if (level_sizes_[level] == 0u) {
+      continue;
+    }
+
+    // The timers of a level are in the slots after the current one.
+    const auto shift = kSlotBits * level;
+    const auto current_slot = (current_tick_ >> shift) & (kSlots - 1u);
+    for (auto slot = current_slot + 1u; slot < kSlots; ++slot) {
+      if (!slots_[level][slot].empty()) {
+        const auto block = (current_tick_ >> (shift + kSlotBits)) << kSlotBits;
+        next_tick = std::min(next_tick, (block + slot) << shift);
+        break;
+      }
+    }
+  }
+
+  if (!overflow_.empty()) {
+    const auto shift = kSlotBits * kLevels;
+    next_tick =
+        std::min(next_tick, ((current_tick_ >> shift) + 1u) << shift);
+  }
+
+  return next_tick;
+}
+
+void TimerWheel::Run() {
+  utils::Thread::SetCurrentThreadName("OLPSDKTIMER");
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stopped_) {
+    // Rounded down, so the timers never fire early.
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - start_);
+    AdvanceUnsafe(static_cast<uint64_t>(std::max<int64_t>(now.count(), 0)));
+
+    if (!expired_.empty()) {
+      Slot expired;
+      expired.swap(expired_);
+      for (const auto& timer : expired) {
+        timers_.erase(timer.id);
+      }
+
+      lock.unlock();
+      for (auto& timer : expired) {
+        timer.callback();
+      }
+      expired.clear();
+      lock.lock();
+      continue;
+    }
+
+    const auto next_tick = GetNextTickUnsafe();
+    if (next_tick == kNoTick) {
+      condition_.wait(lock);
+    } else {
+      condition_.wait_until(lock, FromTick(next_tick));
+    }
+  }
+}
+
+}  // namespace thread
+}  // namespace olp
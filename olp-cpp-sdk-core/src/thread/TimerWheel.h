@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <olp/core/client/CancellationToken.h>
+
+namespace olp {
+namespace thread {
+
+/**
+ * @brief Fires the timers on a single thread using a hierarchical timer wheel.
+ *
+ * The wheel has four levels of 64 slots with 1 ms ticks, so the timers up to
+ * ~4.6 hours away are added and removed in O(1), further timers wait in an
+ * overflow list. The thread sleeps until the next slot with timers and
+ * starts on the first added timer.
+ *
+ * The callbacks are executed on the timer thread, so they should only hand
+ * the work over, e.g. enqueue a task. They must not destroy the wheel.
+ */
+class TimerWheel final {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using Callback = std::function<void()>;
+
+  TimerWheel();
+
+  /// Stops the thread and discards the pending timers.
+  ~TimerWheel();
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  /**
+   * @brief Adds a timer.
+   *
+   * The timer fires on or after the given time, never before.
+   *
+   * @return The ID of the timer used to cancel it.
+   */
+  uint64_t Add(Clock::time_point time, Callback callback);
+
+  /// Removes the timer if it did not fire yet.
+  void Cancel(uint64_t id);
+
+  /// Stops the thread and discards the pending timers.
+  void Stop();
+
+  /// Gets the number of pending timers.
+  size_t Size() const;
+
+  /// Adds a timer and returns the token that cancels it. The token does not
+  /// prolong the lifetime of the wheel.
+  static client::CancellationToken Schedule(
+      const std::shared_ptr<TimerWheel>& wheel, Clock::time_point time,
+      Callback callback);
+
+ private:
+  static constexpr size_t kLevels = 4u;
+  static constexpr size_t kSlotBits = 6u;
+  static constexpr size_t kSlots = 1u << kSlotBits;
+
+  struct Timer {
+    uint64_t id;
+    uint64_t tick;
+    Callback callback;
+  };
+
+  using Slot = std::list<Timer>;
+
+  struct Location {
+    Slot* slot;
+    /// The level of the slot, `kLevels` for the overflow and expired lists.
+    size_t level;
+    Slot::iterator timer;
+  };
+
+  uint64_t ToTick(Clock::time_point time) const;
+  Clock::time_point FromTick(uint64_t tick) const;
+
+  /// All the following methods must be called under the `mutex_`.
+
+  /// Moves the timer from the list to the slot matching its tick, or to the
+  /// expired timers if it is due.
+  void PlaceUnsafe(Slot& from, Slot::iterator timer);
+
+  /// Advances the wheel up to the tick and collects the expired timers.
+  void AdvanceUnsafe(uint64_t tick);
+
+  /// Gets the next tick with timers to cascade or fire, not counting the
+  /// expired timers.
+  uint64_t GetNextTickUnsafe() const;
+
+  void Run();
+
+  const Clock::time_point start_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::thread thread_;
+  bool stopped_{false};
+
+  uint64_t current_tick_{0u};
+  uint64_t next_id_{0u};
+  std::array<std::array<Slot, kSlots>, kLevels> slots_;
+  std::array<size_t, kLevels> level_sizes_{};
+  Slot overflow_;
+  Slot expired_;
+  std::unordered_map<uint64_t, Location> timers_;
+};
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "olp/core/thread/WorkStealingTaskScheduler.h"
+
+#include <algorithm>
+#include <string>
+
+#include "olp/core/logging/Log.h"
+#include "olp/core/porting/make_unique.h"
+#include "olp/core/utils/Thread.h"
+#include "thread/BucketedPriorityQueue.h"
+#include "thread/InplaceTask.h"
+#include "thread/LogContextTask.h"
+#include "thread/PrioritizedTask.h"
+#include "thread/TaskStatistics.h"
+#include "thread/TimerWheel.h"
+
+namespace olp {
+namespace thread {
+
+namespace {
+constexpr auto kLogTag = "WorkStealingTaskScheduler";
+
+/// The top priority of an empty queue, lower than any task priority.
+constexpr int64_t kNoTasks = -1;
+
+/// The scheduler and the queue of the current worker thread.
+thread_local const WorkStealingTaskScheduler* tls_scheduler = nullptr;
+thread_local size_t tls_queue_index = 0u;
+
+void SetExecutorName(size_t idx) {
+  std::string thread_name = "OLPSDKWS_" + std::to_string(idx);
+  olp::utils::Thread::SetCurrentThreadName(thread_name);
+  OLP_SDK_LOG_INFO_F(kLogTag, "Starting thread '%s'", thread_name.c_str());
+}
+
+}  // namespace
+
+class WorkStealingTaskScheduler::WorkerQueue {
+ public:
+  void Push(PrioritizedTask&& task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(std::move(task));
+    UpdateTopPriorityUnsafe();
+  }
+
+  bool TryPop(PrioritizedTask& task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+
+    task = std::move(queue_.front());
+    queue_.pop();
+    UpdateTopPriorityUnsafe();
+    return true;
+  }
+
+  void Clear() {
+    Queue queue;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::swap(queue_, queue);
+      UpdateTopPriorityUnsafe();
+    }
+  }
+
+  /// The highest priority in the queue, or `kNoTasks`. Read without the lock,
+  /// so it is only a hint.
+  int64_t GetTopPriority() const {
+    return top_priority_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  using Queue = BucketedPriorityQueue<PrioritizedTask, GetTaskPriority>;
+
+  /// Must be called under the `mutex_`.
+  void UpdateTopPriorityUnsafe() {
+    top_priority_.store(queue_.empty()
+                            ? kNoTasks
+                            : static_cast<int64_t>(queue_.front().priority),
+                        std::memory_order_relaxed);
+  }
+
+  std::mutex mutex_;
+  Queue queue_;
+  std::atomic<int64_t> top_priority_{kNoTasks};
+};
+
+WorkStealingTaskScheduler::WorkStealingTaskScheduler(size_t thread_count)
+    : timers_{std::make_shared<TimerWheel>()},
+      statistics_{std::make_unique<TaskStatistics>(thread_count)} {
+  // Keep at least one queue, so the tasks can be enqueued without threads.
+  const auto queue_count = std::max<size_t>(thread_count, 1u);
+  queues_.reserve(queue_count);
+  for (size_t idx = 0; idx < queue_count; ++idx) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+
+  thread_pool_.reserve(thread_count);
+  for (size_t idx = 0; idx < thread_count; ++idx) {
+    std::thread executor([this, idx]() {
+      // Set thread name for easy profiling and debugging
+      SetExecutorName(idx);
+
+      tls_scheduler = this;
+      tls_queue_index = idx;
+      Run(idx);
+    });
+
+    thread_pool_.push_back(std::move(executor));
+  }
+}
+
+WorkStealingTaskScheduler::~WorkStealingTaskScheduler() {
+  // Discards the delayed tasks, so no task is enqueued during the shutdown.
+  timers_->Stop();
+
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    closed_.store(true);
+  }
+  sleep_cv_.notify_all();
+
+  for (auto& thread : thread_pool_) {
+    thread.join();
+  }
+  thread_pool_.clear();
+
+  for (auto& queue : queues_) {
+    queue->Clear();
+  }
+}
+
+void WorkStealingTaskScheduler::EnqueueTask(
+    TaskScheduler::CallFuncType&& func) {
+  EnqueueTask(std::move(func), thread::NORMAL);
+}
+
+void WorkStealingTaskScheduler::EnqueueTask(TaskScheduler::CallFuncType&& func,
+                                            uint32_t priority) {
+  // Do not push on a closed scheduler
+  if (closed_.load()) {
+    return;
+  }
+
+  // The tasks spawned by a worker stay on its queue, the others are spread.
+  const auto index =
+      tls_scheduler == this
+          ? tls_queue_index
+          : next_queue_.fetch_add(1u, std::memory_order_relaxed) %
+                queues_.size();
+  const auto enqueue_time = statistics_->OnEnqueued(priority);
+  queues_[index]->Push(
+      {WithLogContext(std::move(func)), priority, enqueue_time, 0u, 1u});
+
+  // Paired with the check of the sleeping worker, so either the worker sees
+  // the task or the task producer sees the sleeping worker.
+  pending_.fetch_add(1);
+  if (sleeping_.load() > 0u) {
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    sleep_cv_.notify_one();
+  }
+}
+
+bool WorkStealingTaskScheduler::Pop(size_t index, PrioritizedTask& task) {
+  const auto count = queues_.size();
+
+  // Prefer the queue with the highest priority task, the own queue on a tie.
+  auto best = index;
+  auto best_priority = queues_[index]->GetTopPriority();
+  for (size_t offset = 1u; offset < count; ++offset) {
+    const auto victim = (index + offset) % count;
+    const auto priority = queues_[victim]->GetTopPriority();
+    if (priority > best_priority) {
+      best = victim;
+      best_priority = priority;
+    }
+  }
+
+  if (best_priority != kNoTasks && queues_[best]->TryPop(task)) {
+    return true;
+  }
+
+  // The priorities might be outdated, check every queue.
+  for (size_t offset = 0u; offset < count; ++offset) {
+    if (queues_[(index + offset) % count]->TryPop(task)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void WorkStealingTaskScheduler::Run(size_t index) {
+  PrioritizedTask task;
+  while (!closed_.load()) {
+    if (Pop(index, task)) {
+      pending_.fetch_sub(1);
+      const auto start_time = statistics_->OnStarted(index, task.priority);
+      task.function();
+      statistics_->OnFinished(index, task.priority, task.enqueue_time,
+                              start_time);
+      // Release the captured state before the worker waits.
+      task.function = nullptr;
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleeping_.fetch_add(1u);
+    sleep_cv_.wait(lock,
+                   [this]() { return closed_.load() || pending_.load() > 0; });
+    sleeping_.fetch_sub(1u);
+  }
+}
+
+client::CancellationToken WorkStealingTaskScheduler::EnqueueDelayedTask(
+    TaskScheduler::CallFuncType&& func,
+    std::chrono::steady_clock::time_point time, uint32_t priority) {
+  // The log context is taken now, as the timer thread has none. The timers
+  // are stopped before the queue is closed, so `this` outlives them.
+  auto task = std::bind(
+      [this, priority](LogContextTask& task) {
+        EnqueueTask(std::move(task), priority);
+      },
+      LogContextTask{logging::GetContext(), std::move(func)});
+  return TimerWheel::Schedule(timers_, time, std::move(task));
+}
+
+TaskScheduler::Statistics WorkStealingTaskScheduler::GetStatistics() const {
+  return statistics_->Get();
+}
+
+void WorkStealingTaskScheduler::SetSlowTaskCallback(
+    std::chrono::milliseconds threshold, SlowTaskCallback callback) {
+  statistics_->SetSlowTaskCallback(threshold, std::move(callback));
+}
+
+}  // namespace thread
+}  // namespace olp
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <olp/core/client/AdaptiveConcurrencyLimiter.h>
+#include <olp/core/http/HttpStatusCode.h>
+#include <olp/core/http/NetworkTypes.h>
+
+namespace {
+
+using olp::client::AdaptiveConcurrencyLimiter;
+using olp::client::AdaptiveConcurrencySettings;
+using Outcome = AdaptiveConcurrencyLimiter::Outcome;
+
+/// Simulates a link that serves `capacity` requests in parallel within the
+/// base latency and shares its bandwidth between the additional requests.
+class SimulatedLink {
+ public:
+  SimulatedLink(AdaptiveConcurrencyLimiter& limiter, size_t capacity)
+      : limiter_(limiter), capacity_(capacity) {}
+
+  void SetCapacity(size_t capacity) { capacity_ = capacity; }
+
+  /// Runs the simulation with an unlimited demand, in milliseconds steps.
+  void Run(std::chrono::milliseconds duration) {
+    const auto end = now_ + duration.count();
+    for (; now_ < end; ++now_) {
+      while (limiter_.GetQueueSize() < 10u) {
+        limiter_.Acquire([this] { Start(); });
+      }
+
+      auto due = std::partition(
+          requests_.begin(), requests_.end(),
+          [this](const Request& request) { return request.end > now_; });
+      std::vector<Request> completed(due, requests_.end());
+      requests_.erase(due, requests_.end());
+
+      for (const auto& request : completed) {
+        limiter_.Update(std::chrono::milliseconds(now_ - request.start),
+                        request.outcome);
+        ++completed_;
+        limiter_.Release();
+      }
+    }
+  }
+
+  size_t GetCompleted() const { return completed_; }
+
+ private:
+  static constexpr long kBaseLatency = 20;
+
+  struct Request {
+    long start;
+    long end;
+    Outcome outcome;
+  };
+
+  void Start() {
+    const auto load = requests_.size() + 1u;
+    Request request{now_, now_ + kBaseLatency, Outcome::kSuccess};
+    if (load > 4u * capacity_) {
+      // The server sheds the load.
+      request.outcome = Outcome::kOverload;
+    } else if (load > capacity_) {
+      request.end = now_ + kBaseLatency * static_cast<long>(load) /
+                               static_cast<long>(capacity_);
+    }
+    requests_.push_back(request);
+  }
+
+  AdaptiveConcurrencyLimiter& limiter_;
+  size_t capacity_;
+  long now_ = 0;
+  size_t completed_ = 0u;
+  std::vector<Request> requests_;
+};
+
+constexpr long SimulatedLink::kBaseLatency;
+
+TEST(AdaptiveConcurrencyLimiterTest, Classify) {
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::Classify(
+                olp::http::HttpStatusCode::OK),
+            Outcome::kSuccess);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::Classify(
+                olp::http::HttpStatusCode::NOT_FOUND),
+            Outcome::kSuccess);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::Classify(
+                olp::http::HttpStatusCode::TOO_MANY_REQUESTS),
+            Outcome::kOverload);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::Classify(
+                olp::http::HttpStatusCode::SERVICE_UNAVAILABLE),
+            Outcome::kOverload);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::Classify(
+                static_cast<int>(olp::http::ErrorCode::TIMEOUT_ERROR)),
+            Outcome::kOverload);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::Classify(
+                static_cast<int>(olp::http::ErrorCode::CANCELLED_ERROR)),
+            Outcome::kIgnored);
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, AcquireAndRelease) {
+  AdaptiveConcurrencySettings settings;
+  settings.initial_limit = 2u;
+  AdaptiveConcurrencyLimiter limiter(settings);
+
+  size_t started = 0u;
+  for (auto i = 0; i < 3; ++i) {
+    limiter.Acquire([&] { ++started; });
+  }
+  EXPECT_EQ(started, 2u);
+  EXPECT_EQ(limiter.GetInFlight(), 2u);
+  EXPECT_EQ(limiter.GetQueueSize(), 1u);
+
+  limiter.Release();
+  EXPECT_EQ(started, 3u);
+  EXPECT_EQ(limiter.GetQueueSize(), 0u);
+
+  // A task that releases its slot synchronously lets the next one run.
+  limiter.Release();
+  limiter.Release();
+  for (auto i = 0; i < 1000; ++i) {
+    limiter.Acquire([&] {
+      ++started;
+      limiter.Release();
+    });
+  }
+  EXPECT_EQ(started, 1003u);
+  EXPECT_EQ(limiter.GetInFlight(), 0u);
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, BacksOffOncePerRoundTrip) {
+  AdaptiveConcurrencySettings settings;
+  settings.initial_limit = 16u;
+  AdaptiveConcurrencyLimiter limiter(settings);
+
+  for (auto i = 0; i < 16; ++i) {
+    limiter.Acquire([] {});
+  }
+
+  // The whole window of requests fails, but the limit is halved only once.
+  for (auto i = 0; i < 16; ++i) {
+    limiter.Update(std::chrono::milliseconds(10), Outcome::kOverload);
+    limiter.Release();
+  }
+  EXPECT_EQ(limiter.GetLimit(), 8u);
+
+  limiter.Acquire([] {});
+  limiter.Update(std::chrono::milliseconds(10), Outcome::kOverload);
+  limiter.Release();
+  EXPECT_EQ(limiter.GetLimit(), 4u);
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, SimulatedLinkConvergence) {
+  AdaptiveConcurrencyLimiter limiter;
+  SimulatedLink link(limiter, 24u);
+
+  // With the default latency tolerance of 2, the limit oscillates between
+  // the link capacity and twice the capacity.
+  {
+    SCOPED_TRACE("Fast link");
+    link.Run(std::chrono::seconds(10));
+    EXPECT_GE(limiter.GetLimit(), 12u);
+    EXPECT_LE(limiter.GetLimit(), 52u);
+  }
+
+  {
+    SCOPED_TRACE("Congested link");
+    link.SetCapacity(3u);
+    link.Run(std::chrono::seconds(10));
+    EXPECT_LE(limiter.GetLimit(), 8u);
+  }
+
+  {
+    SCOPED_TRACE("Recovered link");
+    link.SetCapacity(24u);
+    const auto completed = link.GetCompleted();
+    link.Run(std::chrono::seconds(10));
+    EXPECT_GE(limiter.GetLimit(), 12u);
+    // Close to the capacity of 24 requests per 20 ms.
+    EXPECT_GE(link.GetCompleted() - completed, 6000u);
+  }
+}
+
+}  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -38,6 +38,11 @@ constexpr auto kResponseLookupResource =
 constexpr auto kResponseLookupPlatform =
     R"jsonString([{"api":"config","version":"v1","baseURL":"https://config.data.api.platform.sit.here.com/config/v1","parameters":{}},{"api":"pipelines","version":"v1","baseURL":"https://pipelines.api.platform.sit.here.com/pipeline-service","parameters":{}},{"api":"pipelines","version":"v2","baseURL":"https://pipelines.api.platform.sit.here.com/pipeline-service","parameters":{}}])jsonString";
 
+MATCHER_P(IsHeadRequest, url, "") {
+  return olp::http::NetworkRequest::HttpVerb::HEAD == arg.GetVerb() &&
+         url == arg.GetUrl();
+}
+
 class ApiLookupClientImplTestable : public client::ApiLookupClientImpl {
  public:
   ApiLookupClientImplTestable(const client::HRN& catalog,
@@ -529,6 +534,56 @@ TEST_F(ApiLookupClientImplTest, CustomCatalogProvider) {
   }
 }
 
+TEST_F(ApiLookupClientImplTest, PrewarmConnections) {
+  const std::string catalog =
+      "hrn:here:data::olp-here-test:hereos-internal-test-v2";
+  const auto catalog_hrn = client::HRN::FromString(catalog);
+  const std::string lookup_url =
+      "https://api-lookup.data.api.platform.here.com/lookup/v1/resources/" +
+      catalog + "/apis";
+
+  settings_.api_lookup_settings.prewarm_connections = true;
+
+  // One request for every host, even though there are several services.
+  EXPECT_CALL(*network_, Send(IsGetRequest(lookup_url), _, _, _, _))
+      .Times(2)
+      .WillRepeatedly(ReturnHttpResponse(
+          olp::http::NetworkResponse().WithStatus(
+              olp::http::HttpStatusCode::OK),
+          kResponseLookupResource));
+  EXPECT_CALL(*network_,
+              Send(IsHeadRequest(
+                       "https://config.data.api.platform.sit.here.com/"),
+                   _, _, _, _))
+      .WillOnce(Return(olp::http::SendOutcome(10)));
+  EXPECT_CALL(
+      *network_,
+      Send(IsHeadRequest("https://pipelines.api.platform.sit.here.com/"), _, _,
+           _, _))
+      .WillOnce(Return(olp::http::SendOutcome(11)));
+  EXPECT_CALL(*cache_, Put(_, _, _, _)).Times(0);
+
+  client::CancellationContext context;
+  client::ApiLookupClientImpl client(catalog_hrn, settings_);
+  auto response = client.LookupApi("random_service", "v8",
+                                   client::OnlineOnly, context);
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(response.GetResult().GetBaseUrl(), kConfigBaseUrl);
+
+  // The other services are resolved by the same lookup.
+  response = client.LookupApi("pipelines", "v2", client::CacheOnly, context);
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(response.GetResult().GetBaseUrl(),
+            "https://pipelines.api.platform.sit.here.com/pipeline-service");
+
+  // The hosts are not prewarmed again.
+  response = client.LookupApi("pipelines", "v1", client::OnlineOnly, context);
+  ASSERT_TRUE(response.IsSuccessful());
+
+  testing::Mock::VerifyAndClearExpectations(network_.get());
+  testing::Mock::VerifyAndClearExpectations(cache_.get());
+}
+
 TEST_F(ApiLookupClientImplTest, LookupApiAsync) {
   const std::string catalog =
       "hrn:here:data::olp-here-test:hereos-internal-test-v2";
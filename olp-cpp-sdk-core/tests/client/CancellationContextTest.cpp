@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,11 +17,15 @@
  * License-Filename: LICENSE
  */
 
+#include <future>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include <olp/core/client/CancellationContext.h>
 
 using olp::client::CancellationContext;
+using olp::client::CancellationToken;
 
 TEST(CancellationContextTest, CancelOperation) {
   CancellationContext context;
@@ -52,3 +56,55 @@ TEST(CancellationContextTest, MoveAndCancelOperation) {
   EXPECT_FALSE(context.IsCancelled());
   EXPECT_TRUE(context_move.IsCancelled());
 }
+
+TEST(CancellationContextTest, ExecuteOrCancelled) {
+  CancellationContext context;
+  auto cancelled = 0;
+
+  EXPECT_TRUE(context.ExecuteOrCancelled(
+      [&]() { return CancellationToken([&]() { ++cancelled; }); }));
+  EXPECT_EQ(cancelled, 0);
+
+  context.CancelOperation();
+  EXPECT_EQ(cancelled, 1);
+
+  // The token is cancelled once, the next function is not executed.
+  context.CancelOperation();
+  auto cancel_called = false;
+  EXPECT_FALSE(context.ExecuteOrCancelled(
+      []() -> CancellationToken {
+        ADD_FAILURE() << "Executed on a cancelled context";
+        return CancellationToken();
+      },
+      [&]() { cancel_called = true; }));
+  EXPECT_TRUE(cancel_called);
+  EXPECT_EQ(cancelled, 1);
+}
+
+TEST(CancellationContextTest, CancelWhileExecuting) {
+  CancellationContext context;
+  std::promise<void> executing;
+  std::promise<void> cancel_requested;
+  auto cancelled = false;
+
+  std::thread thread([&]() {
+    context.ExecuteOrCancelled([&]() {
+      executing.set_value();
+      cancel_requested.get_future().wait();
+      return CancellationToken([&]() { cancelled = true; });
+    });
+  });
+
+  executing.get_future().wait();
+  std::thread cancel_thread([&]() { context.CancelOperation(); });
+
+  // The state is visible at once, the token is cancelled once registered.
+  while (!context.IsCancelled()) {
+    std::this_thread::yield();
+  }
+  cancel_requested.set_value();
+
+  thread.join();
+  cancel_thread.join();
+  EXPECT_TRUE(cancelled);
+}
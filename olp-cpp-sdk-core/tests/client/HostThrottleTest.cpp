@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <chrono>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <olp/core/http/HttpStatusCode.h>
+#include <olp/core/http/NetworkConstants.h>
+#include "client/HostThrottle.h"
+
+namespace {
+
+using olp::client::HostThrottle;
+using olp::client::HttpResponse;
+using olp::client::RateLimitSettings;
+using olp::client::RetryBudgetSettings;
+using olp::http::HttpStatusCode;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+HttpResponse MakeResponse(int status, std::string retry_after) {
+  olp::http::Headers headers = {
+      {olp::http::kRetryAfterHeader, std::move(retry_after)}};
+  return HttpResponse(status, std::stringstream(), std::move(headers));
+}
+
+TEST(HostThrottleTest, GetRetryAfter) {
+  {
+    SCOPED_TRACE("Delay in seconds");
+    const auto retry_after = HostThrottle::GetRetryAfter(
+        MakeResponse(HttpStatusCode::TOO_MANY_REQUESTS, "3"));
+    ASSERT_TRUE(retry_after);
+    EXPECT_EQ(*retry_after, seconds(3));
+  }
+  {
+    SCOPED_TRACE("Date in the past");
+    const auto retry_after = HostThrottle::GetRetryAfter(MakeResponse(
+        HttpStatusCode::SERVICE_UNAVAILABLE, "Wed, 21 Oct 2015 07:28:00 GMT"));
+    ASSERT_TRUE(retry_after);
+    EXPECT_EQ(*retry_after, milliseconds(0));
+  }
+  {
+    SCOPED_TRACE("Date in the future");
+    const auto retry_after = HostThrottle::GetRetryAfter(MakeResponse(
+        HttpStatusCode::SERVICE_UNAVAILABLE, "Fri, 01 Jan 2100 00:00:00 GMT"));
+    ASSERT_TRUE(retry_after);
+    EXPECT_GT(*retry_after, seconds(0));
+  }
+  {
+    SCOPED_TRACE("Delay overflowing milliseconds");
+    const auto retry_after = HostThrottle::GetRetryAfter(
+        MakeResponse(HttpStatusCode::TOO_MANY_REQUESTS,
+                     "99999999999999999999999999999999999999"));
+    ASSERT_TRUE(retry_after);
+    EXPECT_EQ(*retry_after, std::chrono::hours(24));
+  }
+  {
+    SCOPED_TRACE("Invalid value");
+    EXPECT_FALSE(HostThrottle::GetRetryAfter(
+        MakeResponse(HttpStatusCode::TOO_MANY_REQUESTS, "soon")));
+  }
+  {
+    SCOPED_TRACE("Not a throttling response");
+    EXPECT_FALSE(
+        HostThrottle::GetRetryAfter(MakeResponse(HttpStatusCode::OK, "3")));
+  }
+}
+
+TEST(HostThrottleTest, GetSharesHostState) {
+  EXPECT_EQ(HostThrottle::Get("https://throttle.here.com/a"),
+            HostThrottle::Get("https://throttle.here.com/b?c=d"));
+  EXPECT_NE(HostThrottle::Get("https://throttle.here.com/a"),
+            HostThrottle::Get("https://other.here.com/a"));
+}
+
+TEST(HostThrottleTest, Reserve) {
+  RateLimitSettings settings;
+  settings.requests_per_second = 10.0;
+  settings.burst = 2u;
+  settings.throttle_period = seconds(60);
+
+  HostThrottle throttle;
+  const auto now = HostThrottle::Clock::now();
+
+  // Not limited before the first rejection.
+  EXPECT_EQ(throttle.Reserve(settings, now), milliseconds(0));
+  EXPECT_EQ(throttle.Reserve(settings, now), milliseconds(0));
+
+  throttle.OnRejected(olp::porting::none, settings, now);
+
+  // The burst is sent right away, then the requests are spaced.
+  EXPECT_EQ(throttle.Reserve(settings, now), milliseconds(0));
+  EXPECT_EQ(throttle.Reserve(settings, now), milliseconds(0));
+  EXPECT_EQ(throttle.Reserve(settings, now), milliseconds(100));
+  EXPECT_EQ(throttle.Reserve(settings, now), milliseconds(200));
+
+  // The reservations are released by time.
+  EXPECT_EQ(throttle.Reserve(settings, now + seconds(1)), milliseconds(0));
+
+  // The limiting stops after the throttle period.
+  const auto later = now + seconds(61);
+  for (auto i = 0; i < 5; ++i) {
+    EXPECT_EQ(throttle.Reserve(settings, later), milliseconds(0));
+  }
+}
+
+TEST(HostThrottleTest, RetryAfterBlocksRequests) {
+  RateLimitSettings settings;
+  HostThrottle throttle;
+  const auto now = HostThrottle::Clock::now();
+
+  throttle.OnRejected(milliseconds(1500), settings, now);
+
+  EXPECT_EQ(throttle.Reserve(settings, now), milliseconds(1500));
+  EXPECT_EQ(throttle.Reserve(settings, now + seconds(1)), milliseconds(500));
+  EXPECT_EQ(throttle.Reserve(settings, now + seconds(2)), milliseconds(0));
+}
+
+TEST(HostThrottleTest, RetryBudget) {
+  RetryBudgetSettings settings;
+  settings.budget_ratio = 0.5;
+  settings.max_budget = 2.0;
+
+  HostThrottle throttle;
+
+  // The budget starts full.
+  EXPECT_TRUE(throttle.TryRetry(settings));
+  EXPECT_TRUE(throttle.TryRetry(settings));
+  EXPECT_FALSE(throttle.TryRetry(settings));
+
+  // Every request earns a part of a retry.
+  throttle.OnRequest(settings);
+  EXPECT_FALSE(throttle.TryRetry(settings));
+  throttle.OnRequest(settings);
+  EXPECT_TRUE(throttle.TryRetry(settings));
+
+  // The budget is capped.
+  for (auto i = 0; i < 10; ++i) {
+    throttle.OnRequest(settings);
+  }
+  EXPECT_TRUE(throttle.TryRetry(settings));
+  EXPECT_TRUE(throttle.TryRetry(settings));
+  EXPECT_FALSE(throttle.TryRetry(settings));
+}
+
+}  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include <chrono>
 #include <future>
 #include <queue>
+#include <sstream>
 #include <string>
 #include <thread>
 
@@ -33,6 +34,7 @@
 #include <olp/core/http/Network.h>
 #include <olp/core/http/NetworkConstants.h>
 #include <olp/core/logging/Log.h>
+#include <olp/core/thread/ThreadPoolTaskScheduler.h>
 
 namespace {
 using olp::client::HttpResponse;
@@ -1753,10 +1755,722 @@ TEST_P(OlpClientTest, ErrorOnTokenRequest) {
   testing::Mock::VerifyAndClearExpectations(network.get());
 }
 
+TEST_P(OlpClientTest, RetryAfterDelaysRetry) {
+  auto network = network_;
+  client_settings_.retry_settings.max_attempts = 1;
+  client_settings_.retry_settings.retry_condition =
+      [](const olp::client::HttpResponse&) { return true; };
+  client_settings_.retry_settings.backdown_strategy =
+      [](std::chrono::milliseconds, size_t) {
+        return std::chrono::milliseconds(0);
+      };
+
+  olp::client::OlpClient client(client_settings_, kEmptyBaseUrl);
+
+  std::vector<std::future<void>> futures;
+  olp::http::RequestId request_id = 5;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          [&](olp::http::NetworkRequest /*request*/,
+              olp::http::Network::Payload /*payload*/,
+              olp::http::Network::Callback callback,
+              olp::http::Network::HeaderCallback header_callback,
+              olp::http::Network::DataCallback /*data_callback*/) {
+            auto current_request_id = request_id++;
+            futures.emplace_back(std::async(std::launch::async, [=]() {
+              header_callback(http::kRetryAfterHeader, "1");
+              callback(http::NetworkResponse()
+                           .WithRequestId(current_request_id)
+                           .WithStatus(
+                               http::HttpStatusCode::TOO_MANY_REQUESTS));
+            }));
+            return olp::http::SendOutcome(current_request_id);
+          });
+
+  const auto start = std::chrono::steady_clock::now();
+
+  auto call_wrapper = MakeCallWrapper(client);
+  auto response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+
+  EXPECT_EQ(http::HttpStatusCode::TOO_MANY_REQUESTS, response.GetStatus());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+  testing::Mock::VerifyAndClearExpectations(network.get());
+}
+
+TEST_P(OlpClientTest, RetryAfterExceedsTimeout) {
+  auto network = network_;
+  client_settings_.retry_settings.max_attempts = 3;
+  client_settings_.retry_settings.timeout = 10;
+  client_settings_.retry_settings.retry_condition =
+      [](const olp::client::HttpResponse&) { return true; };
+
+  olp::client::OlpClient client(client_settings_, kEmptyBaseUrl);
+
+  std::vector<std::future<void>> futures;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback header_callback,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        futures.emplace_back(std::async(std::launch::async, [=]() {
+          header_callback(http::kRetryAfterHeader, "120");
+          callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+              http::HttpStatusCode::SERVICE_UNAVAILABLE));
+        }));
+        return olp::http::SendOutcome(5);
+      });
+
+  auto call_wrapper = MakeCallWrapper(client);
+  auto response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+
+  // The request is not retried, as the server asked to wait for too long.
+  EXPECT_EQ(http::HttpStatusCode::SERVICE_UNAVAILABLE, response.GetStatus());
+  testing::Mock::VerifyAndClearExpectations(network.get());
+}
+
+TEST_P(OlpClientTest, RateLimitedHostFailsWithoutWaiting) {
+  auto network = network_;
+  client_settings_.retry_settings.max_attempts = 0;
+  client_settings_.retry_settings.timeout = 1;
+  client_settings_.retry_settings.rate_limit_settings =
+      olp::client::RateLimitSettings();
+
+  // The host state is shared by the process, so every run uses its own host.
+  const auto host = "https://throttled" +
+                    std::to_string(static_cast<int>(GetParam())) + ".here.com";
+  olp::client::OlpClient client(client_settings_, host);
+
+  std::vector<std::future<void>> futures;
+
+  // The rejected request blocks the host for longer than the timeout.
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback header_callback,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        futures.emplace_back(std::async(std::launch::async, [=]() {
+          header_callback(http::kRetryAfterHeader, "5");
+          callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+              http::HttpStatusCode::TOO_MANY_REQUESTS));
+        }));
+        return olp::http::SendOutcome(5);
+      });
+
+  auto call_wrapper = MakeCallWrapper(client);
+  auto response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+
+  EXPECT_EQ(http::HttpStatusCode::TOO_MANY_REQUESTS, response.GetStatus());
+  testing::Mock::VerifyAndClearExpectations(network.get());
+
+  // The next request is not sent and the calling thread does not wait.
+  EXPECT_CALL(*network, Send(_, _, _, _, _)).Times(0);
+
+  const auto start = std::chrono::steady_clock::now();
+  response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  EXPECT_EQ(http::HttpStatusCode::TOO_MANY_REQUESTS, response.GetStatus());
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+  testing::Mock::VerifyAndClearExpectations(network.get());
+}
+
+TEST_P(OlpClientTest, RateLimitedHostMergesWaitingRequests) {
+  auto network = network_;
+  client_settings_.task_scheduler =
+      std::make_shared<olp::thread::ThreadPoolTaskScheduler>(1u);
+  client_settings_.retry_settings.max_attempts = 0;
+  client_settings_.retry_settings.timeout = 5;
+  client_settings_.retry_settings.rate_limit_settings =
+      olp::client::RateLimitSettings();
+
+  // The host state is shared by the process, so every run uses its own host.
+  const auto host = "https://throttled-merge" +
+                    std::to_string(static_cast<int>(GetParam())) + ".here.com";
+  olp::client::OlpClient client(client_settings_, host);
+
+  std::vector<std::future<void>> futures;
+
+  // The rejected request blocks the host for a second.
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback header_callback,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        futures.emplace_back(std::async(std::launch::async, [=]() {
+          header_callback(http::kRetryAfterHeader, "1");
+          callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+              http::HttpStatusCode::TOO_MANY_REQUESTS));
+        }));
+        return olp::http::SendOutcome(5);
+      });
+
+  auto call_wrapper = MakeCallWrapper(client);
+  auto response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+  futures.clear();
+
+  EXPECT_EQ(http::HttpStatusCode::TOO_MANY_REQUESTS, response.GetStatus());
+  testing::Mock::VerifyAndClearExpectations(network.get());
+
+  // The request waiting for the host is sent once for both callers.
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback /*header_callback*/,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        futures.emplace_back(std::async(std::launch::async, [=]() {
+          callback(http::NetworkResponse().WithRequestId(6).WithStatus(
+              http::HttpStatusCode::OK));
+        }));
+        return olp::http::SendOutcome(6);
+      });
+
+  std::promise<HttpResponse> first_promise;
+  std::promise<HttpResponse> second_promise;
+  client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                 [&](HttpResponse response) {
+                   first_promise.set_value(std::move(response));
+                 });
+  client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                 [&](HttpResponse response) {
+                   second_promise.set_value(std::move(response));
+                 });
+
+  EXPECT_EQ(http::HttpStatusCode::OK,
+            first_promise.get_future().get().GetStatus());
+  EXPECT_EQ(http::HttpStatusCode::OK,
+            second_promise.get_future().get().GetStatus());
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+  testing::Mock::VerifyAndClearExpectations(network.get());
+}
+
+TEST_P(OlpClientTest, RateLimitedHostCancelsWaitingRequest) {
+  auto network = network_;
+  client_settings_.task_scheduler =
+      std::make_shared<olp::thread::ThreadPoolTaskScheduler>(1u);
+  client_settings_.retry_settings.max_attempts = 0;
+  client_settings_.retry_settings.timeout = 30;
+  client_settings_.retry_settings.rate_limit_settings =
+      olp::client::RateLimitSettings();
+
+  // The host state is shared by the process, so every run uses its own host.
+  const auto host = "https://throttled-cancel" +
+                    std::to_string(static_cast<int>(GetParam())) + ".here.com";
+  olp::client::OlpClient client(client_settings_, host);
+
+  std::vector<std::future<void>> futures;
+
+  // The rejected request blocks the host for longer than the test waits.
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback header_callback,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        futures.emplace_back(std::async(std::launch::async, [=]() {
+          header_callback(http::kRetryAfterHeader, "20");
+          callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+              http::HttpStatusCode::TOO_MANY_REQUESTS));
+        }));
+        return olp::http::SendOutcome(5);
+      });
+
+  auto call_wrapper = MakeCallWrapper(client);
+  auto response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+
+  EXPECT_EQ(http::HttpStatusCode::TOO_MANY_REQUESTS, response.GetStatus());
+  testing::Mock::VerifyAndClearExpectations(network.get());
+
+  // The cancelled request completes without waiting for the host.
+  EXPECT_CALL(*network, Send(_, _, _, _, _)).Times(0);
+
+  std::promise<HttpResponse> promise;
+  auto token = client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                              [&](HttpResponse response) {
+                                promise.set_value(std::move(response));
+                              });
+  token.Cancel();
+
+  auto future = promise.get_future();
+  ASSERT_EQ(std::future_status::ready,
+            future.wait_for(std::chrono::seconds(5)));
+  EXPECT_EQ(static_cast<int>(http::ErrorCode::CANCELLED_ERROR),
+            future.get().GetStatus());
+  testing::Mock::VerifyAndClearExpectations(network.get());
+}
+
+TEST_P(OlpClientTest, RetryBudget) {
+  auto network = network_;
+  client_settings_.retry_settings.max_attempts = 3;
+  client_settings_.retry_settings.retry_condition =
+      [](const olp::client::HttpResponse&) { return true; };
+  client_settings_.retry_settings.backdown_strategy =
+      [](std::chrono::milliseconds, size_t) {
+        return std::chrono::milliseconds(0);
+      };
+  // Every request earns a single retry.
+  olp::client::RetryBudgetSettings budget_settings;
+  budget_settings.budget_ratio = 1.0;
+  budget_settings.max_budget = 1.0;
+  client_settings_.retry_settings.retry_budget_settings = budget_settings;
+
+  olp::client::OlpClient client(client_settings_, "https://budget.here.com");
+
+  std::vector<std::future<void>> futures;
+  olp::http::RequestId request_id = 5;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          [&](olp::http::NetworkRequest /*request*/,
+              olp::http::Network::Payload /*payload*/,
+              olp::http::Network::Callback callback,
+              olp::http::Network::HeaderCallback /*header_callback*/,
+              olp::http::Network::DataCallback /*data_callback*/) {
+            auto current_request_id = request_id++;
+            futures.emplace_back(std::async(std::launch::async, [=]() {
+              callback(http::NetworkResponse()
+                           .WithRequestId(current_request_id)
+                           .WithStatus(
+                               http::HttpStatusCode::TOO_MANY_REQUESTS));
+            }));
+            return olp::http::SendOutcome(current_request_id);
+          });
+
+  auto call_wrapper = MakeCallWrapper(client);
+  auto response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+
+  EXPECT_EQ(http::HttpStatusCode::TOO_MANY_REQUESTS, response.GetStatus());
+  testing::Mock::VerifyAndClearExpectations(network.get());
+}
+
+TEST_P(OlpClientTest, RetryOnTaskScheduler) {
+  auto network = network_;
+  const auto backdown_period = std::chrono::milliseconds(100);
+  client_settings_.task_scheduler =
+      std::make_shared<olp::thread::ThreadPoolTaskScheduler>(1u);
+  client_settings_.retry_settings.max_attempts = 1;
+  client_settings_.retry_settings.retry_condition =
+      [](const olp::client::HttpResponse& response) {
+        return response.GetStatus() ==
+               http::HttpStatusCode::SERVICE_UNAVAILABLE;
+      };
+  client_settings_.retry_settings.backdown_strategy =
+      [=](std::chrono::milliseconds, size_t) { return backdown_period; };
+
+  olp::client::OlpClient client(client_settings_, kEmptyBaseUrl);
+
+  std::vector<std::future<void>> futures;
+  // Reserved, so the references passed to the callbacks stay valid.
+  std::vector<std::chrono::steady_clock::duration> callback_durations;
+  callback_durations.reserve(2u);
+  olp::http::RequestId request_id = 5;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          [&](olp::http::NetworkRequest /*request*/,
+              olp::http::Network::Payload /*payload*/,
+              olp::http::Network::Callback callback,
+              olp::http::Network::HeaderCallback /*header_callback*/,
+              olp::http::Network::DataCallback /*data_callback*/) {
+            auto current_request_id = request_id++;
+            const auto status = current_request_id == 5
+                                    ? http::HttpStatusCode::SERVICE_UNAVAILABLE
+                                    : http::HttpStatusCode::OK;
+            auto& duration = *callback_durations.emplace(
+                callback_durations.end(),
+                std::chrono::steady_clock::duration::zero());
+            futures.emplace_back(
+                std::async(std::launch::async, [=, &duration]() {
+                  const auto start = std::chrono::steady_clock::now();
+                  callback(http::NetworkResponse()
+                               .WithRequestId(current_request_id)
+                               .WithStatus(status));
+                  duration = std::chrono::steady_clock::now() - start;
+                }));
+            return olp::http::SendOutcome(current_request_id);
+          });
+
+  const auto start = std::chrono::steady_clock::now();
+
+  auto call_wrapper = MakeCallWrapper(client);
+  auto response = call_wrapper->CallApi({}, "GET", {}, {}, {}, nullptr, {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+
+  EXPECT_EQ(http::HttpStatusCode::OK, response.GetStatus());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, backdown_period);
+  // The network thread is not blocked while waiting for the retry.
+  ASSERT_EQ(callback_durations.size(), 2u);
+  EXPECT_LT(callback_durations.front(), backdown_period);
+  testing::Mock::VerifyAndClearExpectations(network.get());
+}
+
 INSTANTIATE_TEST_SUITE_P(, OlpClientTest,
                          ::testing::Values(CallApiType::ASYNC,
                                            CallApiType::SYNC));
 
+TEST(OlpClientBodyStreamTest, RewindsBodyStreamOnRetry) {
+  auto network = std::make_shared<NetworkMock>();
+  olp::client::OlpClientSettings settings;
+  settings.network_request_handler = network;
+  settings.retry_settings.max_attempts = 1;
+  settings.retry_settings.initial_backdown_period = 10;
+  olp::client::OlpClient client(settings, kEmptyBaseUrl);
+
+  const std::string body = "streamed body";
+  auto stream = std::make_shared<std::stringstream>("prefix:" + body);
+  stream->seekg(7);
+
+  std::vector<std::string> sent_bodies;
+  std::vector<std::future<void>> futures;
+  olp::http::RequestId request_id = 5;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .Times(2)
+      .WillRepeatedly([&](olp::http::NetworkRequest request,
+                          olp::http::Network::Payload /*payload*/,
+                          olp::http::Network::Callback callback,
+                          olp::http::Network::HeaderCallback /*header_cb*/,
+                          olp::http::Network::DataCallback /*data_cb*/) {
+        const auto& size = request.GetBodyStreamSize();
+        EXPECT_TRUE(size);
+        EXPECT_EQ(*size, body.size());
+
+        const auto& body_stream = request.GetBodyStream();
+        EXPECT_TRUE(body_stream);
+        sent_bodies.emplace_back(std::istreambuf_iterator<char>(*body_stream),
+                                 std::istreambuf_iterator<char>());
+
+        auto response = sent_bodies.size() == 1u
+                            ? kToManyRequestResponse
+                            : http::NetworkResponse().WithStatus(
+                                  http::HttpStatusCode::OK);
+        response.WithRequestId(request_id);
+        futures.emplace_back(std::async(std::launch::async, [=]() {
+          std::this_thread::sleep_for(kCallbackSleepTime);
+          callback(response);
+        }));
+        return olp::http::SendOutcome(request_id++);
+      });
+
+  auto response = client.CallApiWithBodyStream(
+      {}, "PUT", {}, {}, stream, body.size(), "text/plain", {});
+
+  for (auto& future : futures) {
+    future.wait();
+  }
+
+  EXPECT_EQ(response.GetStatus(), http::HttpStatusCode::OK);
+  EXPECT_THAT(sent_bodies, testing::ElementsAre(body, body));
+}
+
+TEST(OlpClientHedgingTest, HedgesSlowRequest) {
+  auto network = std::make_shared<NetworkMock>();
+  olp::client::OlpClientSettings settings;
+  settings.network_request_handler = network;
+  olp::client::HedgingSettings hedging_settings;
+  hedging_settings.initial_delay = std::chrono::milliseconds(50);
+  hedging_settings.budget_ratio = 1.0;
+  settings.retry_settings.hedging_settings = hedging_settings;
+  olp::client::OlpClient client(settings, kEmptyBaseUrl);
+
+  const std::string body = "hedged response";
+  olp::http::Network::Callback slow_callback;
+  std::future<void> future;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback /*header_callback*/,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        // The first request does not respond until it is cancelled.
+        slow_callback = std::move(callback);
+        return olp::http::SendOutcome(5);
+      })
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload payload,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback /*header_callback*/,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        future = std::async(std::launch::async, [=]() {
+          payload->write(body.c_str(), body.size());
+          callback(http::NetworkResponse().WithRequestId(6).WithStatus(
+              http::HttpStatusCode::OK));
+        });
+        return olp::http::SendOutcome(6);
+      });
+
+  EXPECT_CALL(*network, Cancel(5)).WillOnce([&](olp::http::RequestId) {
+    slow_callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+        static_cast<int>(http::ErrorCode::CANCELLED_ERROR)));
+  });
+
+  auto response = client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                                 olp::client::CancellationContext{});
+  future.wait();
+
+  EXPECT_EQ(response.GetStatus(), http::HttpStatusCode::OK);
+  std::string response_body;
+  response.GetResponse(response_body);
+  EXPECT_EQ(response_body, body);
+}
+
+TEST(OlpClientHedgingTest, RespectsBudget) {
+  auto network = std::make_shared<NetworkMock>();
+  olp::client::OlpClientSettings settings;
+  settings.network_request_handler = network;
+  olp::client::HedgingSettings hedging_settings;
+  hedging_settings.initial_delay = std::chrono::milliseconds(10);
+  hedging_settings.budget_ratio = 0.0;
+  settings.retry_settings.hedging_settings = hedging_settings;
+  olp::client::OlpClient client(settings, kEmptyBaseUrl);
+
+  std::future<void> future;
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback /*header_callback*/,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        future = std::async(std::launch::async, [=]() {
+          std::this_thread::sleep_for(kCallbackSleepTime);
+          callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+              http::HttpStatusCode::OK));
+        });
+        return olp::http::SendOutcome(5);
+      });
+
+  auto response = client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                                 olp::client::CancellationContext{});
+  future.wait();
+
+  EXPECT_EQ(response.GetStatus(), http::HttpStatusCode::OK);
+}
+
+TEST(OlpClientHedgingTest, DoesNotHedgeStreamedRequest) {
+  auto network = std::make_shared<NetworkMock>();
+  olp::client::OlpClientSettings settings;
+  settings.network_request_handler = network;
+  olp::client::HedgingSettings hedging_settings;
+  hedging_settings.initial_delay = std::chrono::milliseconds(10);
+  hedging_settings.budget_ratio = 1.0;
+  settings.retry_settings.hedging_settings = hedging_settings;
+  olp::client::OlpClient client(settings, kEmptyBaseUrl);
+
+  const std::string body = "streamed response";
+  std::future<void> future;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback /*header_callback*/,
+                    olp::http::Network::DataCallback data_callback) {
+        // The data is streamed as it arrives, so the request is not hedged.
+        EXPECT_TRUE(data_callback);
+        future = std::async(std::launch::async, [=]() {
+          std::this_thread::sleep_for(kCallbackSleepTime);
+          data_callback(reinterpret_cast<const std::uint8_t*>(body.data()), 0,
+                        body.size());
+          callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+              http::HttpStatusCode::OK));
+        });
+        return olp::http::SendOutcome(5);
+      });
+
+  std::string streamed_body;
+  auto response = client.CallApiStream(
+      {}, "GET", {}, {},
+      [&](const std::uint8_t* data, std::uint64_t offset, std::size_t length) {
+        EXPECT_EQ(offset, streamed_body.size());
+        streamed_body.append(reinterpret_cast<const char*>(data), length);
+      },
+      nullptr, {}, olp::client::CancellationContext{});
+  future.wait();
+
+  EXPECT_EQ(response.GetStatus(), http::HttpStatusCode::OK);
+  EXPECT_EQ(streamed_body, body);
+}
+
+TEST(OlpClientHedgingTest, RetryableResponseWaitsForOtherAttempt) {
+  auto network = std::make_shared<NetworkMock>();
+  olp::client::OlpClientSettings settings;
+  settings.network_request_handler = network;
+  settings.task_scheduler =
+      olp::client::OlpClientSettingsFactory::CreateDefaultTaskScheduler(1);
+  olp::client::HedgingSettings hedging_settings;
+  hedging_settings.initial_delay = std::chrono::milliseconds(10);
+  hedging_settings.budget_ratio = 1.0;
+  settings.retry_settings.hedging_settings = hedging_settings;
+  // The failed response would be returned if it won.
+  settings.retry_settings.max_attempts = 0;
+  olp::client::OlpClient client(settings, kEmptyBaseUrl);
+
+  const std::string body = "slow response";
+  olp::http::Network::Callback slow_callback;
+  olp::http::Network::Payload slow_payload;
+  std::vector<std::future<void>> futures;
+
+  auto expect_attempts = [&]() {
+    EXPECT_CALL(*network, Send(_, _, _, _, _))
+        .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                      olp::http::Network::Payload payload,
+                      olp::http::Network::Callback callback,
+                      olp::http::Network::HeaderCallback /*header_callback*/,
+                      olp::http::Network::DataCallback /*data_callback*/) {
+          slow_payload = std::move(payload);
+          slow_callback = std::move(callback);
+          return olp::http::SendOutcome(5);
+        })
+        .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                      olp::http::Network::Payload /*payload*/,
+                      olp::http::Network::Callback callback,
+                      olp::http::Network::HeaderCallback /*header_callback*/,
+                      olp::http::Network::DataCallback /*data_callback*/) {
+          // The hedged request fails first, then the slow one succeeds.
+          futures.emplace_back(std::async(std::launch::async, [&, callback]() {
+            callback(http::NetworkResponse().WithRequestId(6).WithStatus(
+                http::HttpStatusCode::SERVICE_UNAVAILABLE));
+            std::this_thread::sleep_for(kCallbackSleepTime);
+            slow_payload->write(body.c_str(), body.size());
+            slow_callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+                http::HttpStatusCode::OK));
+          }));
+          return olp::http::SendOutcome(6);
+        });
+  };
+
+  {
+    SCOPED_TRACE("Sync");
+    expect_attempts();
+
+    auto response = client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                                   olp::client::CancellationContext{});
+    futures.back().wait();
+
+    EXPECT_EQ(response.GetStatus(), http::HttpStatusCode::OK);
+    std::string response_body;
+    response.GetResponse(response_body);
+    EXPECT_EQ(response_body, body);
+    testing::Mock::VerifyAndClearExpectations(network.get());
+  }
+
+  {
+    SCOPED_TRACE("Async");
+    expect_attempts();
+
+    std::promise<olp::client::HttpResponse> promise;
+    client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                   [&](olp::client::HttpResponse response) {
+                     promise.set_value(std::move(response));
+                   });
+
+    auto response = promise.get_future().get();
+    futures.back().wait();
+
+    EXPECT_EQ(response.GetStatus(), http::HttpStatusCode::OK);
+    std::string response_body;
+    response.GetResponse(response_body);
+    EXPECT_EQ(response_body, body);
+  }
+}
+
+TEST(OlpClientHedgingTest, HedgesAsyncRequest) {
+  auto network = std::make_shared<NetworkMock>();
+  olp::client::OlpClientSettings settings;
+  settings.network_request_handler = network;
+  settings.task_scheduler =
+      olp::client::OlpClientSettingsFactory::CreateDefaultTaskScheduler(1);
+  olp::client::HedgingSettings hedging_settings;
+  hedging_settings.initial_delay = std::chrono::milliseconds(50);
+  hedging_settings.budget_ratio = 1.0;
+  settings.retry_settings.hedging_settings = hedging_settings;
+  olp::client::OlpClient client(settings, kEmptyBaseUrl);
+
+  const std::string body = "hedged response";
+  olp::http::Network::Callback slow_callback;
+  std::future<void> future;
+
+  EXPECT_CALL(*network, Send(_, _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload /*payload*/,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback /*header_callback*/,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        // The first request does not respond until it is cancelled.
+        slow_callback = std::move(callback);
+        return olp::http::SendOutcome(5);
+      })
+      .WillOnce([&](olp::http::NetworkRequest /*request*/,
+                    olp::http::Network::Payload payload,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback /*header_callback*/,
+                    olp::http::Network::DataCallback /*data_callback*/) {
+        future = std::async(std::launch::async, [=]() {
+          payload->write(body.c_str(), body.size());
+          callback(http::NetworkResponse().WithRequestId(6).WithStatus(
+              http::HttpStatusCode::OK));
+        });
+        return olp::http::SendOutcome(6);
+      });
+
+  EXPECT_CALL(*network, Cancel(5)).WillOnce([&](olp::http::RequestId) {
+    slow_callback(http::NetworkResponse().WithRequestId(5).WithStatus(
+        static_cast<int>(http::ErrorCode::CANCELLED_ERROR)));
+  });
+
+  std::promise<olp::client::HttpResponse> promise;
+  client.CallApi({}, "GET", {}, {}, {}, nullptr, {},
+                 [&](olp::client::HttpResponse response) {
+                   promise.set_value(std::move(response));
+                 });
+
+  auto response = promise.get_future().get();
+  future.wait();
+
+  EXPECT_EQ(response.GetStatus(), http::HttpStatusCode::OK);
+  std::string response_body;
+  response.GetResponse(response_body);
+  EXPECT_EQ(response_body, body);
+}
+
 class OlpClientMergeTest : public ::testing::Test {
  public:
   void SetUp() override {
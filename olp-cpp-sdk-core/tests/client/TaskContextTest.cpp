@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -126,6 +126,30 @@ TEST(TaskContextTest, ExecuteSimple) {
   }
 }
 
+TEST(TaskContextTest, ExecuteLambdas) {
+  // The lambdas are stored as they are, so move-only captures are supported.
+  std::unique_ptr<std::string> value(new std::string("test"));
+  auto execute_func = std::bind(
+      [](std::unique_ptr<std::string>& value, CancellationContext) {
+        return Response(*value);
+      },
+      std::move(value), std::placeholders::_1);
+
+  Response response;
+  TaskContext context = TaskContext::Create(
+      std::move(execute_func), [&](Response r) { response = std::move(r); });
+  context.Execute();
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(response.GetResult(), "test");
+
+  // An empty callback is skipped.
+  context = TaskContext::Create(
+      [](CancellationContext) { return Response(std::string("test")); },
+      Callback());
+  context.Execute();
+  EXPECT_TRUE(context.BlockingCancel(std::chrono::milliseconds(0)));
+}
+
 TEST(TaskContextTest, BlockingCancel) {
   ExecuteFunc func = [&](CancellationContext c) -> Response {
     EXPECT_TRUE(c.IsCancelled());
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <olp/core/client/HttpResponse.h>
+#include <olp/core/http/BufferChain.h>
+
+namespace {
+
+using olp::http::BufferChain;
+using olp::http::BufferChainOutputStream;
+
+void Append(BufferChain& chain, const std::string& data) {
+  chain.Append(reinterpret_cast<const std::uint8_t*>(data.data()),
+               data.size());
+}
+
+TEST(BufferChainTest, AppendAndRead) {
+  BufferChain chain;
+  EXPECT_TRUE(chain.Empty());
+
+  Append(chain, "hello ");
+  Append(chain, "world");
+
+  EXPECT_EQ(chain.Size(), 11u);
+  EXPECT_EQ(chain.ToString(), "hello world");
+}
+
+TEST(BufferChainTest, ReleaseWithoutCopy) {
+  const std::string data(3 * BufferChain::kDefaultChunkSize, 'a');
+
+  BufferChain chain;
+  chain.Reserve(data.size());
+  Append(chain, data.substr(0, BufferChain::kDefaultChunkSize));
+  Append(chain, data.substr(BufferChain::kDefaultChunkSize));
+  ASSERT_EQ(chain.GetChunks().size(), 1u);
+
+  const auto* chunk_data = chain.GetChunks().front()->data();
+  auto released = chain.Release();
+
+  ASSERT_TRUE(released);
+  EXPECT_EQ(released->data(), chunk_data);
+  EXPECT_EQ(std::string(released->begin(), released->end()), data);
+  EXPECT_TRUE(chain.Empty());
+}
+
+TEST(BufferChainTest, CopiesShareChunks) {
+  BufferChain chain;
+  Append(chain, "shared");
+
+  BufferChain copy = chain;
+  EXPECT_EQ(copy.GetChunks().front(), chain.GetChunks().front());
+
+  // Appending to the copy must not change the original chain.
+  Append(copy, " data");
+  EXPECT_EQ(chain.ToString(), "shared");
+  EXPECT_EQ(copy.ToString(), "shared data");
+
+  // The shared chunk is copied on release.
+  auto released = chain.Release();
+  EXPECT_EQ(std::string(released->begin(), released->end()), "shared");
+  EXPECT_EQ(copy.ToString(), "shared data");
+}
+
+TEST(BufferChainTest, Truncate) {
+  BufferChain chain;
+  Append(chain, "abc");
+  BufferChain copy = chain;
+  Append(chain, std::string(BufferChain::kDefaultChunkSize, 'd'));
+
+  chain.Truncate(2u);
+  EXPECT_EQ(chain.ToString(), "ab");
+  EXPECT_EQ(copy.ToString(), "abc");
+}
+
+TEST(BufferChainTest, OutputStream) {
+  BufferChainOutputStream stream;
+  stream << "payload";
+  stream.write("-data", 5);
+
+  EXPECT_EQ(stream.tellp(), std::streampos(12));
+
+  // Rewinding the stream after writing does not discard the data.
+  stream.seekp(0);
+  EXPECT_TRUE(stream.good());
+  EXPECT_EQ(stream.GetBuffer().ToString(), "payload-data");
+}
+
+TEST(BufferChainTest, HttpResponse) {
+  BufferChain chain;
+  Append(chain, "response");
+
+  olp::client::HttpResponse response(200, std::move(chain), {});
+  olp::client::HttpResponse copy = response;
+
+  std::string body;
+  copy.GetResponse(body);
+  EXPECT_EQ(body, "response");
+
+  auto bytes = response.ReleaseResponseAsBytes();
+  EXPECT_EQ(std::string(bytes->begin(), bytes->end()), "response");
+
+  EXPECT_EQ(copy.GetRawResponse().str(), "response");
+  EXPECT_TRUE(copy.GetResponseBuffer().Empty());
+}
+
+TEST(BufferChainTest, HttpResponseReleaseWithoutCopy) {
+  const std::string data(2 * BufferChain::kDefaultChunkSize, 'a');
+
+  BufferChain chain;
+  chain.Reserve(data.size());
+  Append(chain, data);
+  ASSERT_EQ(chain.GetChunks().size(), 1u);
+  const auto* chunk_data = chain.GetChunks().front()->data();
+
+  olp::client::HttpResponse response(200, std::move(chain), {});
+  auto bytes = response.ReleaseResponseAsBytes();
+
+  // The body is moved out of the response, not copied.
+  ASSERT_TRUE(bytes);
+  EXPECT_EQ(bytes->data(), chunk_data);
+  EXPECT_EQ(bytes->size(), data.size());
+  EXPECT_TRUE(response.GetResponseBuffer().Empty());
+}
+
+}  // namespace
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mocks/NetworkMock.h>
+#include <olp/core/http/HttpStatusCode.h>
+#include <olp/core/http/adapters/DeduplicationAdapter.h>
+
+namespace {
+
+using olp::http::DeduplicationAdapter;
+using olp::http::Network;
+using olp::http::NetworkRequest;
+using olp::http::NetworkResponse;
+using olp::http::RequestId;
+using olp::http::SendOutcome;
+using testing::_;
+
+constexpr RequestId kNetworkRequestId = 7u;
+constexpr auto kUrl = "https://here.com/blob";
+
+struct Sent {
+  Network::Callback callback;
+  Network::HeaderCallback header_callback;
+  Network::DataCallback data_callback;
+};
+
+struct Caller {
+  std::shared_ptr<std::stringstream> payload =
+      std::make_shared<std::stringstream>();
+  std::vector<NetworkResponse> responses;
+  std::vector<std::string> headers;
+  RequestId id = SendOutcome::kInvalidRequestId;
+};
+
+class DeduplicationAdapterTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    network_ = std::make_shared<testing::NiceMock<NetworkMock>>();
+    ON_CALL(*network_, Send(_, _, _, _, _))
+        .WillByDefault([this](NetworkRequest, Network::Payload,
+                              Network::Callback callback,
+                              Network::HeaderCallback header_callback,
+                              Network::DataCallback data_callback) {
+          sent_.push_back({std::move(callback), std::move(header_callback),
+                           std::move(data_callback)});
+          return SendOutcome(kNetworkRequestId);
+        });
+    adapter_ = std::make_shared<DeduplicationAdapter>(network_);
+  }
+
+  void Send(Caller& caller, NetworkRequest request = NetworkRequest(kUrl)) {
+    const auto outcome = adapter_->Send(
+        std::move(request), caller.payload,
+        [&caller](NetworkResponse response) {
+          caller.responses.push_back(std::move(response));
+        },
+        [&caller](std::string name, std::string value) {
+          caller.headers.push_back(name + ": " + value);
+        },
+        nullptr);
+    ASSERT_TRUE(outcome.IsSuccessful());
+    caller.id = outcome.GetRequestId();
+  }
+
+  void Respond(const Sent& sent, const std::string& body) {
+    sent.header_callback("Content-Type", "text/plain");
+    sent.data_callback(reinterpret_cast<const std::uint8_t*>(body.data()), 0u,
+                       body.size());
+    sent.callback(NetworkResponse()
+                      .WithRequestId(kNetworkRequestId)
+                      .WithStatus(olp::http::HttpStatusCode::OK));
+  }
+
+  std::shared_ptr<testing::NiceMock<NetworkMock>> network_;
+  std::shared_ptr<DeduplicationAdapter> adapter_;
+  std::vector<Sent> sent_;
+};
+
+TEST_F(DeduplicationAdapterTest, CoalescesIdenticalRequests) {
+  Caller first, second;
+  Send(first);
+  Send(second);
+
+  ASSERT_EQ(sent_.size(), 1u);
+  EXPECT_EQ(adapter_->GetCoalescedCount(), 1u);
+  EXPECT_NE(first.id, second.id);
+
+  Respond(sent_.front(), "data");
+
+  for (const auto* caller : {&first, &second}) {
+    EXPECT_EQ(caller->payload->str(), "data");
+    EXPECT_THAT(caller->headers,
+                testing::ElementsAre("Content-Type: text/plain"));
+    ASSERT_EQ(caller->responses.size(), 1u);
+    EXPECT_EQ(caller->responses.front().GetStatus(),
+              olp::http::HttpStatusCode::OK);
+    EXPECT_EQ(caller->responses.front().GetRequestId(), caller->id);
+  }
+}
+
+TEST_F(DeduplicationAdapterTest, SendsDifferentOrStartedRequests) {
+  Caller first, with_header, post, started;
+  Send(first);
+  Send(with_header, NetworkRequest(kUrl).WithHeader("Range", "bytes=0-1"));
+  Send(post, NetworkRequest(kUrl)
+                 .WithVerb(NetworkRequest::HttpVerb::POST)
+                 .WithBody(std::make_shared<std::vector<std::uint8_t>>(1u)));
+  ASSERT_EQ(sent_.size(), 3u);
+
+  // The response has started already, so the request can not join.
+  sent_.front().header_callback("Content-Type", "text/plain");
+  Send(started);
+  EXPECT_EQ(sent_.size(), 4u);
+  EXPECT_EQ(adapter_->GetCoalescedCount(), 0u);
+}
+
+TEST_F(DeduplicationAdapterTest, Cancel) {
+  Caller first, second;
+  Send(first);
+  Send(second);
+  ASSERT_EQ(sent_.size(), 1u);
+
+  // The request is still needed by the second caller.
+  EXPECT_CALL(*network_, Cancel(_)).Times(0);
+  adapter_->Cancel(first.id);
+  testing::Mock::VerifyAndClearExpectations(network_.get());
+
+  Respond(sent_.front(), "data");
+  EXPECT_TRUE(first.payload->str().empty());
+  ASSERT_EQ(first.responses.size(), 1u);
+  EXPECT_EQ(first.responses.front().GetStatus(),
+            static_cast<int>(olp::http::ErrorCode::CANCELLED_ERROR));
+  EXPECT_EQ(second.payload->str(), "data");
+
+  // Cancelling all the callers cancels the network request.
+  Caller third, fourth;
+  Send(third);
+  Send(fourth);
+  EXPECT_CALL(*network_, Cancel(kNetworkRequestId)).Times(1);
+  adapter_->Cancel(third.id);
+  adapter_->Cancel(fourth.id);
+}
+
+}  // namespace
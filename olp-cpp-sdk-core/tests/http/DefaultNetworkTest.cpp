@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mocks/NetworkMock.h>
+
+#include "http/DefaultNetwork.h"
+
+namespace {
+
+using olp::http::DefaultNetwork;
+using olp::http::Diagnostics;
+using olp::http::Network;
+using olp::http::NetworkRequest;
+using olp::http::NetworkResponse;
+using olp::http::SendOutcome;
+using testing::_;
+
+constexpr olp::http::RequestId kRequestId = 5u;
+
+TEST(DefaultNetworkTest, HostLatencies) {
+  auto mock = std::make_shared<testing::NiceMock<NetworkMock>>();
+  DefaultNetwork network(mock);
+
+  Diagnostics diagnostics;
+  diagnostics.timings[Diagnostics::Connect] = Diagnostics::MicroSeconds(300);
+  diagnostics.available_timings.set(Diagnostics::Connect);
+  diagnostics.timings[Diagnostics::Total] = Diagnostics::MicroSeconds(1000);
+  diagnostics.available_timings.set(Diagnostics::Total);
+
+  ON_CALL(*mock, Send(_, _, _, _, _))
+      .WillByDefault([&](NetworkRequest, Network::Payload,
+                         Network::Callback callback, Network::HeaderCallback,
+                         Network::DataCallback) {
+        callback(NetworkResponse()
+                     .WithRequestId(kRequestId)
+                     .WithStatus(200)
+                     .WithDiagnostics(diagnostics));
+        return SendOutcome(kRequestId);
+      });
+
+  network.Send(NetworkRequest("https://first.here.com/a"), nullptr, nullptr);
+  network.Send(NetworkRequest("https://first.here.com/b"), nullptr, nullptr);
+  network.Send(NetworkRequest("https://second.here.com"), nullptr, nullptr);
+
+  const auto statistics = network.GetStatistics(0);
+  EXPECT_EQ(statistics.total_requests, 3u);
+  ASSERT_EQ(statistics.host_latencies.size(), 2u);
+
+  const auto& first = statistics.host_latencies.at("first.here.com");
+  EXPECT_EQ(first[Diagnostics::Connect].GetCount(), 2u);
+  EXPECT_EQ(first[Diagnostics::Total].GetMax(), std::chrono::microseconds(1000));
+  EXPECT_EQ(first[Diagnostics::NameLookup].GetCount(), 0u);
+
+  const auto& second = statistics.host_latencies.at("second.here.com");
+  EXPECT_EQ(second[Diagnostics::Total].GetCount(), 1u);
+}
+
+}  // namespace
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <olp/core/http/HttpStatusCode.h>
+#include <olp/core/http/adapters/HarReplayNetwork.h>
+#include <olp/core/utils/Dir.h>
+
+namespace {
+
+using olp::http::ErrorCode;
+using olp::http::HarReplayNetwork;
+using olp::http::NetworkRequest;
+using olp::http::NetworkResponse;
+
+constexpr auto kHar = R"json({"log": {"version": "1.2", "entries": [
+  {"time": 1.5,
+   "request": {"method": "GET", "url": "https://here.com/a", "headers": []},
+   "response": {"status": 200, "headers": [{"name": "etag", "value": "1"}],
+                "content": {"size": 5, "text": "hello"}}},
+  {"time": 1,
+   "request": {"method": "GET", "url": "https://here.com/a"},
+   "response": {"status": 200,
+                "content": {"text": "d29ybGQ=", "encoding": "base64"}}},
+  {"time": 1,
+   "request": {"method": "POST", "url": "https://here.com/b",
+               "postData": {"text": "Ym9keQ==", "_encoding": "base64"}},
+   "response": {"status": 201, "content": {"text": ""}}},
+  {"time": 60000,
+   "request": {"method": "GET", "url": "https://here.com/slow"},
+   "response": {"status": 200, "content": {"text": "slow"}}}
+]}})json";
+
+struct Response {
+  NetworkResponse response;
+  std::string body;
+  std::string etag;
+};
+
+class HarReplayNetworkTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = olp::utils::Dir::TempDirectory() + "/replay_test.har";
+    std::ofstream file(path_);
+    file << kHar;
+  }
+
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  static olp::http::SendOutcome Send(HarReplayNetwork& network,
+                                     NetworkRequest request,
+                                     std::future<Response>& future) {
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto result = std::make_shared<Response>();
+    auto payload = std::make_shared<std::stringstream>();
+    future = promise->get_future();
+
+    return network.Send(
+        std::move(request), payload,
+        [=](NetworkResponse response) {
+          result->response = std::move(response);
+          result->body = payload->str();
+          promise->set_value(*result);
+        },
+        [=](std::string key, std::string value) {
+          if (key == "etag") {
+            result->etag = value;
+          }
+        });
+  }
+
+  std::string path_;
+};
+
+TEST_F(HarReplayNetworkTest, ServesRecordedResponses) {
+  HarReplayNetwork network(path_);
+  ASSERT_EQ(network.GetEntryCount(), 4u);
+
+  // The entries of the same request are served in the recorded order.
+  for (const auto* expected_body : {"hello", "world", "hello"}) {
+    std::future<Response> future;
+    const auto outcome =
+        Send(network, NetworkRequest("https://here.com/a"), future);
+    ASSERT_TRUE(outcome.IsSuccessful());
+
+    const auto result = future.get();
+    EXPECT_EQ(result.response.GetStatus(), olp::http::HttpStatusCode::OK);
+    EXPECT_EQ(result.response.GetRequestId(), outcome.GetRequestId());
+    EXPECT_EQ(result.body, expected_body);
+  }
+
+  std::future<Response> future;
+  const auto outcome =
+      Send(network, NetworkRequest("https://here.com/missing"), future);
+  EXPECT_EQ(outcome.GetErrorCode(), ErrorCode::OFFLINE_ERROR);
+}
+
+TEST_F(HarReplayNetworkTest, MatchesBody) {
+  HarReplayNetwork network(path_, HarReplayNetwork::TimingMode::kFullSpeed,
+                           true);
+
+  auto make_request = [](const std::string& body) {
+    return NetworkRequest("https://here.com/b")
+        .WithVerb(NetworkRequest::HttpVerb::POST)
+        .WithBody(std::make_shared<std::vector<std::uint8_t>>(body.begin(),
+                                                              body.end()));
+  };
+
+  std::future<Response> future;
+  ASSERT_TRUE(Send(network, make_request("body"), future).IsSuccessful());
+  EXPECT_EQ(future.get().response.GetStatus(),
+            olp::http::HttpStatusCode::CREATED);
+
+  EXPECT_EQ(Send(network, make_request("other"), future).GetErrorCode(),
+            ErrorCode::OFFLINE_ERROR);
+}
+
+TEST_F(HarReplayNetworkTest, RecordedTimingAndCancel) {
+  HarReplayNetwork network(path_, HarReplayNetwork::TimingMode::kRecorded);
+
+  std::future<Response> future;
+  const auto outcome =
+      Send(network, NetworkRequest("https://here.com/slow"), future);
+  ASSERT_TRUE(outcome.IsSuccessful());
+
+  // The response is delivered after the recorded time.
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(50)),
+            std::future_status::timeout);
+
+  network.Cancel(outcome.GetRequestId());
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  EXPECT_EQ(future.get().response.GetStatus(),
+            static_cast<int>(ErrorCode::CANCELLED_ERROR));
+}
+
+}  // namespace
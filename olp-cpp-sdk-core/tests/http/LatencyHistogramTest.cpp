@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <gtest/gtest.h>
+
+#include <olp/core/http/LatencyHistogram.h>
+
+namespace {
+
+using olp::http::LatencyHistogram;
+using MicroSeconds = LatencyHistogram::MicroSeconds;
+
+TEST(LatencyHistogramTest, BucketBounds) {
+  for (std::size_t i = 0u; i + 1u < LatencyHistogram::kBucketCount; ++i) {
+    SCOPED_TRACE(testing::Message() << "index=" << i);
+
+    const auto lower = LatencyHistogram::GetBucketLowerBound(i);
+    const auto next = LatencyHistogram::GetBucketLowerBound(i + 1u);
+    ASSERT_LT(lower, next);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(lower), i);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(next - MicroSeconds(1)), i);
+  }
+
+  EXPECT_EQ(LatencyHistogram::GetBucketIndex(MicroSeconds::max()),
+            LatencyHistogram::kBucketCount - 1u);
+  EXPECT_EQ(LatencyHistogram::GetBucketIndex(MicroSeconds(-1)), 0u);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.GetPercentile(50.0), MicroSeconds(0));
+
+  for (int i = 1; i <= 100; ++i) {
+    histogram.Add(MicroSeconds(i * 1000));
+  }
+
+  EXPECT_EQ(histogram.GetCount(), 100u);
+  EXPECT_EQ(histogram.GetSum(), MicroSeconds(5050000));
+  EXPECT_EQ(histogram.GetMax(), MicroSeconds(100000));
+  EXPECT_EQ(histogram.GetPercentile(100.0), MicroSeconds(100000));
+
+  // The values are approximated with an error below 25%.
+  const auto median = histogram.GetPercentile(50.0).count();
+  EXPECT_GE(median, 50000);
+  EXPECT_LT(median, 62500);
+
+  const auto p99 = histogram.GetPercentile(99.0).count();
+  EXPECT_GE(p99, 99000);
+  EXPECT_LE(p99, 100000);
+}
+
+TEST(LatencyHistogramTest, Merge) {
+  LatencyHistogram first;
+  first.Add(MicroSeconds(10));
+  LatencyHistogram second;
+  second.Add(MicroSeconds(20000));
+  second.Add(MicroSeconds(30000));
+
+  first.Merge(second);
+
+  EXPECT_EQ(first.GetCount(), 3u);
+  EXPECT_EQ(first.GetSum(), MicroSeconds(50010));
+  EXPECT_EQ(first.GetMax(), MicroSeconds(30000));
+  EXPECT_EQ(LatencyHistogram::GetBucketIndex(first.GetPercentile(1.0)),
+            LatencyHistogram::GetBucketIndex(MicroSeconds(10)));
+}
+
+}  // namespace
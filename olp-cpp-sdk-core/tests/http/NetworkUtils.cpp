@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -145,4 +145,12 @@ TEST(NetworkUtilsTest, HttpErrorToString) {
   EXPECT_EQ("HTTP Version Not Supported", HttpErrorToString(505));
 }
 
+TEST(NetworkUtilsTest, ExtractHost) {
+  EXPECT_EQ(NetworkUtils::ExtractHost("https://here.com/path"), "here.com");
+  EXPECT_EQ(NetworkUtils::ExtractHost("http://user@here.com:8080"), "here.com");
+  EXPECT_EQ(NetworkUtils::ExtractHost("here.com?query=1"), "here.com");
+  EXPECT_EQ(NetworkUtils::ExtractHost("https://here.com/a@b"), "here.com");
+  EXPECT_EQ(NetworkUtils::ExtractHost(""), "");
+}
+
 }  // namespace
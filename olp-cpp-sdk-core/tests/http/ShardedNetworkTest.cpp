@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mocks/NetworkMock.h>
+
+#include "http/ShardedNetwork.h"
+
+namespace {
+
+using olp::http::Network;
+using olp::http::NetworkRequest;
+using olp::http::NetworkResponse;
+using olp::http::RequestId;
+using olp::http::SendOutcome;
+using olp::http::ShardedNetwork;
+using testing::_;
+
+using ShardingPolicy = ShardedNetwork::ShardingPolicy;
+
+constexpr RequestId kShardRequestId = 5u;
+
+struct ShardedNetworkTest : public ::testing::Test {
+  void SetUp() override {
+    for (auto i = 0u; i < shards.size(); ++i) {
+      shards[i] = std::make_shared<testing::NiceMock<NetworkMock>>();
+      ON_CALL(*shards[i], Send(_, _, _, _, _))
+          .WillByDefault([this, i](NetworkRequest, Network::Payload,
+                                   Network::Callback callback,
+                                   Network::HeaderCallback,
+                                   Network::DataCallback) {
+            ++sent[i];
+            last_shard = i;
+            callbacks.push_back(std::move(callback));
+            return SendOutcome(kShardRequestId);
+          });
+    }
+  }
+
+  std::shared_ptr<ShardedNetwork> CreateNetwork(ShardingPolicy policy) {
+    return std::make_shared<ShardedNetwork>(
+        std::vector<std::shared_ptr<Network>>(shards.begin(), shards.end()),
+        policy);
+  }
+
+  std::vector<std::shared_ptr<testing::NiceMock<NetworkMock>>> shards{3u};
+  std::vector<Network::Callback> callbacks;
+  std::vector<size_t> sent = std::vector<size_t>(3u, 0u);
+  size_t last_shard = 0u;
+};
+
+TEST_F(ShardedNetworkTest, ByLoadDistributesRequests) {
+  auto network = CreateNetwork(ShardingPolicy::kByLoad);
+
+  std::vector<RequestId> ids;
+  for (auto i = 0u; i < 2u * shards.size(); ++i) {
+    const auto outcome = network->Send(NetworkRequest("https://here.com"),
+                                       nullptr, nullptr);
+    ASSERT_TRUE(outcome.IsSuccessful());
+    ids.push_back(outcome.GetRequestId());
+  }
+
+  EXPECT_THAT(sent, testing::Each(2u));
+
+  // The request IDs are unique even though every shard returns the same ID.
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+TEST_F(ShardedNetworkTest, ByHostUsesOneShard) {
+  auto network = CreateNetwork(ShardingPolicy::kByHost);
+
+  for (auto i = 0u; i < 5u; ++i) {
+    network->Send(NetworkRequest("https://here.com/" + std::to_string(i)),
+                  nullptr, nullptr);
+  }
+
+  EXPECT_EQ(sent[last_shard], 5u);
+}
+
+TEST_F(ShardedNetworkTest, CallbackAndCancel) {
+  auto network = CreateNetwork(ShardingPolicy::kByLoad);
+
+  RequestId callback_id = 0u;
+  const auto outcome =
+      network->Send(NetworkRequest("https://here.com"), nullptr,
+                    [&](NetworkResponse response) {
+                      callback_id = response.GetRequestId();
+                    });
+  ASSERT_TRUE(outcome.IsSuccessful());
+  ASSERT_EQ(callbacks.size(), 1u);
+
+  EXPECT_CALL(*shards[last_shard], Cancel(kShardRequestId)).Times(1);
+  network->Cancel(outcome.GetRequestId());
+
+  callbacks.front()(NetworkResponse().WithRequestId(kShardRequestId));
+  EXPECT_EQ(callback_id, outcome.GetRequestId());
+
+  // The request is finished, so cancel is not forwarded anymore.
+  for (const auto& shard : shards) {
+    testing::Mock::VerifyAndClearExpectations(shard.get());
+    EXPECT_CALL(*shard, Cancel(_)).Times(0);
+  }
+  network->Cancel(outcome.GetRequestId());
+}
+
+}  // namespace
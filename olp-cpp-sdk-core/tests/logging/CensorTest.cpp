@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "logging/Censor.h"
+
+namespace {
+
+using olp::logging::Censor;
+
+std::string Apply(const Censor& censor, const std::string& message) {
+  const auto censored = censor.Apply(message.data(), message.size());
+  return censored ? *censored : message;
+}
+
+// Straightforward implementation of the same rules for non-overlapping
+// secrets.
+std::string ApplyNaive(const std::vector<std::string>& secrets,
+                       const std::string& message) {
+  std::vector<bool> hidden(message.size(), false);
+  std::vector<bool> starts(message.size(), false);
+  for (const auto& secret : secrets) {
+    if (secret.empty()) {
+      continue;
+    }
+    for (auto pos = message.find(secret); pos != std::string::npos;
+         pos = message.find(secret, pos + 1u)) {
+      starts[pos] = true;
+      for (auto i = pos; i < pos + secret.size(); ++i) {
+        hidden[i] = true;
+      }
+    }
+  }
+
+  // Expects the secrets not to overlap, so every secret gets its own mask.
+  std::string result;
+  for (size_t i = 0u; i < message.size(); ++i) {
+    if (!hidden[i]) {
+      result += message[i];
+    } else if (i == 0u || !hidden[i - 1u] || starts[i]) {
+      result += "*****";
+    }
+  }
+  return result;
+}
+
+TEST(CensorTest, NoSecrets) {
+  const Censor censor({});
+  EXPECT_FALSE(censor.Apply("message", 7u));
+}
+
+TEST(CensorTest, NoMatchDoesNotCopy) {
+  const Censor censor({"secret", "token"});
+  EXPECT_FALSE(censor.Apply("nothing to hide", 15u));
+  EXPECT_FALSE(censor.Apply("secre toke", 10u));
+}
+
+TEST(CensorTest, ReplacesSecrets) {
+  const Censor censor({"secret", "token", ""});
+
+  EXPECT_EQ("*****", Apply(censor, "secret"));
+  EXPECT_EQ("a ***** and a *****", Apply(censor, "a secret and a token"));
+  EXPECT_EQ("**********", Apply(censor, "secrettoken"));
+  EXPECT_EQ("ssss*****", Apply(censor, "sssssecret"));
+}
+
+TEST(CensorTest, OverlappingSecrets) {
+  // "abc" and "bcd" overlap in "abcd", "b" is inside "abc".
+  const Censor censor({"abc", "bcd", "b"});
+
+  EXPECT_EQ("*****", Apply(censor, "abcd"));
+  EXPECT_EQ("x*****y", Apply(censor, "xabcdy"));
+  EXPECT_EQ("*****", Apply(censor, "abc"));
+  EXPECT_EQ("*****e", Apply(censor, "abce"));
+  EXPECT_EQ("a**********cx", Apply(censor, "abbcx"));
+}
+
+TEST(CensorTest, PrefixSecrets) {
+  const Censor censor({"pass", "password", "word"});
+
+  EXPECT_EQ("my *****", Apply(censor, "my password"));
+  EXPECT_EQ("*****ing", Apply(censor, "passing"));
+  EXPECT_EQ("*****s", Apply(censor, "words"));
+}
+
+TEST(CensorTest, ShorterSecretAfterSkippedOccurrence) {
+  // The second "aa" overlaps the first one, but "a" is still hidden.
+  const Censor censor({"aa", "a"});
+  EXPECT_EQ("**********", Apply(censor, "aaa"));
+  EXPECT_EQ("**********b", Apply(censor, "aaaab"));
+}
+
+TEST(CensorTest, MaskIsNotMatched) {
+  const Censor censor({"******"});
+  EXPECT_EQ("x *****", Apply(censor, "x ******"));
+  EXPECT_EQ("*****", Apply(censor, "*****"));
+  // The occurrences of the same secret don't overlap.
+  EXPECT_EQ("**********", Apply(censor, "************"));
+  EXPECT_EQ("***********", Apply(censor, "*************"));
+}
+
+TEST(CensorTest, MatchesNaiveImplementation) {
+  std::mt19937 generator(42u);
+  std::uniform_int_distribution<int> letter('a', 'c');
+  std::uniform_int_distribution<size_t> length(1u, 4u);
+
+  auto random_string = [&](size_t size) {
+    std::string result;
+    for (size_t i = 0u; i < size; ++i) {
+      result += static_cast<char>(letter(generator));
+    }
+    return result;
+  };
+
+  for (auto round = 0u; round < 200u; ++round) {
+    // Secrets that can't overlap, so the naive masking is unambiguous.
+    std::vector<std::string> secrets;
+    for (auto i = 0u; i < 3u; ++i) {
+      secrets.push_back("x" + random_string(length(generator)) + "y");
+    }
+
+    std::string message;
+    for (auto i = 0u; i < 10u; ++i) {
+      message += random_string(length(generator));
+      if (i % 2u == 0u) {
+        message += secrets[i % secrets.size()];
+      }
+    }
+
+    const Censor censor(secrets);
+    EXPECT_EQ(ApplyNaive(secrets, message), Apply(censor, message))
+        << "message: " << message;
+  }
+}
+
+}  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -48,6 +48,7 @@ TEST(DisabledLoggingTest, LoggingDisabledDefined) {
   OLP_SDK_LOG_INFO("info", "Info message");
   OLP_SDK_LOG_WARNING("warning", "Warning message");
   OLP_SDK_LOG_ERROR("error", "Error message");
+  OLP_SDK_LOG_INFO_S("info", "Structured {} message", "info");
 
   // Log levels insuppressible by the flag
   OLP_SDK_LOG_FATAL("fatal", "Fatal message");
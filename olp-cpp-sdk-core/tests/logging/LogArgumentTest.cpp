@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+#include <olp/core/logging/LogArgument.h>
+
+namespace {
+
+using olp::logging::LogArgument;
+
+enum class Color { kRed = 1, kGreen = 2 };
+
+template <typename... Args>
+std::string Format(const char* format, const Args&... args) {
+  const LogArgument arguments[] = {LogArgument(args)..., LogArgument()};
+  return LogArgument::format(format, arguments, sizeof...(Args));
+}
+
+TEST(LogArgumentTest, Types) {
+  EXPECT_EQ(LogArgument::Type::kBool, LogArgument(true).getType());
+  EXPECT_EQ(LogArgument::Type::kChar, LogArgument('c').getType());
+  EXPECT_EQ(LogArgument::Type::kSigned, LogArgument(-1).getType());
+  EXPECT_EQ(LogArgument::Type::kSigned, LogArgument(int64_t{-1}).getType());
+  EXPECT_EQ(LogArgument::Type::kUnsigned, LogArgument(1u).getType());
+  EXPECT_EQ(LogArgument::Type::kUnsigned, LogArgument(size_t{1}).getType());
+  EXPECT_EQ(LogArgument::Type::kDouble, LogArgument(1.5f).getType());
+  EXPECT_EQ(LogArgument::Type::kSigned, LogArgument(Color::kGreen).getType());
+  EXPECT_EQ(LogArgument::Type::kString, LogArgument("text").getType());
+  EXPECT_EQ(LogArgument::Type::kString,
+            LogArgument(std::string("text")).getType());
+
+  char buffer[] = "text";
+  EXPECT_EQ(LogArgument::Type::kString, LogArgument(buffer).getType());
+  EXPECT_EQ(LogArgument::Type::kString,
+            LogArgument(static_cast<char*>(buffer)).getType());
+  EXPECT_EQ(LogArgument::Type::kString, LogArgument(nullptr).getType());
+
+  // Other pointers would otherwise convert to `bool`.
+  static_assert(!std::is_constructible<LogArgument, const void*>::value,
+                "void pointers must not be logged");
+  static_assert(!std::is_constructible<LogArgument, int*>::value,
+                "int pointers must not be logged");
+  static_assert(!std::is_constructible<LogArgument, const Color*>::value,
+                "enum pointers must not be logged");
+}
+
+TEST(LogArgumentTest, Format) {
+  EXPECT_EQ("no arguments", Format("no arguments"));
+  EXPECT_EQ("id=42, size=7, ok=true",
+            Format("id={}, size={}, ok={}", 42, 7u, true));
+  EXPECT_EQ("-5 2.5 x", Format("{} {} {}", int64_t{-5}, 2.5, 'x'));
+  EXPECT_EQ("color 2", Format("color {}", Color::kGreen));
+  EXPECT_EQ("path /a/b in catalog hrn",
+            Format("path {} in catalog {}", std::string("/a/b"), "hrn"));
+  EXPECT_EQ("(null)", Format("{}", static_cast<const char*>(nullptr)));
+}
+
+TEST(LogArgumentTest, FormatPlaceholders) {
+  EXPECT_EQ("{} and {x}", Format("{{}} and {{x}}", 1));
+  EXPECT_EQ("1 and {}", Format("{} and {}", 1));
+  EXPECT_EQ("1", Format("{}", 1, 2));
+  EXPECT_EQ("{ 1 }", Format("{ {} }", 1));
+  EXPECT_EQ("", LogArgument::format(nullptr, nullptr, 0u));
+}
+
+}  // namespace
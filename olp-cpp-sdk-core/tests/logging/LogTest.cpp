@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,9 +18,13 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <olp/core/logging/Configuration.h>
@@ -743,4 +747,266 @@ TEST(LogTest, ReConfigure) {
             appender2->messages_[0].function_);
 }
 
+TEST(LogTest, AsyncMode) {
+  auto appender = std::make_shared<testing::MockAppender>();
+  {
+    olp::logging::Configuration configuration;
+    configuration.addAppender(appender);
+    configuration.setAsync(olp::logging::Configuration::AsyncSettings());
+    EXPECT_TRUE(olp::logging::Log::configure(configuration));
+  }
+  olp::logging::Log::setLevel(olp::logging::Level::Trace);
+  olp::logging::Log::addCensor("async secret");
+
+  constexpr auto kCount = 100u;
+  for (auto i = 0u; i < kCount; ++i) {
+    OLP_SDK_LOG_INFO("async", "Message " << i << " async secret");
+  }
+
+  // Switching back to the synchronous mode writes the queued messages.
+  EXPECT_TRUE(olp::logging::Log::configure(
+      olp::logging::Configuration::createDefault()));
+  olp::logging::Log::removeCensor("async secret");
+
+  ASSERT_EQ(kCount, appender->messages_.size());
+  for (auto i = 0u; i < kCount; ++i) {
+    EXPECT_EQ(olp::logging::Level::Info, appender->messages_[i].level_);
+    EXPECT_EQ("async", appender->messages_[i].tag_);
+    EXPECT_EQ("Message " + std::to_string(i) + " *****",
+              appender->messages_[i].message_);
+    EXPECT_NE(std::string::npos,
+              appender->messages_[i].file_.rfind("LogTest.cpp"));
+  }
+  EXPECT_GE(appender->flushes_, 1u);
+  EXPECT_LE(appender->flushes_, kCount);
+}
+
+TEST(LogTest, AsyncModeDropsOnOverflow) {
+  // Blocks the writer thread in the first message until released.
+  class BlockingAppender : public testing::MockAppender {
+   public:
+    olp::logging::IAppender& append(
+        const olp::logging::LogMessage& message) override {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (messages_.empty()) {
+        blocked = true;
+        condition.notify_all();
+        condition.wait(lock, [this] { return released; });
+      }
+      return testing::MockAppender::append(message);
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool blocked = false;
+    bool released = false;
+  };
+
+  auto appender = std::make_shared<BlockingAppender>();
+  {
+    olp::logging::Configuration::AsyncSettings settings;
+    settings.queueSize = 2u;
+    settings.maxMessageSize = 8u;
+    settings.overflowPolicy =
+        olp::logging::Configuration::OverflowPolicy::DropNewest;
+
+    olp::logging::Configuration configuration;
+    configuration.addAppender(appender);
+    configuration.setAsync(settings);
+    EXPECT_TRUE(olp::logging::Log::configure(configuration));
+  }
+  olp::logging::Log::setLevel(olp::logging::Level::Trace);
+
+  OLP_SDK_LOG_INFO("async", "First message");
+  {
+    std::unique_lock<std::mutex> lock(appender->mutex);
+    appender->condition.wait(lock, [&] { return appender->blocked; });
+  }
+
+  // The message being written still occupies its slot, so only one more
+  // message fits into the queue, the rest is dropped.
+  for (auto i = 0u; i < 10u; ++i) {
+    OLP_SDK_LOG_INFO("async", "Message " << i);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(appender->mutex);
+    appender->released = true;
+    appender->condition.notify_all();
+  }
+  EXPECT_TRUE(olp::logging::Log::configure(
+      olp::logging::Configuration::createDefault()));
+
+  ASSERT_EQ(3u, appender->messages_.size());
+  // Long messages are truncated.
+  EXPECT_EQ("First me", appender->messages_[0].message_);
+  EXPECT_EQ("Message ", appender->messages_[1].message_);
+  EXPECT_EQ(olp::logging::Level::Warning, appender->messages_[2].level_);
+  EXPECT_NE(std::string::npos,
+            appender->messages_[2].message_.find("Dropped 9 log messages"));
+}
+
+TEST(LogTest, AsyncModeReconfiguredWhileLogging) {
+  // Counts the messages, as the writers and the synchronous path may call it
+  // from different threads.
+  class CountingAppender : public olp::logging::IAppender {
+   public:
+    olp::logging::IAppender& append(
+        const olp::logging::LogMessage& /*message*/) override {
+      count.fetch_add(1u);
+      return *this;
+    }
+
+    std::atomic<size_t> count{0u};
+  };
+
+  auto appender = std::make_shared<CountingAppender>();
+  olp::logging::Configuration::AsyncSettings settings;
+  settings.queueSize = 16u;
+  settings.overflowPolicy = olp::logging::Configuration::OverflowPolicy::Block;
+  olp::logging::Configuration configuration;
+  configuration.addAppender(appender);
+  configuration.setAsync(settings);
+  EXPECT_TRUE(olp::logging::Log::configure(configuration));
+  olp::logging::Log::setLevel(olp::logging::Level::Trace);
+
+  constexpr auto kThreads = 4u;
+  constexpr auto kMessages = 2000u;
+  std::vector<std::thread> threads;
+  for (auto t = 0u; t < kThreads; ++t) {
+    threads.emplace_back([] {
+      for (auto i = 0u; i < kMessages; ++i) {
+        OLP_SDK_LOG_INFO("async", "Message " << i);
+      }
+    });
+  }
+
+  // Every replaced writer writes the messages of the producers that still
+  // use it, before it is freed.
+  for (auto i = 0u; i < 50u; ++i) {
+    EXPECT_TRUE(olp::logging::Log::configure(configuration));
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_TRUE(olp::logging::Log::configure(
+      olp::logging::Configuration::createDefault()));
+
+  EXPECT_EQ(kThreads * kMessages, appender->count.load());
+}
+
+TEST(LogTest, StructuredMessage) {
+  auto appender = std::make_shared<testing::MockAppender>();
+  olp::logging::Configuration configuration;
+  configuration.addAppender(appender);
+  EXPECT_TRUE(olp::logging::Log::configure(configuration));
+  olp::logging::Log::setLevel(olp::logging::Level::Info);
+
+  const std::string path = "/path";
+  OLP_SDK_LOG_INFO_S("structured", "Request {} to {} took {} ms", 7, path,
+                     1.5);
+  OLP_SDK_LOG_WARNING_S("structured", "No arguments");
+  OLP_SDK_LOG_DEBUG_S("structured", "Disabled {}", 1);
+
+  ASSERT_EQ(2u, appender->messages_.size());
+  EXPECT_EQ(olp::logging::Level::Info, appender->messages_[0].level_);
+  EXPECT_EQ("structured", appender->messages_[0].tag_);
+  EXPECT_EQ("Request 7 to /path took 1.5 ms", appender->messages_[0].message_);
+  EXPECT_NE(std::string::npos,
+            appender->messages_[0].file_.rfind("LogTest.cpp"));
+  EXPECT_EQ("No arguments", appender->messages_[1].message_);
+}
+
+TEST(LogTest, AsyncStructuredMessage) {
+  auto appender = std::make_shared<testing::MockAppender>();
+  {
+    olp::logging::Configuration::AsyncSettings settings;
+    settings.maxMessageSize = 64u;
+
+    olp::logging::Configuration configuration;
+    configuration.addAppender(appender);
+    configuration.setAsync(settings);
+    EXPECT_TRUE(olp::logging::Log::configure(configuration));
+  }
+  olp::logging::Log::setLevel(olp::logging::Level::Info);
+  olp::logging::Log::addCensor("hidden");
+
+  std::string value = "hidden value";
+  OLP_SDK_LOG_INFO_S("structured", "{} {} {} {} {} {}", true, 'c', -1, 2u, 0.25,
+                     value);
+  // The arguments are copied into the queue.
+  value = "changed";
+  // Too long to be stored unformatted, so formatted right away.
+  OLP_SDK_LOG_INFO_S("structured", "{}", std::string(100u, 'x'));
+
+  EXPECT_TRUE(olp::logging::Log::configure(
+      olp::logging::Configuration::createDefault()));
+  olp::logging::Log::removeCensor("hidden");
+
+  ASSERT_EQ(2u, appender->messages_.size());
+  EXPECT_EQ("true c -1 2 0.25 ***** value", appender->messages_[0].message_);
+  EXPECT_EQ(std::string(64u, 'x'), appender->messages_[1].message_);
+}
+
+TEST(LogTest, LevelChecks) {
+  olp::logging::Log::clearLevels();
+  olp::logging::Log::setLevel(olp::logging::Level::Warning);
+  const char* tag = "checks";
+  const std::string other_tag = "other";
+
+  EXPECT_FALSE(olp::logging::Log::isEnabled(olp::logging::Level::Info, tag));
+  EXPECT_TRUE(olp::logging::Log::isEnabled(olp::logging::Level::Error, tag));
+
+  olp::logging::Log::setLevel(olp::logging::Level::Debug, tag);
+  olp::logging::Log::setLevel(olp::logging::Level::Fatal, other_tag);
+
+  EXPECT_TRUE(olp::logging::Log::isEnabled(olp::logging::Level::Debug, tag));
+  EXPECT_FALSE(olp::logging::Log::isEnabled(olp::logging::Level::Trace, tag));
+  EXPECT_FALSE(
+      olp::logging::Log::isEnabled(olp::logging::Level::Error, other_tag));
+  EXPECT_TRUE(
+      olp::logging::Log::isEnabled(olp::logging::Level::Fatal, other_tag));
+  EXPECT_FALSE(
+      olp::logging::Log::isEnabled(olp::logging::Level::Info, "unknown"));
+  EXPECT_TRUE(
+      olp::logging::Log::isEnabled(olp::logging::Level::Error, "unknown"));
+  EXPECT_FALSE(olp::logging::Log::isEnabled(olp::logging::Level::Off, tag));
+
+  olp::logging::Log::clearLevels();
+  EXPECT_FALSE(olp::logging::Log::isEnabled(olp::logging::Level::Debug, tag));
+}
+
+TEST(LogTest, LevelCache) {
+  olp::logging::Log::clearLevels();
+  olp::logging::Log::setLevel(olp::logging::Level::Warning);
+  olp::logging::Log::setLevel(olp::logging::Level::Debug, "cached");
+  const char* tag = "cached";
+  const char* other_tag = "other";
+
+  olp::logging::LogLevelCache cache;
+  EXPECT_TRUE(cache.isEnabled(olp::logging::Level::Debug, tag));
+  EXPECT_TRUE(cache.isEnabled(olp::logging::Level::Info, tag));
+  EXPECT_FALSE(cache.isEnabled(olp::logging::Level::Trace, tag));
+  EXPECT_FALSE(cache.isEnabled(olp::logging::Level::Off, tag));
+
+  // A different tag at the same statement is not served from the cache.
+  EXPECT_FALSE(cache.isEnabled(olp::logging::Level::Info, other_tag));
+  EXPECT_TRUE(cache.isEnabled(olp::logging::Level::Debug, tag));
+  EXPECT_FALSE(
+      cache.isEnabled(olp::logging::Level::Info, std::string(other_tag)));
+
+  // Changing the levels invalidates the cache.
+  olp::logging::Log::setLevel(olp::logging::Level::Error, tag);
+  EXPECT_FALSE(cache.isEnabled(olp::logging::Level::Warning, tag));
+  EXPECT_TRUE(cache.isEnabled(olp::logging::Level::Error, tag));
+  olp::logging::Log::setLevel(olp::logging::Level::Trace, other_tag);
+  EXPECT_FALSE(cache.isEnabled(olp::logging::Level::Warning, tag));
+  EXPECT_TRUE(cache.isEnabled(olp::logging::Level::Trace, other_tag));
+
+  olp::logging::Log::clearLevels();
+  EXPECT_FALSE(cache.isEnabled(olp::logging::Level::Debug, tag));
+  EXPECT_TRUE(cache.isEnabled(olp::logging::Level::Warning, tag));
+}
+
 }  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -36,4 +36,9 @@ IAppender& MockAppender::append(const LogMessage& message) {
   return *this;
 }
 
+IAppender& MockAppender::flush() {
+  ++flushes_;
+  return *this;
+}
+
 }  // namespace testing
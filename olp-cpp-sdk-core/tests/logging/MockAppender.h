@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -41,7 +41,10 @@ class MockAppender : public IAppender {
 
   IAppender& append(const LogMessage& message) override;
 
+  IAppender& flush() override;
+
   std::vector<MessageData> messages_;
+  size_t flushes_ = 0;
 };
 
 }  // namespace testing
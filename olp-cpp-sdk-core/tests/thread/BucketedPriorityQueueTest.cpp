@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "thread/BucketedPriorityQueue.h"
+
+namespace {
+namespace thread = olp::thread;
+
+struct TestObject {
+  uint32_t priority;
+  int id;
+};
+
+struct GetPriority {
+  uint32_t operator()(const TestObject& object) const {
+    return object.priority;
+  }
+  uint32_t operator()(const std::string& object) const {
+    return static_cast<uint32_t>(object.size());
+  }
+};
+
+using Queue = thread::BucketedPriorityQueue<TestObject, GetPriority>;
+
+TEST(BucketedPriorityQueueTest, BasicFunctionality) {
+  {
+    SCOPED_TRACE("empty");
+
+    Queue queue;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0u);
+  }
+
+  {
+    SCOPED_TRACE("push lvalue");
+
+    std::string value = "value";
+    thread::BucketedPriorityQueue<std::string, GetPriority> queue;
+    queue.push(value);
+
+    EXPECT_FALSE(value.empty());
+    ASSERT_FALSE(queue.empty());
+    EXPECT_EQ(value, queue.front());
+  }
+
+  {
+    SCOPED_TRACE("push rvalue");
+
+    std::string value = "value";
+    thread::BucketedPriorityQueue<std::string, GetPriority> queue;
+    queue.push(std::move(value));
+
+    EXPECT_TRUE(value.empty());
+    ASSERT_FALSE(queue.empty());
+    EXPECT_EQ("value", queue.front());
+  }
+
+  {
+    SCOPED_TRACE("pop");
+
+    Queue queue;
+    queue.push({1u, 0});
+
+    ASSERT_EQ(queue.size(), 1u);
+    queue.pop();
+    ASSERT_TRUE(queue.empty());
+  }
+
+  {
+    SCOPED_TRACE("pop empty");
+
+    Queue queue;
+    queue.pop();
+    ASSERT_TRUE(queue.empty());
+  }
+}
+
+TEST(BucketedPriorityQueueTest, PriorityAndFIFO) {
+  Queue queue;
+
+  std::vector<uint32_t> priorities{500, 1000, 100, 500, 100, 1000, 7, 500};
+  int id = 0;
+  for (auto priority : priorities) {
+    queue.push({priority, id++});
+  }
+  ASSERT_EQ(queue.size(), priorities.size());
+
+  // Higher priorities first, the same priority in the push order.
+  auto previous = queue.front();
+  queue.pop();
+  while (!queue.empty()) {
+    const auto& object = queue.front();
+    ASSERT_TRUE(object.priority < previous.priority ||
+                (object.priority == previous.priority &&
+                 object.id > previous.id));
+
+    previous = object;
+    queue.pop();
+  }
+}
+
+TEST(BucketedPriorityQueueTest, InterleavedPushAndPop) {
+  // Compare against a stable sort with many distinct priorities, so the
+  // buckets are created and removed while the queue is used.
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<uint32_t> priority_distribution(0u, 40u);
+
+  Queue queue;
+  std::vector<TestObject> expected;
+  int id = 0;
+
+  for (auto round = 0; round < 200; ++round) {
+    for (auto push = 0; push < 10; ++push) {
+      const TestObject object{priority_distribution(generator), id++};
+      queue.push(object);
+      expected.push_back(object);
+    }
+
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const TestObject& lhs, const TestObject& rhs) {
+                       return lhs.priority > rhs.priority;
+                     });
+
+    for (auto pop = 0; pop < 7; ++pop) {
+      ASSERT_EQ(queue.front().id, expected.front().id);
+      queue.pop();
+      expected.erase(expected.begin());
+    }
+    ASSERT_EQ(queue.size(), expected.size());
+  }
+}
+
+}  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 HERE Europe B.V.
+ * Copyright (C) 2022-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -81,6 +81,42 @@ TEST_F(ContinuationTest, MultipleThen) {
   EXPECT_EQ(result.GetResult(), counter);
 }
 
+TEST_F(ContinuationTest, MovesResults) {
+  // Counts the copies of the value passed through the chain.
+  struct Value {
+    Value() = default;
+    Value(const Value& other) : copies(other.copies + 1) {}
+    Value(Value&&) = default;
+    Value& operator=(const Value&) = default;
+    Value& operator=(Value&&) = default;
+
+    int copies = 0;
+  };
+
+  std::promise<ResponseType<int>> promise;
+  auto future = promise.get_future();
+
+  auto continuation =
+      Create([](olp::thread::ExecutionContext,
+                std::function<void(Value)> next) { next(Value()); })
+          .Then([](olp::thread::ExecutionContext, Value value,
+                   std::function<void(Value)> next) {
+            next(std::move(value));
+          })
+          .Then([](olp::thread::ExecutionContext, Value value,
+                   std::function<void(int)> next) { next(value.copies); })
+          .Finally([&](ResponseType<int> response) {
+            promise.set_value(std::move(response));
+          });
+  continuation.Run();
+
+  ASSERT_EQ(future.wait_for(kMaxWaitMs), std::future_status::ready);
+  const auto result = future.get();
+
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result.GetResult(), 0);
+}
+
 TEST_F(ContinuationTest, CancelBeforeRun) {
   std::promise<ResponseType<int>> promise;
   auto future = promise.get_future();
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <olp/core/thread/Coroutine.h>
+
+#ifdef OLP_SDK_HAS_COROUTINES
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <olp/core/client/ApiResponse.h>
+#include <olp/core/thread/ThreadPoolTaskScheduler.h>
+
+namespace {
+namespace client = olp::client;
+namespace thread = olp::thread;
+
+using Response = client::ApiResponse<int, client::ApiError>;
+using Awaiter = thread::CallbackAwaiter<Response>;
+
+constexpr auto kWaitTime = std::chrono::seconds(5);
+
+/// Calls the callback from another thread, like the network does.
+client::CancellationToken StartAsync(Awaiter::Callback callback, int value) {
+  std::thread([=]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    callback(value);
+  }).detach();
+  return client::CancellationToken();
+}
+
+thread::Task<int> Sum(std::shared_ptr<thread::TaskScheduler> scheduler,
+                      std::thread::id& resumed_on) {
+  auto first = co_await Awaiter(
+      [](Awaiter::Callback callback) { return StartAsync(callback, 1); },
+      client::CancellationContext(), scheduler);
+  resumed_on = std::this_thread::get_id();
+
+  // Completes before the coroutine is suspended.
+  auto second = co_await Awaiter(
+      [](Awaiter::Callback callback) {
+        callback(2);
+        return client::CancellationToken();
+      },
+      client::CancellationContext(), scheduler);
+
+  co_return first.GetResult() + second.GetResult();
+}
+
+TEST(CoroutineTest, CallbackAwaiter) {
+  auto scheduler = std::make_shared<thread::ThreadPoolTaskScheduler>(1u);
+  std::thread::id scheduler_thread;
+  scheduler->ScheduleTask(
+      [&]() { scheduler_thread = std::this_thread::get_id(); });
+
+  std::thread::id resumed_on;
+  std::promise<int> result;
+  Sum(scheduler, resumed_on).Start([&](int sum) { result.set_value(sum); });
+
+  auto future = result.get_future();
+  ASSERT_EQ(future.wait_for(kWaitTime), std::future_status::ready);
+  EXPECT_EQ(future.get(), 3);
+  EXPECT_EQ(resumed_on, scheduler_thread);
+}
+
+TEST(CoroutineTest, Cancellation) {
+  auto task =
+      [](client::CancellationContext context) -> thread::Task<Response> {
+    // Never completes unless cancelled.
+    co_return co_await Awaiter(
+        [](Awaiter::Callback callback) {
+          return client::CancellationToken(
+              [=]() { callback(client::ApiError::Cancelled()); });
+        },
+        context);
+  };
+
+  {
+    SCOPED_TRACE("Cancel while waiting");
+    client::CancellationContext context;
+    std::promise<Response> result;
+    task(context).Start([&](Response response) {
+      result.set_value(std::move(response));
+    });
+
+    context.CancelOperation();
+    auto future = result.get_future();
+    ASSERT_EQ(future.wait_for(kWaitTime), std::future_status::ready);
+    EXPECT_EQ(future.get().GetError().GetErrorCode(),
+              client::ErrorCode::Cancelled);
+  }
+
+  {
+    SCOPED_TRACE("Cancelled before the call");
+    client::CancellationContext context;
+    context.CancelOperation();
+    std::promise<Response> result;
+    task(context).Start([&](Response response) {
+      result.set_value(std::move(response));
+    });
+
+    auto future = result.get_future();
+    ASSERT_EQ(future.wait_for(kWaitTime), std::future_status::ready);
+    EXPECT_EQ(future.get().GetError().GetErrorCode(),
+              client::ErrorCode::Cancelled);
+  }
+}
+
+TEST(CoroutineTest, RunOnAndExceptions) {
+  auto scheduler = std::make_shared<thread::ThreadPoolTaskScheduler>(1u);
+  const auto caller_thread = std::this_thread::get_id();
+
+  auto check_thread = [&]() -> thread::Task<void> {
+    co_await thread::ResumeOn(scheduler);
+    EXPECT_NE(std::this_thread::get_id(), caller_thread);
+  };
+
+  auto run = [&]() -> thread::Task<bool> {
+    co_await check_thread();
+    const auto value = co_await thread::RunOn(scheduler, []() { return 5; });
+    EXPECT_EQ(value, 5);
+
+    // The exceptions are passed to the awaiting coroutine.
+    auto fail = []() -> thread::Task<int> {
+      throw std::runtime_error("failed");
+      co_return 0;
+    };
+    try {
+      co_await fail();
+    } catch (const std::runtime_error&) {
+      co_return true;
+    }
+    co_return false;
+  };
+
+  std::promise<bool> result;
+  run().Start([&](bool caught) { result.set_value(caught); });
+
+  auto future = result.get_future();
+  ASSERT_EQ(future.wait_for(kWaitTime), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+}
+
+}  // namespace
+
+#endif  // OLP_SDK_HAS_COROUTINES
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <olp/core/thread/TaskScheduler.h>
+
+#include "thread/FairTaskQueue.h"
+
+namespace {
+namespace thread = olp::thread;
+
+thread::PrioritizedTask MakeTask(uint32_t priority, uint64_t group,
+                                 uint32_t weight = 1u) {
+  return {[]() {}, priority, {}, group, weight};
+}
+
+std::string PopAll(thread::FairTaskQueue& queue) {
+  std::string groups;
+  while (!queue.empty()) {
+    groups += static_cast<char>('a' + queue.pop().group);
+  }
+  return groups;
+}
+
+TEST(FairTaskQueueTest, RoundRobin) {
+  thread::FairTaskQueue queue;
+  for (auto i = 0; i < 4; ++i) {
+    queue.push(MakeTask(thread::NORMAL, 0u));
+  }
+  queue.push(MakeTask(thread::NORMAL, 1u));
+  queue.push(MakeTask(thread::NORMAL, 2u));
+  EXPECT_EQ(queue.size(), 6u);
+
+  EXPECT_EQ(PopAll(queue), "abcaaa");
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(FairTaskQueueTest, Weights) {
+  thread::FairTaskQueue queue;
+  for (auto i = 0; i < 4; ++i) {
+    queue.push(MakeTask(thread::NORMAL, 0u));
+    queue.push(MakeTask(thread::NORMAL, 1u, 2u));
+  }
+
+  EXPECT_EQ(PopAll(queue), "abbabbaa");
+}
+
+TEST(FairTaskQueueTest, Priorities) {
+  thread::FairTaskQueue queue;
+  queue.push(MakeTask(thread::LOW, 0u));
+  queue.push(MakeTask(thread::NORMAL, 0u));
+  queue.push(MakeTask(thread::LOW, 1u));
+  queue.push(MakeTask(thread::HIGH, 1u));
+
+  // The highest priority goes first, then the groups share by the pass.
+  std::string groups;
+  std::string priorities;
+  while (!queue.empty()) {
+    const auto task = queue.pop();
+    groups += static_cast<char>('a' + task.group);
+    priorities += std::to_string(task.priority) + " ";
+  }
+  EXPECT_EQ(groups, "baab");
+  EXPECT_EQ(priorities, "1000 500 100 100 ");
+}
+
+TEST(FairTaskQueueTest, IdleGroupDoesNotCatchUp) {
+  thread::FairTaskQueue queue;
+  for (auto i = 0; i < 4; ++i) {
+    queue.push(MakeTask(thread::NORMAL, 0u));
+  }
+  queue.pop();
+  queue.pop();
+
+  // The group joining later shares the queue from now on.
+  queue.push(MakeTask(thread::NORMAL, 1u));
+  queue.push(MakeTask(thread::NORMAL, 1u));
+  EXPECT_EQ(PopAll(queue), "baba");
+}
+
+}  // namespace
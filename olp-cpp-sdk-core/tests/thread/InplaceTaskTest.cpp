@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "thread/InplaceTask.h"
+
+namespace {
+using olp::thread::InplaceTask;
+
+TEST(InplaceTaskTest, SmallAndLargeCallables) {
+  auto counter = std::make_shared<int>(0);
+
+  // Fits into the inline buffer.
+  InplaceTask small([counter]() { ++*counter; });
+  // Does not fit, so it is allocated on the heap.
+  std::array<char, 2u * InplaceTask::kCapacity> payload{};
+  InplaceTask large(
+      [counter, payload]() { *counter += static_cast<int>(payload.size()); });
+
+  ASSERT_TRUE(small);
+  ASSERT_TRUE(large);
+  small();
+  large();
+  EXPECT_EQ(*counter, static_cast<int>(1u + payload.size()));
+
+  // The callables are destroyed with the tasks.
+  EXPECT_EQ(counter.use_count(), 3);
+  small = nullptr;
+  large = nullptr;
+  EXPECT_FALSE(small);
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(InplaceTaskTest, MoveOnlyCallable) {
+  auto value = std::unique_ptr<int>(new int(5));
+  auto result = 0;
+
+  InplaceTask task(std::bind(
+      [&result](std::unique_ptr<int>& value) { result = *value; },
+      std::move(value)));
+
+  // Moved around as the queues do.
+  std::vector<InplaceTask> tasks;
+  tasks.push_back(std::move(task));
+  tasks.reserve(16u);
+  EXPECT_FALSE(task);
+
+  InplaceTask moved;
+  moved = std::move(tasks.front());
+  ASSERT_TRUE(moved);
+  moved();
+  EXPECT_EQ(result, 5);
+}
+
+}  // namespace
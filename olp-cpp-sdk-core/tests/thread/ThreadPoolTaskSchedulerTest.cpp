@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,14 +17,20 @@
  * License-Filename: LICENSE
  */
 
+#include <algorithm>
 #include <chrono>
+#include <future>
+#include <string>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <olp/core/client/CancellationContext.h>
+#include <olp/core/thread/ScopedBlockingRegion.h>
 #include <olp/core/thread/ThreadPoolTaskScheduler.h>
 #include "mocks/TaskSchedulerMock.h"
 
@@ -302,3 +308,268 @@ TEST(ThreadPoolTaskSchedulerTest, ExecuteOrSchedule) {
     EXPECT_EQ(counter, 1);
   }
 }
+
+TEST(ThreadPoolTaskSchedulerTest, ScheduleAfter) {
+  auto thread_pool = std::make_shared<ThreadPool>(1u);
+  const auto start = chrono::steady_clock::now();
+
+  std::mutex mutex;
+  std::vector<int> executed;
+  std::promise<void> done;
+
+  auto schedule = [&](int delay) {
+    return thread_pool->ScheduleAfter(
+        [&, delay]() {
+          EXPECT_GE(chrono::steady_clock::now() - start,
+                    chrono::milliseconds(delay));
+          std::lock_guard<std::mutex> lock(mutex);
+          executed.push_back(delay);
+          if (delay == 60) {
+            done.set_value();
+          }
+        },
+        chrono::milliseconds(delay));
+  };
+
+  schedule(60);
+  auto token = schedule(40);
+  schedule(20);
+  token.Cancel();
+
+  ASSERT_EQ(done.get_future().wait_for(chrono::milliseconds(kMaxWaitMs)),
+            std::future_status::ready);
+  EXPECT_EQ(executed, std::vector<int>({20, 60}));
+
+  // The pending delayed tasks are discarded with the scheduler.
+  thread_pool->ScheduleAfter([]() { FAIL(); }, chrono::hours(1));
+  thread_pool.reset();
+}
+
+TEST(ThreadPoolTaskSchedulerTest, ScheduleAfterDefault) {
+  using testing::_;
+
+  // The custom schedulers wait for the time in the enqueued task.
+  TaskSchedulerMock scheduler;
+  TaskScheduler::CallFuncType task;
+  EXPECT_CALL(scheduler, EnqueueTask(_, olp::thread::HIGH))
+      .WillOnce([&](TaskScheduler::CallFuncType&& func, uint32_t) {
+        task = std::move(func);
+      });
+
+  auto executed = false;
+  const auto start = chrono::steady_clock::now();
+  scheduler.ScheduleAfter([&]() { executed = true; }, kSleep,
+                          olp::thread::HIGH);
+
+  ASSERT_TRUE(task);
+  task();
+  EXPECT_TRUE(executed);
+  EXPECT_GE(chrono::steady_clock::now() - start, kSleep);
+}
+
+TEST(ThreadPoolTaskSchedulerTest, Statistics) {
+  ThreadPool thread_pool(1u);
+  std::promise<void> started;
+  std::promise<void> release;
+  auto release_future = release.get_future().share();
+
+  thread_pool.ScheduleTask(
+      [&]() {
+        started.set_value();
+        release_future.wait();
+      },
+      olp::thread::HIGH);
+
+  std::promise<void> done;
+  const auto last = kNumTasks - 1u;
+  for (size_t i = 0u; i < kNumTasks; ++i) {
+    thread_pool.ScheduleTask(
+        [&, i]() {
+          if (i == last) {
+            done.set_value();
+          }
+        },
+        i % 3u == 0u ? olp::thread::LOW : olp::thread::NORMAL);
+  }
+
+  ASSERT_EQ(started.get_future().wait_for(chrono::milliseconds(kMaxWaitMs)),
+            std::future_status::ready);
+  std::this_thread::sleep_for(chrono::milliseconds(10));
+
+  // The blocking task is running, the others wait in the queue.
+  auto statistics = thread_pool.GetStatistics();
+  EXPECT_EQ(statistics.priorities[olp::thread::LOW].queue_depth,
+            kNumTasks / 3u);
+  EXPECT_EQ(statistics.priorities[olp::thread::NORMAL].queue_depth,
+            kNumTasks - kNumTasks / 3u);
+  ASSERT_EQ(statistics.threads.size(), 1u);
+  EXPECT_GE(statistics.threads[0].current_task_time, chrono::milliseconds(10));
+  EXPECT_GT(statistics.threads[0].busy_ratio, 0.0);
+  EXPECT_GE(statistics.longest_task_time, chrono::milliseconds(10));
+  EXPECT_EQ(statistics.longest_task_priority, olp::thread::HIGH);
+
+  release.set_value();
+  ASSERT_EQ(done.get_future().wait_for(chrono::milliseconds(kMaxWaitMs)),
+            std::future_status::ready);
+
+  // The statistics of the last task are recorded after it returns.
+  for (auto i = 0; i < 100; ++i) {
+    statistics = thread_pool.GetStatistics();
+    if (statistics.threads[0].current_task_time.count() == 0) {
+      break;
+    }
+    std::this_thread::sleep_for(chrono::milliseconds(1));
+  }
+
+  const auto& low = statistics.priorities[olp::thread::LOW];
+  EXPECT_EQ(low.queue_depth, 0u);
+  EXPECT_EQ(low.wait_time.GetCount(), kNumTasks / 3u);
+  EXPECT_EQ(low.execution_time.GetCount(), kNumTasks / 3u);
+  // The queued tasks waited for the blocking task.
+  EXPECT_GE(low.wait_time.GetMax(), chrono::milliseconds(10));
+  EXPECT_EQ(statistics.priorities[olp::thread::HIGH].execution_time.GetCount(),
+            1u);
+  EXPECT_GE(statistics.threads[0].busy_time, chrono::milliseconds(10));
+  EXPECT_EQ(statistics.longest_task_priority, olp::thread::HIGH);
+}
+
+TEST(ThreadPoolTaskSchedulerTest, SlowTaskCallback) {
+  ThreadPool thread_pool(1u);
+
+  std::promise<chrono::microseconds> reported;
+  thread_pool.SetSlowTaskCallback(
+      chrono::milliseconds(20),
+      [&](chrono::microseconds duration, uint32_t priority) {
+        EXPECT_EQ(priority, olp::thread::LOW);
+        reported.set_value(duration);
+      });
+
+  thread_pool.ScheduleTask([]() {});
+  thread_pool.ScheduleTask(
+      []() { std::this_thread::sleep_for(chrono::milliseconds(30)); },
+      olp::thread::LOW);
+
+  auto future = reported.get_future();
+  ASSERT_EQ(future.wait_for(chrono::milliseconds(kMaxWaitMs)),
+            std::future_status::ready);
+  EXPECT_GE(future.get(), chrono::milliseconds(30));
+
+  // No more reports once the callback is reset.
+  thread_pool.SetSlowTaskCallback(chrono::milliseconds(0), nullptr);
+  std::promise<void> done;
+  thread_pool.ScheduleTask([&]() { done.set_value(); });
+  ASSERT_EQ(done.get_future().wait_for(chrono::milliseconds(kMaxWaitMs)),
+            std::future_status::ready);
+}
+
+TEST(ThreadPoolTaskSchedulerTest, ElasticCompensatesBlockedTasks) {
+  ThreadPool::ElasticSettings settings;
+  settings.core_thread_count = 1u;
+  settings.max_thread_count = 2u;
+  settings.idle_timeout = chrono::milliseconds(20);
+  ThreadPool thread_pool(settings);
+
+  for (auto attempt = 0; attempt < 2; ++attempt) {
+    SCOPED_TRACE(attempt);
+    std::promise<void> release;
+    std::promise<void> done;
+
+    // The first task waits for the second one, the pool starts another thread
+    // to run it.
+    thread_pool.ScheduleTask([&]() {
+      olp::thread::ScopedBlockingRegion region;
+      {
+        // Nested regions are reported once.
+        olp::thread::ScopedBlockingRegion nested;
+      }
+      release.get_future().wait();
+      done.set_value();
+    });
+    thread_pool.ScheduleTask([&]() { release.set_value(); });
+
+    ASSERT_EQ(done.get_future().wait_for(chrono::milliseconds(kMaxWaitMs)),
+              std::future_status::ready);
+
+    // Allow the extra thread to stop.
+    std::this_thread::sleep_for(chrono::milliseconds(60));
+  }
+
+  EXPECT_EQ(thread_pool.GetStatistics().threads.size(), 2u);
+}
+
+TEST(ThreadPoolTaskSchedulerTest, BlockingRegionOutsideOfPool) {
+  // Has no effect on the threads not owned by an elastic pool.
+  ThreadPool thread_pool(1u);
+  olp::thread::ScopedBlockingRegion region;
+
+  std::promise<void> done;
+  thread_pool.ScheduleTask([&]() {
+    olp::thread::ScopedBlockingRegion region;
+    done.set_value();
+  });
+  EXPECT_EQ(done.get_future().wait_for(chrono::milliseconds(kMaxWaitMs)),
+            std::future_status::ready);
+}
+
+TEST(ThreadPoolTaskSchedulerTest, SchedulingGroups) {
+  using olp::thread::SchedulingGroup;
+
+  EXPECT_NE(SchedulingGroup().GetId(), SchedulingGroup().GetId());
+  EXPECT_EQ(SchedulingGroup::FromKey("hrn:here:data::olp-here:catalog").GetId(),
+            SchedulingGroup::FromKey("hrn:here:data::olp-here:catalog").GetId());
+  EXPECT_NE(SchedulingGroup::FromKey("a").GetId(),
+            SchedulingGroup::FromKey("b").GetId());
+  EXPECT_EQ(SchedulingGroup(0u).GetWeight(), 1u);
+
+  auto thread_pool = std::make_shared<ThreadPool>(1u);
+  auto large = olp::thread::CreateGroupTaskScheduler(thread_pool,
+                                                     SchedulingGroup());
+  auto small = olp::thread::CreateGroupTaskScheduler(thread_pool,
+                                                     SchedulingGroup(3u));
+  EXPECT_FALSE(olp::thread::CreateGroupTaskScheduler(nullptr,
+                                                      SchedulingGroup()));
+
+  // Blocks the thread until all the tasks are queued.
+  std::promise<void> started;
+  std::promise<void> release;
+  auto release_future = release.get_future().share();
+  thread_pool->ScheduleTask([&, release_future]() {
+    started.set_value();
+    release_future.wait();
+  });
+  started.get_future().wait();
+
+  std::mutex mutex;
+  std::string order;
+  std::promise<void> done;
+  const auto total = kNumTasks + kNumTasks / 2u + 1u;
+  auto record = [&](char group) {
+    std::lock_guard<std::mutex> lock(mutex);
+    order += group;
+    if (order.size() == total) {
+      done.set_value();
+    }
+  };
+
+  for (size_t i = 0u; i < kNumTasks; ++i) {
+    large->ScheduleTask([&]() { record('l'); });
+  }
+  for (size_t i = 0u; i < kNumTasks / 2u; ++i) {
+    small->ScheduleTask([&]() { record('s'); });
+  }
+  // The priorities are kept between the groups.
+  large->ScheduleTask([&]() { record('h'); }, olp::thread::HIGH);
+
+  release.set_value();
+  ASSERT_EQ(done.get_future().wait_for(chrono::milliseconds(kMaxWaitMs)),
+            std::future_status::ready);
+
+  // The group with the weight of three runs three tasks per a task of
+  // the other group, instead of waiting for all of them.
+  EXPECT_EQ(order.front(), 'h');
+  const auto first = order.substr(1u, 16u);
+  const auto small_count = std::count(first.begin(), first.end(), 's');
+  EXPECT_GE(small_count, 11);
+  EXPECT_LE(small_count, 13);
+  EXPECT_LE(order.find_last_of('s'), kNumTasks / 2u + kNumTasks / 6u + 1u);
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "thread/TimerWheel.h"
+
+namespace {
+using olp::thread::TimerWheel;
+using std::chrono::milliseconds;
+
+constexpr auto kMaxWait = std::chrono::seconds(5);
+
+TEST(TimerWheelTest, FiresInOrder) {
+  TimerWheel wheel;
+  const auto start = TimerWheel::Clock::now();
+
+  std::mutex mutex;
+  std::vector<int> fired;
+  std::promise<void> done;
+
+  // Covers the first two levels of the wheel and an expired timer.
+  const std::vector<int> delays = {150, 5, 70, 0, 30};
+  for (auto delay : delays) {
+    wheel.Add(start + milliseconds(delay), [&, delay, start]() {
+      EXPECT_GE(TimerWheel::Clock::now() - start, milliseconds(delay));
+      std::lock_guard<std::mutex> lock(mutex);
+      fired.push_back(delay);
+      if (fired.size() == delays.size()) {
+        done.set_value();
+      }
+    });
+  }
+
+  ASSERT_EQ(done.get_future().wait_for(kMaxWait), std::future_status::ready);
+  EXPECT_EQ(fired, std::vector<int>({0, 5, 30, 70, 150}));
+  EXPECT_EQ(wheel.Size(), 0u);
+}
+
+TEST(TimerWheelTest, ManyTimersNeverFireEarly) {
+  TimerWheel wheel;
+  const auto start = TimerWheel::Clock::now();
+
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<int> delay_distribution(0, 300);
+
+  constexpr size_t kTimers = 500u;
+  std::mutex mutex;
+  size_t fired = 0u;
+  size_t early = 0u;
+  std::promise<void> done;
+
+  for (size_t i = 0u; i < kTimers; ++i) {
+    const auto time = start + milliseconds(delay_distribution(generator));
+    wheel.Add(time, [&, time]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      early += TimerWheel::Clock::now() < time ? 1u : 0u;
+      if (++fired == kTimers) {
+        done.set_value();
+      }
+    });
+  }
+
+  ASSERT_EQ(done.get_future().wait_for(kMaxWait), std::future_status::ready);
+  EXPECT_EQ(early, 0u);
+}
+
+TEST(TimerWheelTest, Cancel) {
+  auto wheel = std::make_shared<TimerWheel>();
+  const auto now = TimerWheel::Clock::now();
+
+  std::atomic<int> fired{0};
+  std::promise<void> done;
+
+  auto token = TimerWheel::Schedule(wheel, now + milliseconds(20),
+                                    [&]() { ++fired; });
+  TimerWheel::Schedule(wheel, now + milliseconds(80),
+                       [&]() { done.set_value(); });
+  EXPECT_EQ(wheel->Size(), 2u);
+
+  token.Cancel();
+  EXPECT_EQ(wheel->Size(), 1u);
+
+  ASSERT_EQ(done.get_future().wait_for(kMaxWait), std::future_status::ready);
+  EXPECT_EQ(fired.load(), 0);
+
+  // The token does not keep the wheel alive.
+  token = TimerWheel::Schedule(wheel, now + std::chrono::hours(10),
+                               [&]() { ++fired; });
+  wheel.reset();
+  token.Cancel();
+  EXPECT_EQ(fired.load(), 0);
+}
+
+}  // namespace
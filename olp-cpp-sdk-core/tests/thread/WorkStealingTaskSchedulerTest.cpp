@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <olp/core/client/CancellationContext.h>
+#include <olp/core/thread/WorkStealingTaskScheduler.h>
+
+namespace {
+
+using CancellationContext = olp::client::CancellationContext;
+using TaskScheduler = olp::thread::TaskScheduler;
+using WorkStealingTaskScheduler = olp::thread::WorkStealingTaskScheduler;
+
+namespace chrono = std::chrono;
+
+constexpr size_t kThreads{3u};
+constexpr size_t kNumTasks{30u};
+constexpr chrono::milliseconds kMaxWait{1000};
+
+TEST(WorkStealingTaskSchedulerTest, MultiUserPush) {
+  constexpr uint32_t kPushThreads = 3;
+  constexpr uint32_t kTotalTasks = kPushThreads * (2 * kNumTasks);
+
+  auto scheduler = std::make_shared<WorkStealingTaskScheduler>(kThreads);
+  std::atomic<uint32_t> counter(0u);
+  std::promise<void> done;
+
+  auto count = [&]() {
+    if (++counter == kTotalTasks) {
+      done.set_value();
+    }
+  };
+
+  std::vector<std::thread> push_threads;
+  for (size_t idx = 0; idx < kPushThreads; ++idx) {
+    push_threads.emplace_back([&] {
+      for (uint32_t task = 0u; task < kNumTasks; ++task) {
+        scheduler->ScheduleTask([&](const CancellationContext&) { count(); });
+        scheduler->ScheduleTask([&]() { count(); });
+      }
+    });
+  }
+
+  for (auto& thread : push_threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(done.get_future().wait_for(kMaxWait), std::future_status::ready);
+  EXPECT_EQ(kTotalTasks, counter.load());
+}
+
+TEST(WorkStealingTaskSchedulerTest, Prioritization) {
+  auto scheduler = std::make_shared<WorkStealingTaskScheduler>(1u);
+
+  std::promise<void> block_promise;
+  auto block_future = block_promise.get_future().share();
+  scheduler->ScheduleTask([=]() { block_future.wait_for(kMaxWait); },
+                          std::numeric_limits<uint32_t>::max());
+
+  const olp::thread::Priority priorities[] = {
+      olp::thread::LOW, olp::thread::NORMAL, olp::thread::HIGH};
+
+  std::vector<std::pair<uint32_t, uint32_t>> executed;
+  for (uint32_t id = 0u; id < kNumTasks; ++id) {
+    const auto priority = priorities[id % 3];
+    scheduler->ScheduleTask(
+        [&executed, id, priority]() { executed.emplace_back(priority, id); },
+        priority);
+  }
+
+  block_promise.set_value();
+
+  std::promise<void> done;
+  scheduler->ScheduleTask([&]() { done.set_value(); }, 0u);
+  ASSERT_EQ(done.get_future().wait_for(kMaxWait), std::future_status::ready);
+
+  // Higher priorities first, the same priority in the scheduling order.
+  ASSERT_EQ(executed.size(), kNumTasks);
+  EXPECT_TRUE(std::is_sorted(executed.begin(), executed.end(),
+                             [](const std::pair<uint32_t, uint32_t>& lhs,
+                                const std::pair<uint32_t, uint32_t>& rhs) {
+                               return lhs.first > rhs.first ||
+                                      (lhs.first == rhs.first &&
+                                       lhs.second < rhs.second);
+                             }));
+}
+
+TEST(WorkStealingTaskSchedulerTest, IdleWorkersStealSpawnedTasks) {
+  auto scheduler = std::make_shared<WorkStealingTaskScheduler>(kThreads);
+
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  std::atomic<uint32_t> counter(0u);
+  std::promise<void> done;
+
+  // All the tasks are spawned by a single worker, so they go to its queue.
+  // The tasks wait until all the workers take part, which only happens if
+  // the idle workers steal them.
+  scheduler->ScheduleTask([&]() {
+    for (uint32_t task = 0u; task < kNumTasks; ++task) {
+      scheduler->ScheduleTask([&]() {
+        const auto deadline = chrono::steady_clock::now() + kMaxWait;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          threads.insert(std::this_thread::get_id());
+        }
+        while (chrono::steady_clock::now() < deadline) {
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (threads.size() == kThreads) {
+              break;
+            }
+          }
+          std::this_thread::sleep_for(chrono::milliseconds(1));
+        }
+
+        if (++counter == kNumTasks) {
+          done.set_value();
+        }
+      });
+    }
+  });
+
+  ASSERT_EQ(done.get_future().wait_for(2 * kMaxWait),
+            std::future_status::ready);
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ(threads.size(), kThreads);
+}
+
+TEST(WorkStealingTaskSchedulerTest, DiscardsPendingTasks) {
+  auto scheduler = std::make_shared<WorkStealingTaskScheduler>(1u);
+
+  std::promise<void> started;
+  std::promise<void> block_promise;
+  auto block_future = block_promise.get_future().share();
+  std::atomic<uint32_t> counter(0u);
+
+  scheduler->ScheduleTask([&, block_future]() {
+    started.set_value();
+    block_future.wait_for(kMaxWait);
+  });
+  for (uint32_t task = 0u; task < kNumTasks; ++task) {
+    scheduler->ScheduleTask([&]() { ++counter; });
+  }
+
+  ASSERT_EQ(started.get_future().wait_for(kMaxWait),
+            std::future_status::ready);
+
+  std::thread release([&]() {
+    std::this_thread::sleep_for(chrono::milliseconds(50));
+    block_promise.set_value();
+  });
+  scheduler.reset();
+  release.join();
+
+  EXPECT_EQ(counter.load(), 0u);
+}
+
+TEST(WorkStealingTaskSchedulerTest, Statistics) {
+  WorkStealingTaskScheduler scheduler(kThreads);
+  std::atomic<uint32_t> counter(0u);
+  std::promise<void> done;
+
+  for (size_t i = 0u; i < kNumTasks; ++i) {
+    scheduler.ScheduleTask(
+        [&]() {
+          std::this_thread::sleep_for(chrono::milliseconds(1));
+          if (++counter == kNumTasks) {
+            done.set_value();
+          }
+        },
+        olp::thread::LOW);
+  }
+
+  ASSERT_EQ(done.get_future().wait_for(kMaxWait), std::future_status::ready);
+
+  // The last task is recorded after it returns.
+  TaskScheduler::Statistics statistics;
+  for (auto i = 0; i < 100; ++i) {
+    statistics = scheduler.GetStatistics();
+    if (statistics.priorities[olp::thread::LOW].execution_time.GetCount() ==
+        kNumTasks) {
+      break;
+    }
+    std::this_thread::sleep_for(chrono::milliseconds(1));
+  }
+
+  const auto& low = statistics.priorities[olp::thread::LOW];
+  EXPECT_EQ(low.queue_depth, 0u);
+  EXPECT_EQ(low.wait_time.GetCount(), kNumTasks);
+  EXPECT_EQ(low.execution_time.GetCount(), kNumTasks);
+  EXPECT_GE(low.execution_time.GetMax(), chrono::milliseconds(1));
+  ASSERT_EQ(statistics.threads.size(), kThreads);
+  EXPECT_GE(statistics.longest_task_time, chrono::milliseconds(1));
+}
+
+}  // namespace
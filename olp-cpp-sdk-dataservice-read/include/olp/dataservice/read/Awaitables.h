@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+/**
+ * @file
+ * @brief The C++20 coroutine wrappers of the asynchronous client calls.
+ *
+ * Every function returns an awaitable that starts the call when awaited and
+ * resumes the coroutine with the response, without blocking a thread:
+ *
+ * @code
+ *     thread::Task<DataResponse> GetData(VersionedLayerClient& client,
+ *                                        DataRequest request) {
+ *       co_return co_await read::AwaitGetData(client, std::move(request));
+ *     }
+ * @endcode
+ *
+ * The optional `CancellationContext` cancels the call, and the optional
+ * `TaskScheduler` is used to resume the coroutine. Without a scheduler,
+ * the coroutine is resumed on the thread that invokes the callback, which
+ * is a thread of the task scheduler of the client. The client must outlive
+ * the call.
+ */
+
+#include <olp/core/thread/Coroutine.h>
+
+#ifdef OLP_SDK_HAS_COROUTINES
+
+#include <memory>
+#include <utility>
+
+#include <olp/core/client/CancellationContext.h>
+#include <olp/dataservice/read/StreamLayerClient.h>
+#include <olp/dataservice/read/Types.h>
+#include <olp/dataservice/read/VersionedLayerClient.h>
+
+namespace olp {
+namespace dataservice {
+namespace read {
+
+namespace detail {
+
+template <typename Response, typename Start>
+thread::CallbackAwaiter<Response> MakeAwaiter(
+    Start start, client::CancellationContext context,
+    std::shared_ptr<thread::TaskScheduler> scheduler) {
+  return thread::CallbackAwaiter<Response>(
+      std::move(start), std::move(context), std::move(scheduler));
+}
+
+}  // namespace detail
+
+/// Awaits `VersionedLayerClient::GetData` for a partition.
+inline thread::CallbackAwaiter<DataResponse> AwaitGetData(
+    VersionedLayerClient& client, DataRequest request,
+    client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<DataResponse>(
+      [&client, request](DataResponseCallback callback) mutable {
+        return client.GetData(std::move(request), std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `VersionedLayerClient::GetData` for a tile.
+inline thread::CallbackAwaiter<DataResponse> AwaitGetData(
+    VersionedLayerClient& client, TileRequest request,
+    client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<DataResponse>(
+      [&client, request](DataResponseCallback callback) mutable {
+        return client.GetData(std::move(request), std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `VersionedLayerClient::GetPartitions`.
+inline thread::CallbackAwaiter<PartitionsResponse> AwaitGetPartitions(
+    VersionedLayerClient& client, PartitionsRequest request,
+    client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<PartitionsResponse>(
+      [&client, request](PartitionsResponseCallback callback) mutable {
+        return client.GetPartitions(std::move(request), std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `VersionedLayerClient::PrefetchTiles`.
+inline thread::CallbackAwaiter<PrefetchTilesResponse> AwaitPrefetchTiles(
+    VersionedLayerClient& client, PrefetchTilesRequest request,
+    PrefetchStatusCallback status_callback = nullptr,
+    client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<PrefetchTilesResponse>(
+      [&client, request,
+       status_callback](PrefetchTilesResponseCallback callback) mutable {
+        return client.PrefetchTiles(std::move(request), std::move(callback),
+                                    std::move(status_callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `StreamLayerClient::Subscribe`.
+inline thread::CallbackAwaiter<SubscribeResponse> AwaitSubscribe(
+    StreamLayerClient& client, SubscribeRequest request,
+    client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<SubscribeResponse>(
+      [&client, request](SubscribeResponseCallback callback) mutable {
+        return client.Subscribe(std::move(request), std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `StreamLayerClient::Unsubscribe`.
+inline thread::CallbackAwaiter<UnsubscribeResponse> AwaitUnsubscribe(
+    StreamLayerClient& client, client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<UnsubscribeResponse>(
+      [&client](UnsubscribeResponseCallback callback) {
+        return client.Unsubscribe(std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `StreamLayerClient::GetData` for a message.
+inline thread::CallbackAwaiter<DataResponse> AwaitGetData(
+    StreamLayerClient& client, model::Message message,
+    client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<DataResponse>(
+      [&client, message](DataResponseCallback callback) {
+        return client.GetData(message, std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `StreamLayerClient::Poll`.
+inline thread::CallbackAwaiter<PollResponse> AwaitPoll(
+    StreamLayerClient& client, client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<PollResponse>(
+      [&client](PollResponseCallback callback) {
+        return client.Poll(std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+/// Awaits `StreamLayerClient::Seek`.
+inline thread::CallbackAwaiter<SeekResponse> AwaitSeek(
+    StreamLayerClient& client, SeekRequest request,
+    client::CancellationContext context = {},
+    std::shared_ptr<thread::TaskScheduler> scheduler = nullptr) {
+  return detail::MakeAwaiter<SeekResponse>(
+      [&client, request](SeekResponseCallback callback) mutable {
+        return client.Seek(std::move(request), std::move(callback));
+      },
+      std::move(context), std::move(scheduler));
+}
+
+}  // namespace read
+}  // namespace dataservice
+}  // namespace olp
+
+#endif  // OLP_SDK_HAS_COROUTINES
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,11 +19,13 @@
 
 #pragma once
 
+#include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <olp/core/client/AdaptiveConcurrencyLimiter.h>
 #include <olp/core/geo/tiling/TileKey.h>
 #include <olp/core/porting/optional.h>
 #include <olp/core/thread/TaskScheduler.h>
@@ -180,6 +182,36 @@ class DATASERVICE_READ_API PrefetchTilesRequest final {
     return *this;
   }
 
+  /**
+   * @brief Gets the concurrency limiter of the downloads.
+   *
+   * @return The limiter, or `nullptr` if the downloads are not limited.
+   */
+  const std::shared_ptr<client::AdaptiveConcurrencyLimiter>&
+  GetConcurrencyLimiter() const {
+    return concurrency_limiter_;
+  }
+
+  /**
+   * @brief Sets the adaptive limiter of the concurrent data downloads.
+   *
+   * The limiter adjusts the number of the downloads in flight to the link
+   * conditions: it grows while the latency stays low and backs off on
+   * overload responses and latency inflation. Share one limiter between the
+   * prefetch requests that use the same link.
+   *
+   * By default, the downloads are limited only by the task scheduler.
+   *
+   * @param limiter The limiter.
+   *
+   * @return A reference to the updated `PrefetchTilesRequest` instance.
+   */
+  PrefetchTilesRequest& WithConcurrencyLimiter(
+      std::shared_ptr<client::AdaptiveConcurrencyLimiter> limiter) {
+    concurrency_limiter_ = std::move(limiter);
+    return *this;
+  }
+
   /**
    * @brief Creates a readable format for the request.
    *
@@ -205,6 +237,7 @@ class DATASERVICE_READ_API PrefetchTilesRequest final {
   porting::optional<std::string> billing_tag_;
   bool data_aggregation_enabled_{false};
   uint32_t priority_{thread::LOW};
+  std::shared_ptr<client::AdaptiveConcurrencyLimiter> concurrency_limiter_;
 };
 
 }  // namespace read
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -40,7 +40,7 @@ constexpr auto kLogTag = "CatalogClientImpl";
 CatalogClientImpl::CatalogClientImpl(client::HRN catalog,
                                      client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       lookup_client_(catalog_, settings_),
       task_sink_(settings_.task_scheduler) {
   if (!settings_.cache) {
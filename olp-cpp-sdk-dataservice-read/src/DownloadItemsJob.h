@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <olp/core/client/AdaptiveConcurrencyLimiter.h>
 #include <olp/core/client/CancellationContext.h>
 #include <olp/core/logging/Log.h>
 #include <olp/dataservice/read/Types.h>
@@ -53,11 +58,13 @@ class DownloadItemsJob {
       DownloadFunc download,
       AppendResultFunc<ItemType, PrefetchResult> append_result,
       Callback<PrefetchResult> user_callback,
-      PrefetchStatusCallbackType<PrefetchStatusType> status_callback)
+      PrefetchStatusCallbackType<PrefetchStatusType> status_callback,
+      std::shared_ptr<client::AdaptiveConcurrencyLimiter> limiter = nullptr)
       : download_(std::move(download)),
         append_result_(std::move(append_result)),
         user_callback_(std::move(user_callback)),
-        status_callback_(std::move(status_callback)) {}
+        status_callback_(std::move(status_callback)),
+        limiter_(std::move(limiter)) {}
 
   void Initialize(size_t items_count, client::NetworkStatistics statistics) {
     download_task_count_ = total_download_task_count_ = items_count;
@@ -66,8 +73,24 @@ class DownloadItemsJob {
 
   ExtendedDataResponse Download(const std::string& data_handle,
                                 client::CancellationContext context) {
-    return download_(data_handle, context);
+    if (!limiter_) {
+      return download_(data_handle, context);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto response = download_(data_handle, context);
+    limiter_->Update(
+        GetLatencySample(std::chrono::steady_clock::now() - start,
+                         GetNetworkStatistics(response).GetBytesDownloaded()),
+        GetOutcome(response));
+    return response;
   }
+
+  const std::shared_ptr<client::AdaptiveConcurrencyLimiter>&
+  GetConcurrencyLimiter() const {
+    return limiter_;
+  }
+
   size_t GetAccumulatedBytes(const olp::client::NetworkStatistics& statistics) {
     // This narrow cast is necessary to avoid narrowing compiler errors like
     // -Wc++11-narrowing when building for 32bit targets.
@@ -110,10 +133,41 @@ class DownloadItemsJob {
   }
 
  private:
+  // The limiter compares the samples with the fastest one, so the time of a
+  // large blob is scaled down to the time of `kLatencySampleBytes`; otherwise,
+  // a large blob looks like a congested link.
+  static std::chrono::milliseconds GetLatencySample(
+      std::chrono::steady_clock::duration elapsed, uint64_t bytes_downloaded) {
+    // Blobs up to this size are dominated by the round trip, not the transfer.
+    const uint64_t kLatencySampleBytes = 64u * 1024u;
+    if (bytes_downloaded > kLatencySampleBytes) {
+      elapsed = elapsed * kLatencySampleBytes / bytes_downloaded;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+  }
+
+  static client::AdaptiveConcurrencyLimiter::Outcome GetOutcome(
+      const ExtendedDataResponse& response) {
+    using Outcome = client::AdaptiveConcurrencyLimiter::Outcome;
+    if (response.IsSuccessful()) {
+      // Cached data says nothing about the network.
+      return GetNetworkStatistics(response).GetBytesDownloaded() > 0
+                 ? Outcome::kSuccess
+                 : Outcome::kIgnored;
+    }
+    const auto& error = response.GetError();
+    if (error.GetErrorCode() == client::ErrorCode::Cancelled) {
+      return Outcome::kIgnored;
+    }
+    return client::AdaptiveConcurrencyLimiter::Classify(
+        error.GetHttpStatusCode());
+  }
+
   DownloadFunc download_;
   AppendResultFunc<ItemType, PrefetchResult> append_result_;
   Callback<PrefetchResult> user_callback_;
   PrefetchStatusCallbackType<PrefetchStatusType> status_callback_;
+  std::shared_ptr<client::AdaptiveConcurrencyLimiter> limiter_;
   size_t download_task_count_{0};
   size_t total_download_task_count_{0};
   size_t requests_succeeded_{0};
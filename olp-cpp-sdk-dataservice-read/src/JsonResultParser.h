@@ -32,13 +32,13 @@ namespace parser {
 
 template <typename OutputResult,
           typename ParsingType = typename OutputResult::ResultType,
-          typename... AdditionalArgs>
+          typename JsonInput, typename... AdditionalArgs>
 typename std::enable_if<
     std::is_constructible<ParsingType, ParsingType, AdditionalArgs...>::value,
     OutputResult>::type
-parse_result(std::stringstream& json_stream, const AdditionalArgs&... args) {
+parse_result(JsonInput& json_input, const AdditionalArgs&... args) {
   bool res = true;
-  auto obj = parse<ParsingType>(json_stream, res);
+  auto obj = parse<ParsingType>(json_input, res);
 
   if (res) {
     return ParsingType(std::move(obj), args...);
@@ -50,13 +50,13 @@ parse_result(std::stringstream& json_stream, const AdditionalArgs&... args) {
 
 template <typename OutputResult,
           typename ParsingType = typename OutputResult::ResultType,
-          typename... AdditionalArgs>
+          typename JsonInput, typename... AdditionalArgs>
 typename std::enable_if<
     !std::is_constructible<ParsingType, ParsingType, AdditionalArgs...>::value,
     OutputResult>::type
-parse_result(std::stringstream& json_stream, const AdditionalArgs&... args) {
+parse_result(JsonInput& json_input, const AdditionalArgs&... args) {
   bool res = true;
-  auto obj = parse<ParsingType>(json_stream, res);
+  auto obj = parse<ParsingType>(json_input, res);
 
   if (res) {
     return OutputResult({std::move(obj), args...});
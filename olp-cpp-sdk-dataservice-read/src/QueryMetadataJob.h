@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -157,7 +157,8 @@ class QueryMetadataJob {
                   const std::string& data_handle = item.second;
                   const auto& item_key = item.first;
 
-                  auto result = task_sink_.AddTaskChecked(
+                  auto result = task_sink_.AddLimitedTaskChecked(
+                      download_job->GetConcurrencyLimiter(),
                       [=](client::CancellationContext context) {
                         return download_job->Download(data_handle, context);
                       },
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -62,7 +62,7 @@ StreamLayerClientImpl::StreamLayerClientImpl(client::HRN catalog,
                                              client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
       layer_id_(std::move(layer_id)),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       lookup_client_(catalog_, settings_),
       task_sink_(settings_.task_scheduler) {
   if (!settings_.cache) {
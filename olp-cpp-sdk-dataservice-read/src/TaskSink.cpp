@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 
 #include "TaskSink.h"
 
+#include <atomic>
+
 #include <olp/core/logging/Log.h>
 
 namespace olp {
@@ -75,6 +77,69 @@ bool TaskSink::AddTaskImpl(client::TaskContext task, uint32_t priority) {
   }
 }
 
+bool TaskSink::AddLimitedTaskImpl(
+    client::TaskContext task, client::CancellationContext context,
+    uint32_t priority,
+    std::shared_ptr<client::AdaptiveConcurrencyLimiter> limiter) {
+  if (!task_scheduler_) {
+    ExecuteTask(std::move(task));
+    return true;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      OLP_SDK_LOG_WARNING(
+          kLogTag, "Attempt to add a task when the sink is already closed");
+      return false;
+    }
+
+    pending_requests_->Insert(task);
+  }
+
+  // The task stays in the pending requests while it waits for a slot, so the
+  // destructor waits for it. The deferred calls must not use the sink itself.
+  auto pending_requests = pending_requests_;
+  auto task_scheduler = task_scheduler_;
+  auto schedule = [=](std::function<void()> on_completed) {
+    task_scheduler->ScheduleTask(
+        [=] {
+          task.Execute();
+          pending_requests->Remove(task);
+          on_completed();
+        },
+        priority);
+  };
+
+  // The task is started either by the limiter or by the cancellation, which
+  // does not wait for a slot; the first one claims it.
+  auto claimed = std::make_shared<std::atomic<bool>>(false);
+  auto start_cancelled = [=] {
+    if (!claimed->exchange(true)) {
+      schedule([] {});
+    }
+  };
+
+  if (!context.ExecuteOrCancelled(
+          [&] { return client::CancellationToken(start_cancelled); },
+          start_cancelled)) {
+    return true;
+  }
+
+  limiter->Acquire([=]() mutable {
+    if (claimed->exchange(true)) {
+      limiter->Release();
+      return;
+    }
+
+    // The token refers to the task, which owns the context.
+    context.ExecuteOrCancelled([] { return client::CancellationToken(); });
+    schedule([=] { limiter->Release(); });
+  });
+
+  return true;
+}
+
 bool TaskSink::ScheduleTask(client::TaskContext task, uint32_t priority) {
   std::lock_guard<std::mutex> lock(mutex_);
   if (closed_) {
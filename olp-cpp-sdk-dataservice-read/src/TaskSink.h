@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,9 @@
 
 #pragma once
 
+#include <memory>
+
+#include <olp/core/client/AdaptiveConcurrencyLimiter.h>
 #include <olp/core/client/CancellationToken.h>
 #include <olp/core/client/PendingRequests.h>
 #include <olp/core/client/TaskContext.h>
@@ -66,9 +69,31 @@ class TaskSink {
     return context.CancelToken();
   }
 
+  /// Same as `AddTaskChecked`, but the task is started only when the limiter
+  /// has a free slot. The slot is released after the task completes. A task
+  /// cancelled while it waits for a slot runs without one.
+  template <typename Function, typename Callback>
+  porting::optional<client::CancellationToken> AddLimitedTaskChecked(
+      std::shared_ptr<client::AdaptiveConcurrencyLimiter> limiter,
+      Function task, Callback callback, uint32_t priority) {
+    client::CancellationContext cancellation_context;
+    auto context = client::TaskContext::Create(
+        std::move(task), std::move(callback), cancellation_context);
+    if (!AddLimitedTaskImpl(context, std::move(cancellation_context), priority,
+                            std::move(limiter))) {
+      return olp::porting::none;
+    }
+    return context.CancelToken();
+  }
+
  protected:
   bool AddTaskImpl(client::TaskContext task, uint32_t priority);
 
+  bool AddLimitedTaskImpl(
+      client::TaskContext task, client::CancellationContext context,
+      uint32_t priority,
+      std::shared_ptr<client::AdaptiveConcurrencyLimiter> limiter);
+
   bool ScheduleTask(client::TaskContext task, uint32_t priority);
 
   const std::shared_ptr<thread::TaskScheduler> task_scheduler_;
@@ -65,7 +65,7 @@ VersionedLayerClientImpl::VersionedLayerClientImpl(
     client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
       layer_id_(std::move(layer_id)),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       catalog_version_(catalog_version ? *catalog_version : kInvalidVersion),
       lookup_client_(catalog_, settings_),
       task_sink_(settings_.task_scheduler) {
@@ -381,7 +381,8 @@ client::CancellationToken VersionedLayerClientImpl::PrefetchPartitions(
 
     auto download_job = std::make_shared<PrefetchPartitionsHelper::DownloadJob>(
         std::move(download), std::move(append_result),
-        std::move(call_user_callback), std::move(status_callback));
+        std::move(call_user_callback), std::move(status_callback),
+        request.GetConcurrencyLimiter());
     return PrefetchPartitionsHelper::Prefetch(
         std::move(download_job), request.GetPartitionIds(), std::move(query),
         task_sink_, request.GetPriority(), std::move(context));
@@ -581,7 +582,8 @@ client::CancellationToken VersionedLayerClientImpl::PrefetchTiles(
           auto download_job =
               std::make_shared<PrefetchTilesHelper::DownloadJob>(
                   std::move(download), std::move(append_result),
-                  std::move(callback), std::move(status_callback));
+                  std::move(callback), std::move(status_callback),
+                  request.GetConcurrencyLimiter());
 
           return PrefetchTilesHelper::Prefetch(
               std::move(download_job), roots, std::move(query),
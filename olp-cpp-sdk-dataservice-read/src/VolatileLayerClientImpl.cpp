@@ -65,7 +65,7 @@ VolatileLayerClientImpl::VolatileLayerClientImpl(
     client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
       layer_id_(std::move(layer_id)),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       lookup_client_(catalog_, settings_),
       task_sink_(settings_.task_scheduler) {
   if (!settings_.cache) {
@@ -294,7 +294,7 @@ client::CancellationToken VolatileLayerClientImpl::PrefetchTiles(
 
         auto download_job = std::make_shared<PrefetchTilesHelper::DownloadJob>(
             std::move(download), std::move(append_result), std::move(callback),
-            nullptr);
+            nullptr, request.GetConcurrencyLimiter());
         return PrefetchTilesHelper::Prefetch(
             std::move(download_job), std::move(roots), std::move(query),
             std::move(filter), task_sink_, request.GetPriority(), context);
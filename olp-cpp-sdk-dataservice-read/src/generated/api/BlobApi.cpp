@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,17 +19,170 @@
 
 #include "BlobApi.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
 #include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <olp/core/client/OlpClient.h>
+#include <olp/core/http/NetworkUtils.h>
+#include <olp/core/thread/ScopedBlockingRegion.h>
 
 namespace olp {
 namespace dataservice {
 namespace read {
+namespace {
+
+/// The number of times a range is requested before the download fails.
+constexpr int kMaxRangeAttempts = 3;
+
+struct BlobRange {
+  std::uint64_t offset;
+  std::uint64_t length;
+  int attempts;
+};
+
+/// The state shared with the callbacks of the range requests.
+struct RangedDownload {
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::shared_ptr<std::vector<unsigned char>> buffer;
+  std::vector<BlobRange> failed_ranges;
+  porting::optional<client::ApiError> error;
+  porting::optional<client::ApiError> last_retryable_error;
+  client::NetworkStatistics statistics;
+  std::vector<client::CancellationToken> tokens;
+  size_t pending{0u};
+  bool cancelled{false};
+  bool completed{false};
+  bool size_mismatch{false};
+};
+
+std::string ToRangeParam(const BlobRange& range) {
+  return "bytes=" + std::to_string(range.offset) + "-" +
+         std::to_string(range.offset + range.length - 1u);
+}
+
+const std::string* FindContentRange(const http::Headers& headers) {
+  for (const auto& header : headers) {
+    if (http::NetworkUtils::CaseInsensitiveCompare(header.first,
+                                                   "Content-Range")) {
+      return &header.second;
+    }
+  }
+  return nullptr;
+}
+
+/// Gets the complete length from the `Content-Range: bytes 0-9/100` header.
+porting::optional<std::uint64_t> GetCompleteLength(
+    const std::string& content_range) {
+  const auto slash = content_range.rfind('/');
+  if (slash != std::string::npos && slash + 1u < content_range.size() &&
+      content_range[slash + 1u] != '*') {
+    return std::strtoull(content_range.c_str() + slash + 1u, nullptr, 10);
+  }
+  return porting::none;
+}
+
+size_t GetBodySize(client::HttpResponse& response) {
+  const auto& buffer = response.GetResponseBuffer();
+  if (!buffer.Empty()) {
+    return buffer.Size();
+  }
+
+  auto& stream = response.GetRawResponse();
+  stream.seekg(0, std::ios::end);
+  const auto size = stream.tellg();
+  stream.seekg(0, std::ios::beg);
+  return size > 0 ? static_cast<size_t>(size) : 0u;
+}
+
+/// Copies the body without an intermediate buffer, `output` must be at least
+/// `GetBodySize` bytes long.
+void CopyBody(client::HttpResponse& response, unsigned char* output) {
+  const auto& buffer = response.GetResponseBuffer();
+  if (!buffer.Empty()) {
+    buffer.CopyTo(output);
+    return;
+  }
+
+  auto& stream = response.GetRawResponse();
+  stream.read(reinterpret_cast<char*>(output),
+              static_cast<std::streamsize>(GetBodySize(response)));
+}
+
+/// Must be called with the `RangedDownload::mutex` locked. The mutex is
+/// released while the body of the range is copied.
+void HandleRangeResponse(
+    const client::RetrySettings::RetryCondition& retry_condition,
+    RangedDownload& download, const BlobRange& range,
+    client::HttpResponse& response, std::unique_lock<std::mutex>& lock) {
+  download.statistics += response.GetNetworkStatistics();
+
+  if (download.completed || download.size_mismatch) {
+    // The other requests are cancelled, as the result is already known.
+    return;
+  }
+
+  const auto status = response.GetStatus();
+  const auto blob_size = download.buffer->size();
+
+  if (status == http::HttpStatusCode::PARTIAL_CONTENT) {
+    // A partial response without the Content-Range header does not tell
+    // which part of the blob it contains.
+    const auto* content_range = FindContentRange(response.GetHeaders());
+    const auto complete_length =
+        content_range ? GetCompleteLength(*content_range) : porting::none;
+    const auto body_size = GetBodySize(response);
+    if (!content_range || (complete_length && *complete_length != blob_size) ||
+        body_size > range.length) {
+      download.size_mismatch = true;
+      return;
+    }
+
+    // The ranges do not overlap, so they are copied concurrently.
+    auto buffer = download.buffer;
+    lock.unlock();
+    CopyBody(response, buffer->data() + range.offset);
+    lock.lock();
+
+    if (body_size == 0u) {
+      download.last_retryable_error = client::ApiError(
+          status, "The partial response of the range has no content");
+    }
+
+    if (body_size < range.length) {
+      // Resume the interrupted range from the first missing byte.
+      download.failed_ranges.push_back(
+          {range.offset + body_size, range.length - body_size,
+           body_size > 0u ? 0 : range.attempts});
+    }
+  } else if (status == http::HttpStatusCode::OK) {
+    // The server ignored the range and sent the whole blob.
+    if (GetBodySize(response) != blob_size) {
+      download.size_mismatch = true;
+      return;
+    }
+
+    download.buffer = response.ReleaseResponseAsBytes();
+    download.completed = true;
+  } else if (status ==
+             static_cast<int>(http::ErrorCode::CANCELLED_ERROR)) {
+    download.cancelled = true;
+  } else if (status < 0 || (retry_condition && retry_condition(response))) {
+    download.failed_ranges.push_back(range);
+    download.last_retryable_error = client::ApiError(status);
+  } else {
+    download.error = client::ApiError(status);
+  }
+}
+
+}  // namespace
 
 BlobApi::DataResponse BlobApi::GetBlob(
     const client::OlpClient& client, const std::string& layer_id,
@@ -84,6 +237,172 @@ BlobApi::DataResponse BlobApi::GetBlob(
   return {std::make_shared<std::vector<unsigned char>>(std::move(buffer)),
           api_response.GetNetworkStatistics()};
 }
+
+BlobApi::DataResponse BlobApi::GetBlobInRanges(
+    const client::OlpClient& client, const std::string& layer_id,
+    const model::Partition& partition,
+    porting::optional<std::string> billing_tag, size_t range_count,
+    const client::CancellationContext& context) {
+  const auto data_size = partition.GetDataSize();
+  if (!data_size || *data_size <= 0 || range_count < 2u) {
+    return GetBlob(client, layer_id, partition, std::move(billing_tag),
+                   porting::none, context);
+  }
+
+  std::multimap<std::string, std::string> header_params;
+  header_params.emplace("Accept", "application/json");
+
+  std::multimap<std::string, std::string> query_params;
+  if (billing_tag) {
+    query_params.emplace("billingTag", *billing_tag);
+  }
+
+  const std::string metadata_uri =
+      "/layers/" + layer_id + "/data/" + partition.GetDataHandle();
+
+  const auto retry_condition =
+      client.GetSettings().retry_settings.retry_condition;
+
+  auto download = std::make_shared<RangedDownload>();
+  download->buffer = std::make_shared<std::vector<unsigned char>>(
+      static_cast<size_t>(*data_size));
+
+  const auto blob_size = static_cast<std::uint64_t>(*data_size);
+  const auto range_size = (blob_size + range_count - 1u) / range_count;
+  std::vector<BlobRange> ranges;
+  for (std::uint64_t offset = 0u; offset < blob_size; offset += range_size) {
+    ranges.push_back({offset, std::min(range_size, blob_size - offset), 0});
+  }
+
+  // The ranges are passed as the query parameter, so the concurrent requests
+  // have different URLs and are not merged by the `OlpClient`.
+  auto request_ranges = [&]() {
+    for (auto& range : ranges) {
+      {
+        std::lock_guard<std::mutex> lock(download->mutex);
+        // The result is already known, so the other ranges are of no use.
+        if (download->completed || download->size_mismatch) {
+          break;
+        }
+        ++download->pending;
+      }
+
+      ++range.attempts;
+
+      auto range_query_params = query_params;
+      range_query_params.emplace("range", ToRangeParam(range));
+
+      auto token = client.CallApi(
+          metadata_uri, "GET", range_query_params, header_params, {}, nullptr,
+          "", [=](client::HttpResponse response) {
+            std::vector<client::CancellationToken> tokens;
+            {
+              std::unique_lock<std::mutex> lock(download->mutex);
+              HandleRangeResponse(retry_condition, *download, range, response,
+                                  lock);
+              --download->pending;
+
+              // The server ignored the ranges, so the other requests either
+              // download the whole blob again or are of no use.
+              if (download->completed || download->size_mismatch) {
+                tokens.swap(download->tokens);
+              }
+            }
+
+            for (const auto& token : tokens) {
+              token.Cancel();
+            }
+            download->condition.notify_one();
+          });
+
+      bool finished = false;
+      {
+        std::lock_guard<std::mutex> lock(download->mutex);
+        finished = download->completed || download->size_mismatch;
+        if (!finished) {
+          download->tokens.push_back(token);
+        }
+      }
+
+      if (finished) {
+        token.Cancel();
+        break;
+      }
+    }
+
+    return client::CancellationToken([=]() {
+      std::vector<client::CancellationToken> tokens;
+      {
+        std::lock_guard<std::mutex> lock(download->mutex);
+        tokens.swap(download->tokens);
+        download->cancelled = true;
+      }
+      download->condition.notify_one();
+
+      for (const auto& token : tokens) {
+        token.Cancel();
+      }
+    });
+  };
+
+  auto cancellation_context = context;
+  while (!ranges.empty()) {
+    if (!cancellation_context.ExecuteOrCancelled(request_ranges)) {
+      return client::ApiError::Cancelled();
+    }
+
+    std::unique_lock<std::mutex> lock(download->mutex);
+    {
+      // The pool may start another thread while this one waits.
+      thread::ScopedBlockingRegion blocking_region;
+      download->condition.wait(lock, [&] {
+        return download->pending == 0u || download->cancelled ||
+               download->completed || download->size_mismatch;
+      });
+    }
+
+    if (download->completed || download->size_mismatch) {
+      // The requests of the other ranges are cancelled by the response that
+      // completed the download.
+      DataResponse response{download->buffer, download->statistics};
+      const auto completed = download->completed;
+      lock.unlock();
+
+      if (completed) {
+        return response;
+      }
+
+      return GetBlob(client, layer_id, partition, std::move(billing_tag),
+                     porting::none, context);
+    }
+
+    if (download->cancelled) {
+      return {client::ApiError::Cancelled(), download->statistics};
+    }
+
+    if (download->error) {
+      return {*download->error, download->statistics};
+    }
+
+    ranges = std::move(download->failed_ranges);
+    download->failed_ranges.clear();
+    download->tokens.clear();
+
+    const auto exhausted =
+        std::any_of(ranges.begin(), ranges.end(), [](const BlobRange& range) {
+          return range.attempts >= kMaxRangeAttempts;
+        });
+    if (exhausted) {
+      auto error = download->last_retryable_error
+                       ? *download->last_retryable_error
+                       : client::ApiError::Unknown("Range requests failed");
+      return {std::move(error), download->statistics};
+    }
+  }
+
+  return {download->buffer, download->statistics};
+}
+
 }  // namespace read
 }  // namespace dataservice
 }  // namespace olp
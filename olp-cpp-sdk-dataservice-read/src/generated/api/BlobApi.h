@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -71,6 +71,36 @@ class BlobApi {
                               porting::optional<std::string> billing_tag,
                               porting::optional<std::string> range,
                               const client::CancellationContext& context);
+
+  /**
+   * @brief Retrieves a data blob in several byte ranges that are downloaded
+   * concurrently.
+   *
+   * The ranges are written into one buffer that is allocated upfront for the
+   * size from the partition metadata. The ranges that fail with a network
+   * error or a retryable HTTP status, and the ranges that are received only
+   * partially, are requested again from the first missing byte, up to three
+   * times. If the server reports a blob size that differs from the metadata,
+   * or ignores the ranges, the remaining requests are cancelled. The blob is
+   * then taken from a complete response of the correct size, or downloaded
+   * with `GetBlob`.
+   *
+   * @param client Instance of OlpClient used to make REST request.
+   * @param layer_id Layer id.
+   * @param partition The blob metadata. Must have a positive data size.
+   * @param billing_tag An optional free-form tag which is used for grouping
+   * billing records together.
+   * @param range_count The number of ranges to split the blob into.
+   * @param context A CancellationContext, which can be used to cancel the
+   * pending requests.
+   *
+   * @return Data response.
+   */
+  static DataResponse GetBlobInRanges(
+      const client::OlpClient& client, const std::string& layer_id,
+      const model::Partition& partition,
+      porting::optional<std::string> billing_tag, size_t range_count,
+      const client::CancellationContext& context);
 };
 
 }  // namespace read
@@ -53,8 +53,7 @@ ConfigApi::CatalogResponse ConfigApi::GetCatalog(
     return client::ApiError(response.GetStatus(),
                             response.GetResponseAsString());
   }
-  return parser::parse_result<ConfigApi::CatalogResponse>(
-      response.GetRawResponse());
+  return parser::parse_result<ConfigApi::CatalogResponse>(response);
 }
 
 }  // namespace read
@@ -84,8 +84,7 @@ MetadataApi::LayerVersionsResponse MetadataApi::GetLayerVersions(
                             api_response.GetResponseAsString());
   }
 
-  return parser::parse_result<LayerVersionsResponse>(
-      api_response.GetRawResponse());
+  return parser::parse_result<LayerVersionsResponse>(api_response);
 }
 
 MetadataApi::PartitionsExtendedResponse MetadataApi::GetPartitions(
@@ -130,7 +129,7 @@ MetadataApi::PartitionsExtendedResponse MetadataApi::GetPartitions(
       client::ApiResponse<model::Partitions, client::ApiError>;
 
   auto partitions_response =
-      parser::parse_result<PartitionsResponse>(http_response.GetRawResponse());
+      parser::parse_result<PartitionsResponse>(http_response);
 
   if (!partitions_response.IsSuccessful()) {
     return PartitionsExtendedResponse(partitions_response.GetError(),
@@ -197,8 +196,7 @@ MetadataApi::CatalogVersionResponse MetadataApi::GetLatestCatalogVersion(
     return {{api_response.GetStatus(), api_response.GetResponseAsString()}};
   }
 
-  return parser::parse_result<CatalogVersionResponse>(
-      api_response.GetRawResponse());
+  return parser::parse_result<CatalogVersionResponse>(api_response);
 }
 
 MetadataApi::VersionsResponse MetadataApi::ListVersions(
@@ -223,7 +221,7 @@ MetadataApi::VersionsResponse MetadataApi::ListVersions(
   if (api_response.GetStatus() != http::HttpStatusCode::OK) {
     return {{api_response.GetStatus(), api_response.GetResponseAsString()}};
   }
-  return parser::parse_result<VersionsResponse>(api_response.GetRawResponse());
+  return parser::parse_result<VersionsResponse>(api_response);
 }
 
 MetadataApi::CompatibleVersionsResponse MetadataApi::GetCompatibleVersions(
@@ -250,8 +248,7 @@ MetadataApi::CompatibleVersionsResponse MetadataApi::GetCompatibleVersions(
     return {{api_response.GetStatus(), api_response.GetResponseAsString()}};
   }
 
-  return parser::parse_result<CompatibleVersionsResponse>(
-      api_response.GetRawResponse());
+  return parser::parse_result<CompatibleVersionsResponse>(api_response);
 }
 
 }  // namespace read
@@ -53,7 +53,7 @@ PlatformApi::ApisResponse PlatformApi::GetApis(
     return ApisResponse(
         client::ApiError(response.GetStatus(), response.GetResponseAsString()));
   }
-  return parser::parse_result<ApisResponse>(response.GetRawResponse());
+  return parser::parse_result<ApisResponse>(response);
 }
 }  // namespace read
 }  // namespace dataservice
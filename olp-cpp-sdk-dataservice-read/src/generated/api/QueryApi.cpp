@@ -102,7 +102,7 @@ QueryApi::PartitionsExtendedResponse QueryApi::GetPartitionsbyId(
       client::ApiResponse<model::Partitions, client::ApiError>;
 
   auto partitions_response =
-      parser::parse_result<PartitionsResponse>(http_response.GetRawResponse());
+      parser::parse_result<PartitionsResponse>(http_response);
 
   if (!partitions_response) {
     return {partitions_response.GetError(),
@@ -173,7 +173,7 @@ QueryApi::QuadTreeIndexResponse QueryApi::QuadTreeIndexVolatile(
                             response.GetResponseAsString());
   }
 
-  return parser::parse_result<QuadTreeIndexResponse>(response.GetRawResponse());
+  return parser::parse_result<QuadTreeIndexResponse>(response);
 }
 
 }  // namespace read
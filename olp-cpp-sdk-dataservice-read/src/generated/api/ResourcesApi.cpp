@@ -52,7 +52,7 @@ ResourcesApi::ApisResponse ResourcesApi::GetApis(
         client::ApiError(response.GetStatus(), response.GetResponseAsString()));
   }
 
-  return parser::parse_result<ApisResponse>(response.GetRawResponse());
+  return parser::parse_result<ApisResponse>(response);
 }
 
 }  // namespace read
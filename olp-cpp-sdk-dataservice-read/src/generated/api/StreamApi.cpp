@@ -106,8 +106,7 @@ StreamApi::SubscribeApiResponse StreamApi::Subscribe(
                       metadata_uri.c_str(), http_response.GetStatus());
 
   HandleCorrelationId(http_response.GetHeaders(), x_correlation_id);
-  return parser::parse_result<SubscribeApiResponse>(
-      http_response.GetRawResponse());
+  return parser::parse_result<SubscribeApiResponse>(http_response);
 }
 
 StreamApi::ConsumeDataApiResponse StreamApi::ConsumeData(
@@ -142,8 +141,7 @@ StreamApi::ConsumeDataApiResponse StreamApi::ConsumeData(
                       metadata_uri.c_str(), http_response.GetStatus());
 
   HandleCorrelationId(http_response.GetHeaders(), x_correlation_id);
-  return parser::parse_result<ConsumeDataApiResponse>(
-      http_response.GetRawResponse());
+  return parser::parse_result<ConsumeDataApiResponse>(http_response);
 }
 
 StreamApi::CommitOffsetsApiResponse StreamApi::CommitOffsets(
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -53,9 +53,8 @@ VolatileBlobApi::DataResponse VolatileBlobApi::GetVolatileBlob(
                         api_response.GetNetworkStatistics());
   }
 
-  auto result = std::make_shared<std::vector<unsigned char>>();
-  api_response.GetResponse(*result);
-  return DataResponse(result, api_response.GetNetworkStatistics());
+  return DataResponse(api_response.ReleaseResponseAsBytes(),
+                      api_response.GetNetworkStatistics());
 }
 }  // namespace read
 }  // namespace dataservice
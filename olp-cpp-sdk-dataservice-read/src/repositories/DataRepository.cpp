@@ -40,6 +40,21 @@ namespace {
 constexpr auto kLogTag = "DataRepository";
 constexpr auto kBlobService = "blob";
 constexpr auto kVolatileBlobService = "volatile-blob";
+
+// Blobs bigger than this are downloaded in several ranges concurrently, if
+// enabled in the settings.
+constexpr int64_t kRangedDownloadThreshold = 8 * 1024 * 1024;
+
+bool ShouldDownloadInRanges(const model::Partition& partition,
+                            size_t range_count) {
+  const auto& data_size = partition.GetDataSize();
+  const auto& compressed_data_size = partition.GetCompressedDataSize();
+
+  // The ranges of the compressed blobs are not known upfront.
+  return range_count > 1u && data_size &&
+         *data_size > kRangedDownloadThreshold &&
+         (!compressed_data_size || *compressed_data_size == *data_size);
+}
 }  // namespace
 
 DataRepository::DataRepository(client::HRN catalog,
@@ -208,7 +223,12 @@ BlobApi::DataResponse DataRepository::GetBlobData(
 
   BlobApi::DataResponse storage_response;
 
-  if (service == kBlobService) {
+  if (service == kBlobService &&
+      ShouldDownloadInRanges(partition, settings_.blob_download_ranges)) {
+    storage_response = BlobApi::GetBlobInRanges(
+        storage_api_lookup.GetResult(), layer, partition, billing_tag,
+        settings_.blob_download_ranges, context);
+  } else if (service == kBlobService) {
     storage_response =
         BlobApi::GetBlob(storage_api_lookup.GetResult(), layer, partition,
                          billing_tag, olp::porting::none, context);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include <thread>
 
 #include <olp/core/porting/make_unique.h>
+#include <olp/core/thread/ScopedBlockingRegion.h>
 
 namespace olp {
 namespace dataservice {
@@ -156,6 +157,7 @@ void NamedMutex::lock() {
   is_canceled_.store(!executed);
 
   if (executed) {
+    thread::ScopedBlockingRegion blocking_region;
     std::unique_lock<std::mutex> unique_lock{lock_mutex_};
     lock_condition_.wait(unique_lock,
                          [&] { return is_canceled_ || try_lock(); });
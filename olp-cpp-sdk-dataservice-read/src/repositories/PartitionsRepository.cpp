@@ -575,7 +575,7 @@ QuadTreeIndexResponse PartitionsRepository::GetQuadTreeIndexForTile(
   }
 
   QuadTreeIndex tree(root_tile_key, kAggregateQuadTreeDepth,
-                     quadtree_response.GetRawResponse());
+                     *quadtree_response.ReleaseResponseAsBytes());
   if (tree.IsNull()) {
     OLP_SDK_LOG_WARNING_F(
         kLogTag,
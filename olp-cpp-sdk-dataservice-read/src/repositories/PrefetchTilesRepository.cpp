@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -464,7 +464,7 @@ PrefetchTilesRepository::DownloadVersionedQuadTree(
             quad_tree.GetNetworkStatistics()};
   }
 
-  QuadTreeIndex tree(tile, depth, quad_tree.GetRawResponse());
+  QuadTreeIndex tree(tile, depth, *quad_tree.ReleaseResponseAsBytes());
 
   if (tree.IsNull()) {
     OLP_SDK_LOG_WARNING_F(kLogTag,
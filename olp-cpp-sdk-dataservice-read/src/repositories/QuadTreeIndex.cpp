@@ -91,24 +91,12 @@ bool WriteIndexData(const QuadTreeIndex::IndexData& data,
   success &= writer.Write(data.crc);
   return success;
 }
-}  // namespace
-
-QuadTreeIndex::QuadTreeIndex(const cache::KeyValueCache::ValueTypePtr& data) {
-  if (data == nullptr || data->empty()) {
-    return;
-  }
-  data_ = reinterpret_cast<DataHeader*>(data->data());
-  raw_data_ = data;
-  size_ = data->size();
-}
-
-QuadTreeIndex::QuadTreeIndex(const geo::TileKey& root, int depth,
-                             std::stringstream& json_stream) {
-  boost::json::error_code ec;
-  auto parsed_value = boost::json::parse(json_stream, ec);
 
+bool ParseQuads(const geo::TileKey& root, boost::json::value& parsed_value,
+                std::vector<QuadTreeIndex::IndexData>& parents,
+                std::vector<QuadTreeIndex::IndexData>& subs) {
   if (!parsed_value.is_object()) {
-    return;
+    return false;
   }
 
   auto& top_object = parsed_value.as_object();
@@ -118,12 +106,9 @@ QuadTreeIndex::QuadTreeIndex(const geo::TileKey& root, int depth,
 
   if (parent_quads_value == top_object.end() &&
       sub_quads_value == top_object.end()) {
-    return;
+    return false;
   }
 
-  std::vector<IndexData> subs;
-  std::vector<IndexData> parents;
-
   if (parent_quads_value != top_object.end() &&
       parent_quads_value->value().is_array()) {
     auto& parent_quads = parent_quads_value->value().as_array();
@@ -136,7 +121,7 @@ QuadTreeIndex::QuadTreeIndex(const geo::TileKey& root, int depth,
         continue;
       }
 
-      IndexData data = ParseCommonIndexData(obj);
+      QuadTreeIndex::IndexData data = ParseCommonIndexData(obj);
       data.data_handle = obj[kDataHandleKey].as_string().c_str();
       data.tile_key =
           geo::TileKey::FromHereTile(obj[kPartitionKey].as_string().c_str());
@@ -156,7 +141,7 @@ QuadTreeIndex::QuadTreeIndex(const geo::TileKey& root, int depth,
         continue;
       }
 
-      IndexData data = ParseCommonIndexData(obj);
+      QuadTreeIndex::IndexData data = ParseCommonIndexData(obj);
       data.data_handle = obj[kDataHandleKey].as_string().c_str();
       data.tile_key =
           root.AddedSubHereTile(obj[kSubQuadKeyKey].as_string().c_str());
@@ -164,7 +149,44 @@ QuadTreeIndex::QuadTreeIndex(const geo::TileKey& root, int depth,
     }
   }
 
-  CreateBlob(root, depth, std::move(parents), std::move(subs));
+  return true;
+}
+}  // namespace
+
+QuadTreeIndex::QuadTreeIndex(const cache::KeyValueCache::ValueTypePtr& data) {
+  if (data == nullptr || data->empty()) {
+    return;
+  }
+  data_ = reinterpret_cast<DataHeader*>(data->data());
+  raw_data_ = data;
+  size_ = data->size();
+}
+
+QuadTreeIndex::QuadTreeIndex(const geo::TileKey& root, int depth,
+                             std::stringstream& json_stream) {
+  boost::json::error_code ec;
+  auto parsed_value = boost::json::parse(json_stream, ec);
+
+  std::vector<IndexData> parents;
+  std::vector<IndexData> subs;
+  if (ParseQuads(root, parsed_value, parents, subs)) {
+    CreateBlob(root, depth, std::move(parents), std::move(subs));
+  }
+}
+
+QuadTreeIndex::QuadTreeIndex(const geo::TileKey& root, int depth,
+                             const cache::KeyValueCache::ValueType& json) {
+  boost::json::error_code ec;
+  auto parsed_value = boost::json::parse(
+      boost::json::string_view(reinterpret_cast<const char*>(json.data()),
+                               json.size()),
+      ec);
+
+  std::vector<IndexData> parents;
+  std::vector<IndexData> subs;
+  if (ParseQuads(root, parsed_value, parents, subs)) {
+    CreateBlob(root, depth, std::move(parents), std::move(subs));
+  }
 }
 
 bool QuadTreeIndex::ReadIndexData(IndexData& data, const uint32_t offset,
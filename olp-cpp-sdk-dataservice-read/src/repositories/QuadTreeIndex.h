@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -63,6 +63,8 @@ class QuadTreeIndex {
   explicit QuadTreeIndex(const cache::KeyValueCache::ValueTypePtr& data);
   QuadTreeIndex(const geo::TileKey& root, int depth,
                 std::stringstream& json_stream);
+  QuadTreeIndex(const geo::TileKey& root, int depth,
+                const cache::KeyValueCache::ValueType& json);
 
   QuadTreeIndex(const QuadTreeIndex& other) = delete;
   QuadTreeIndex(QuadTreeIndex&& other) noexcept = default;
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <gmock/gmock.h>
+#include <mocks/NetworkMock.h>
+#include <olp/core/client/OlpClient.h>
+#include <olp/core/client/OlpClientFactory.h>
+#include <olp/core/http/HttpStatusCode.h>
+#include "generated/api/BlobApi.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr auto kNodeBaseUrl =
+    "https://some.node.base.url/blobstore/v1/catalogs/"
+    "hrn:here:data::olp-here-test:hereos-internal-test-v2";
+constexpr auto kLayerId = "testlayer";
+constexpr auto kDataHandle = "4eed6ed1-0d32-43b9-ae79-043cb4256432";
+constexpr auto kBlob = "0123456789ABCDEFGHIJ";
+
+using ::testing::_;
+namespace http = olp::http;
+namespace client = olp::client;
+
+class BlobApiTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    network_mock_ = std::make_shared<NetworkMock>();
+
+    settings_ = std::make_shared<client::OlpClientSettings>();
+    settings_->network_request_handler = network_mock_;
+
+    client_ = client::OlpClientFactory::Create(*settings_);
+    client_->SetBaseUrl(kNodeBaseUrl);
+
+    partition_.SetDataHandle(kDataHandle);
+    partition_.SetDataSize(static_cast<int64_t>(blob_.size()));
+  }
+
+  void TearDown() override { network_mock_.reset(); }
+
+  /// Serves the byte ranges of the blob, the ranges are truncated to the
+  /// `max_length` bytes.
+  NetworkCallback ServeRanges(
+      size_t max_length = std::numeric_limits<size_t>::max()) {
+    return [=](http::NetworkRequest request, http::Network::Payload payload,
+               http::Network::Callback callback,
+               http::Network::HeaderCallback header_callback,
+               http::Network::DataCallback data_callback) {
+      const auto& url = request.GetUrl();
+      const auto id = static_cast<http::RequestId>(++requests_);
+
+      // The range is passed as a query parameter, which might be encoded.
+      auto range = url.find("bytes%3D");
+      range = range != std::string::npos ? range + 8u : url.find("bytes=");
+      if (range == std::string::npos) {
+        return ReturnHttpResponse(GetResponse(http::HttpStatusCode::OK),
+                                  blob_, {}, std::chrono::milliseconds(1),
+                                  id)(request, payload, callback,
+                                      header_callback, data_callback);
+      }
+
+      char* end = nullptr;
+      const auto first = std::strtoull(
+          url.c_str() + (url[range] == 'b' ? range + 6u : range), &end, 10);
+      const auto last = std::strtoull(end + 1, nullptr, 10);
+      const auto length =
+          std::min<size_t>(static_cast<size_t>(last - first + 1), max_length);
+      ranges_.push_back(first);
+
+      const http::Headers headers = {
+          {"Content-Range", "bytes " + std::to_string(first) + "-" +
+                                std::to_string(first + length - 1) + "/" +
+                                std::to_string(blob_.size())}};
+      return ReturnHttpResponse(
+          GetResponse(http::HttpStatusCode::PARTIAL_CONTENT),
+          blob_.substr(first, length), headers, std::chrono::milliseconds(1),
+          id)(request, payload, callback, header_callback, data_callback);
+    };
+  }
+
+  std::string GetData(const olp::dataservice::read::BlobApi::DataResponse&
+                          response) const {
+    const auto& data = response.GetResult();
+    return std::string(data->begin(), data->end());
+  }
+
+  std::shared_ptr<client::OlpClientSettings> settings_;
+  std::shared_ptr<client::OlpClient> client_;
+  std::shared_ptr<NetworkMock> network_mock_;
+  olp::dataservice::read::model::Partition partition_;
+  const std::string blob_ = kBlob;
+  std::atomic<int> requests_{0};
+  std::vector<uint64_t> ranges_;
+};
+
+TEST_F(BlobApiTest, GetBlobInRanges) {
+  EXPECT_CALL(*network_mock_, Send(_, _, _, _, _))
+      .Times(3)
+      .WillRepeatedly(ServeRanges());
+
+  const auto response = olp::dataservice::read::BlobApi::GetBlobInRanges(
+      *client_, kLayerId, partition_, olp::porting::none, 3u,
+      client::CancellationContext{});
+
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(GetData(response), blob_);
+  EXPECT_THAT(ranges_, testing::UnorderedElementsAre(0u, 7u, 14u));
+}
+
+TEST_F(BlobApiTest, GetBlobInRangesResumesPartialRanges) {
+  // Each response has at most 6 bytes, so the 10 bytes ranges are resumed.
+  EXPECT_CALL(*network_mock_, Send(_, _, _, _, _))
+      .Times(4)
+      .WillRepeatedly(ServeRanges(6u));
+
+  const auto response = olp::dataservice::read::BlobApi::GetBlobInRanges(
+      *client_, kLayerId, partition_, olp::porting::none, 2u,
+      client::CancellationContext{});
+
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(GetData(response), blob_);
+  EXPECT_THAT(ranges_, testing::UnorderedElementsAre(0u, 6u, 10u, 16u));
+}
+
+TEST_F(BlobApiTest, GetBlobInRangesFailsOnEmptyRanges) {
+  // The ranges have no content, so each of them fails after three attempts.
+  EXPECT_CALL(*network_mock_, Send(_, _, _, _, _))
+      .Times(6)
+      .WillRepeatedly(ServeRanges(0u));
+
+  const auto response = olp::dataservice::read::BlobApi::GetBlobInRanges(
+      *client_, kLayerId, partition_, olp::porting::none, 2u,
+      client::CancellationContext{});
+
+  ASSERT_FALSE(response.IsSuccessful());
+  EXPECT_EQ(response.GetError().GetHttpStatusCode(),
+            http::HttpStatusCode::PARTIAL_CONTENT);
+}
+
+TEST_F(BlobApiTest, GetBlobInRangesFallsBackOnSizeMismatch) {
+  // The metadata size is wrong, so the blob is downloaded as a whole.
+  partition_.SetDataSize(static_cast<int64_t>(blob_.size() - 1u));
+
+  EXPECT_CALL(*network_mock_, Send(_, _, _, _, _))
+      .Times(3)
+      .WillRepeatedly(ServeRanges());
+
+  const auto response = olp::dataservice::read::BlobApi::GetBlobInRanges(
+      *client_, kLayerId, partition_, olp::porting::none, 2u,
+      client::CancellationContext{});
+
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(GetData(response), blob_);
+}
+
+TEST_F(BlobApiTest, GetBlobInRangesCancelsWhenRangesIgnored) {
+  std::mutex mutex;
+  std::map<http::RequestId, http::Network::Callback> callbacks;
+
+  // The first request gets the whole blob, the others hang until cancelled.
+  EXPECT_CALL(*network_mock_, Send(_, _, _, _, _))
+      .WillOnce(ReturnHttpResponse(GetResponse(http::HttpStatusCode::OK),
+                                   blob_, {}, std::chrono::milliseconds(1),
+                                   1))
+      .WillRepeatedly([&](http::NetworkRequest /*request*/,
+                          http::Network::Payload /*payload*/,
+                          http::Network::Callback callback,
+                          http::Network::HeaderCallback /*header_callback*/,
+                          http::Network::DataCallback /*data_callback*/) {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto id = static_cast<http::RequestId>(callbacks.size() + 2u);
+        callbacks[id] = std::move(callback);
+        return http::SendOutcome(id);
+      });
+
+  EXPECT_CALL(*network_mock_, Cancel(_))
+      .WillRepeatedly([&](http::RequestId id) {
+        http::Network::Callback callback;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          auto it = callbacks.find(id);
+          if (it == callbacks.end()) {
+            return;
+          }
+          callback = std::move(it->second);
+          callbacks.erase(it);
+        }
+        // The network reports the cancellation asynchronously.
+        std::thread([=]() {
+          callback(http::NetworkResponse().WithRequestId(id).WithStatus(
+              static_cast<int>(http::ErrorCode::CANCELLED_ERROR)));
+        }).detach();
+      });
+
+  const auto response = olp::dataservice::read::BlobApi::GetBlobInRanges(
+      *client_, kLayerId, partition_, olp::porting::none, 3u,
+      client::CancellationContext{});
+
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(GetData(response), blob_);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_TRUE(callbacks.empty());
+}
+
+}  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 HERE Europe B.V.
+ * Copyright (C) 2020-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
  */
 
 #include <sstream>
+#include <string>
 
 #include <gmock/gmock.h>
 #include <matchers/NetworkUrlMatchers.h>
@@ -184,6 +185,28 @@ const char* quad_tree_index_dump =
 
 const auto quad_tree_index_dump_len = 607;
 
+TEST(QuadTreeIndexTest, ParseBytes) {
+  const std::string json = HTTP_RESPONSE_QUADKEYS;
+  const olp::cache::KeyValueCache::ValueType bytes(json.begin(), json.end());
+
+  auto tile_key = olp::geo::TileKey::FromHereTile("381");
+  read::QuadTreeIndex index(tile_key, 1, bytes);
+
+  auto stream = std::stringstream(HTTP_RESPONSE_QUADKEYS);
+  read::QuadTreeIndex stream_index(tile_key, 1, stream);
+
+  ASSERT_FALSE(index.IsNull());
+  ASSERT_FALSE(stream_index.IsNull());
+  EXPECT_EQ(*index.GetRawData(), *stream_index.GetRawData());
+
+  const std::string malformed = HTTP_RESPONSE_MAILFORMED;
+  read::QuadTreeIndex malformed_index(
+      tile_key, 1,
+      olp::cache::KeyValueCache::ValueType(malformed.begin(),
+                                           malformed.end()));
+  EXPECT_TRUE(malformed_index.IsNull());
+}
+
 TEST(QuadTreeIndexTest, BackwardsCompatibility) {
   auto tile_key = olp::geo::TileKey::FromHereTile("381");
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,8 @@
  * License-Filename: LICENSE
  */
 
+#include <algorithm>
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -817,6 +819,102 @@ TEST(VersionedLayerClientTest, PrefetchPartitionsSplitted) {
   Mock::VerifyAndClearExpectations(network_mock.get());
 }
 
+TEST(VersionedLayerClientTest, PrefetchPartitionsWithConcurrencyLimiter) {
+  std::shared_ptr<NetworkMock> network_mock = std::make_shared<NetworkMock>();
+  olp::client::OlpClientSettings settings;
+  settings.network_request_handler = network_mock;
+  settings.task_scheduler =
+      olp::client::OlpClientSettingsFactory::CreateDefaultTaskScheduler(4);
+  const auto version = 4u;
+  const auto partitions_count = 10u;
+
+  std::vector<std::string> partitions;
+  for (auto i = 0u; i < partitions_count; i++) {
+    partitions.emplace_back(std::to_string(i));
+  }
+
+  olp::client::AdaptiveConcurrencySettings limiter_settings;
+  limiter_settings.initial_limit = 1u;
+  limiter_settings.max_limit = 1u;
+  auto limiter = std::make_shared<olp::client::AdaptiveConcurrencyLimiter>(
+      limiter_settings);
+
+  read::VersionedLayerClientImpl client(kHrn, kLayerId, olp::porting::none,
+                                        settings);
+
+  auto apis = ApiDefaultResponses::GenerateResourceApisResponse(kCatalog);
+  PlatformUrlsGenerator generator(apis, kLayerId);
+  auto partitions_response =
+      ReadDefaultResponses::GeneratePartitionsResponse(partitions_count);
+
+  EXPECT_CALL(*network_mock, Send(IsGetRequest(kUrlLookup), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(
+          olp::http::NetworkResponse().WithStatus(
+              olp::http::HttpStatusCode::OK),
+          ResponseGenerator::ResourceApis(apis)));
+  EXPECT_CALL(*network_mock,
+              Send(IsGetRequest(generator.LatestVersion()), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(
+          olp::http::NetworkResponse().WithStatus(
+              olp::http::HttpStatusCode::OK),
+          olp::serializer::serialize(
+              ReadDefaultResponses::GenerateVersionResponse(version))));
+  EXPECT_CALL(*network_mock,
+              Send(IsGetRequest(generator.PartitionsQuery(partitions, version)),
+                   _, _, _, _))
+      .WillOnce(ReturnHttpResponse(
+          olp::http::NetworkResponse().WithStatus(
+              olp::http::HttpStatusCode::OK),
+          olp::serializer::serialize(partitions_response)));
+
+  std::atomic<size_t> downloads_in_flight{0u};
+  std::atomic<size_t> max_downloads_in_flight{0u};
+
+  for (const auto& partition : partitions_response.GetPartitions()) {
+    auto respond = ReturnHttpResponse(
+        olp::http::NetworkResponse().WithStatus(olp::http::HttpStatusCode::OK),
+        "data");
+    const auto blob_path = generator.DataBlob(partition.GetDataHandle());
+    EXPECT_CALL(*network_mock, Send(IsGetRequest(blob_path), _, _, _, _))
+        .WillOnce([&, respond](
+                      olp::http::NetworkRequest request,
+                      olp::http::Network::Payload payload,
+                      olp::http::Network::Callback callback,
+                      olp::http::Network::HeaderCallback header_callback,
+                      olp::http::Network::DataCallback data_callback) {
+          const auto in_flight = ++downloads_in_flight;
+          auto max_in_flight = max_downloads_in_flight.load();
+          while (in_flight > max_in_flight &&
+                 !max_downloads_in_flight.compare_exchange_weak(max_in_flight,
+                                                                in_flight)) {
+          }
+          return respond(
+              std::move(request), std::move(payload),
+              [&, callback](olp::http::NetworkResponse response) {
+                --downloads_in_flight;
+                callback(std::move(response));
+              },
+              std::move(header_callback), std::move(data_callback));
+        });
+  }
+
+  auto future = client
+                    .PrefetchPartitions(read::PrefetchPartitionsRequest()
+                                            .WithPartitionIds(partitions)
+                                            .WithConcurrencyLimiter(limiter),
+                                        nullptr)
+                    .GetFuture();
+  ASSERT_EQ(future.wait_for(kTimeout), std::future_status::ready);
+
+  auto response = future.get();
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(response.GetResult().GetPartitions().size(), partitions_count);
+
+  // The scheduler has four threads, but the downloads run one by one.
+  EXPECT_EQ(max_downloads_in_flight.load(), 1u);
+  Mock::VerifyAndClearExpectations(network_mock.get());
+}
+
 TEST(VersionedLayerClientTest, PrefetchPartitionsSomeFail) {
   std::shared_ptr<NetworkMock> network_mock = std::make_shared<NetworkMock>();
   olp::client::OlpClientSettings settings;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -122,6 +122,9 @@ class DATASERVICE_WRITE_API StreamLayerClient {
   /**
    * @brief Enqueues `PublishDataRequest` that is sent over the wire.
    *
+   * The queued data is stored in the cache, so the request must hold its
+   * data in memory. Requests with a data stream are rejected.
+   *
    * @param request The `PublishDataRequest` object.
    *
    * @return An optional boost that is `olp::porting::none` if the queue call is
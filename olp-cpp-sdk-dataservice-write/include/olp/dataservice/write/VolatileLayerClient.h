@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -105,6 +105,9 @@ class DATASERVICE_WRITE_API VolatileLayerClient {
    * @note The content-type for this request is set implicitly based on
    * the layer metadata of the target layer.
    *
+   * The data must be held in memory. Requests with a data stream fail with
+   * the `InvalidArgument` error.
+   *
    * @param request The `PublishPartitionDataRequest` object.
    *
    * @return `CancellableFuture` that contains `PublishPartitionDataResponse`.
@@ -118,6 +121,9 @@ class DATASERVICE_WRITE_API VolatileLayerClient {
    * @note The content-type for this request is set implicitly based on
    * the layer metadata of the target layer.
    *
+   * The data must be held in memory. Requests with a data stream fail with
+   * the `InvalidArgument` error.
+   *
    * @param request The `PublishPartitionDataRequest` object.
    * @param callback `PublishPartitionDataCallback` that is called with
    * `PublishPartitionDataResponse` when the operation completes.
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <istream>
 #include <memory>
 #include <string>
 #include <utility>
@@ -72,6 +74,44 @@ class DATASERVICE_WRITE_API PublishDataRequest {
     return *this;
   }
 
+  /**
+   * @brief Gets the stream that provides the data to be published.
+   *
+   * @return The data stream or `nullptr` if the data is not streamed.
+   */
+  inline const std::shared_ptr<std::istream>& GetDataStream() const {
+    return data_stream_;
+  }
+
+  /**
+   * @brief Gets the number of bytes to be published from the data stream.
+   *
+   * @return The size of the streamed data.
+   */
+  inline std::uint64_t GetDataStreamSize() const { return data_stream_size_; }
+
+  /**
+   * @brief Sets the stream that provides the data to be published.
+   *
+   * The data is read from the stream while it is uploaded, so it does not
+   * have to fit in memory. The stream is read from its current position and
+   * must not be accessed until the request is completed.
+   *
+   * Takes precedence over the data set with `WithData`.
+   *
+   * Only `StreamLayerClient::PublishData` accepts streamed data.
+   * `StreamLayerClient::Queue` returns an error for it.
+   *
+   * @param stream The stream that provides the data.
+   * @param size The number of bytes to be published from the stream.
+   */
+  inline PublishDataRequest& WithDataStream(
+      std::shared_ptr<std::istream> stream, std::uint64_t size) {
+    data_stream_ = std::move(stream);
+    data_stream_size_ = size;
+    return *this;
+  }
+
   /**
    * @brief Gets the layer ID of the catalog where you want to store the data.
    *
@@ -225,6 +265,10 @@ class DATASERVICE_WRITE_API PublishDataRequest {
  private:
   std::shared_ptr<std::vector<unsigned char>> data_;
 
+  std::shared_ptr<std::istream> data_stream_;
+
+  std::uint64_t data_stream_size_{0u};
+
   std::string layer_id_;
 
   porting::optional<std::string> trace_id_;
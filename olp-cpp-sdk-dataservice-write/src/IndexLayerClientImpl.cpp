@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -51,7 +51,7 @@ IndexLayerClientImpl::IndexLayerClientImpl(client::HRN catalog,
                                            client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
       catalog_settings_(catalog_, settings),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       apiclient_config_(nullptr),
       apiclient_blob_(nullptr),
       apiclient_index_(nullptr),
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -57,13 +57,33 @@ namespace write {
 namespace {
 constexpr auto kLogTag = "StreamLayerClientImpl";
 constexpr int64_t kTwentyMib = 20971520;  // 20 MiB
+
+std::uint64_t GetDataSize(const model::PublishDataRequest& request) {
+  if (request.GetDataStream()) {
+    return request.GetDataStreamSize();
+  }
+  return request.GetData()->size();
+}
+
+std::shared_ptr<std::vector<unsigned char>> ReadDataStream(
+    const model::PublishDataRequest& request) {
+  auto data = std::make_shared<std::vector<unsigned char>>(
+      static_cast<size_t>(request.GetDataStreamSize()));
+  auto& stream = *request.GetDataStream();
+  stream.read(reinterpret_cast<char*>(data->data()),
+              static_cast<std::streamsize>(data->size()));
+  if (static_cast<size_t>(stream.gcount()) != data->size()) {
+    return nullptr;
+  }
+  return data;
+}
 }  // namespace
 
 StreamLayerClientImpl::StreamLayerClientImpl(
     client::HRN catalog, StreamLayerClientSettings client_settings,
     client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       catalog_settings_(catalog_, settings_),
       cache_(settings_.cache),
       cache_mutex_(),
@@ -108,6 +128,11 @@ porting::optional<std::string> StreamLayerClientImpl::Queue(
         "No cache provided to StreamLayerClient");
   }
 
+  if (request.GetDataStream()) {
+    return olp::porting::make_optional<std::string>(
+        "Streamed data cannot be queued");
+  }
+
   if (!request.GetData()) {
     return olp::porting::make_optional<std::string>(
         "PublishDataRequest does not contain any Data");
@@ -276,7 +301,7 @@ StreamLayerClientImpl::PublishData(model::PublishDataRequest request) {
 
 client::CancellationToken StreamLayerClientImpl::PublishData(
     model::PublishDataRequest request, PublishDataCallback callback) {
-  if (!request.GetData()) {
+  if (!request.GetData() && !request.GetDataStream()) {
     callback(PublishDataResponse(client::ApiError(
         client::ErrorCode::InvalidArgument, "Request's data is null.")));
     return client::CancellationToken();
@@ -300,8 +325,20 @@ client::CancellationToken StreamLayerClientImpl::PublishData(
 
 PublishDataResponse StreamLayerClientImpl::PublishDataTask(
     model::PublishDataRequest request, client::CancellationContext context) {
-  const int64_t data_size = request.GetData()->size() * sizeof(unsigned char);
-  if (data_size <= kTwentyMib) {
+  const auto data_size = GetDataSize(request);
+  if (data_size <= static_cast<std::uint64_t>(kTwentyMib)) {
+    if (request.GetDataStream()) {
+      // The ingest API sends the data from memory, which is affordable for
+      // the small payloads.
+      auto data = ReadDataStream(request);
+      if (!data) {
+        return PublishDataResponse(
+            client::ApiError(client::ErrorCode::InvalidArgument,
+                             "Unable to read the data from the stream"));
+      }
+      request.WithData(std::move(data)).WithDataStream(nullptr, 0u);
+    }
+
     return PublishDataLessThanTwentyMib(std::move(request), std::move(context));
   } else {
     return PublishDataGreaterThanTwentyMib(std::move(request),
@@ -362,7 +399,7 @@ PublishDataResponse StreamLayerClientImpl::PublishDataGreaterThanTwentyMib(
     model::PublishDataRequest request, client::CancellationContext context) {
   OLP_SDK_LOG_TRACE_F(kLogTag,
                       "Started publishing data greater than 20MB, size=%zu B",
-                      request.GetData()->size());
+                      static_cast<size_t>(GetDataSize(request)));
 
   auto layer_settings_result = catalog_settings_.GetLayerSettings(
       context, request.GetBillingTag(), request.GetLayerId());
@@ -416,10 +453,19 @@ PublishDataResponse StreamLayerClientImpl::PublishDataGreaterThanTwentyMib(
 
   // 2. Put blob API:
   const auto data_handle = GenerateUuid();
-  auto put_blob_response = BlobApi::PutBlob(
-      blob_client, request.GetLayerId(), layer_settings.content_type,
-      layer_settings.content_encoding, data_handle, request.GetData(),
-      request.GetBillingTag(), context);
+  auto put_blob_response =
+      request.GetDataStream()
+          ? BlobApi::PutBlob(blob_client, request.GetLayerId(),
+                             layer_settings.content_type,
+                             layer_settings.content_encoding, data_handle,
+                             request.GetDataStream(),
+                             request.GetDataStreamSize(),
+                             request.GetBillingTag(), context)
+          : BlobApi::PutBlob(blob_client, request.GetLayerId(),
+                             layer_settings.content_type,
+                             layer_settings.content_encoding, data_handle,
+                             request.GetData(), request.GetBillingTag(),
+                             context);
   if (!put_blob_response.IsSuccessful()) {
     return PublishDataResponse(put_blob_response.GetError());
   }
@@ -454,7 +500,7 @@ PublishDataResponse StreamLayerClientImpl::PublishDataGreaterThanTwentyMib(
   OLP_SDK_LOG_TRACE_F(
       kLogTag,
       "Successfully published data greater than 20 MB, size=%zu B, trace_id=%s",
-      request.GetData()->size(), partition_id.c_str());
+      static_cast<size_t>(GetDataSize(request)), partition_id.c_str());
   return PublishDataResponse(response_ok_single);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -48,7 +48,7 @@ namespace write {
 VersionedLayerClientImpl::VersionedLayerClientImpl(
     client::HRN catalog, client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       catalog_settings_(catalog_, settings_),
       apiclient_blob_(nullptr),
       apiclient_config_(nullptr),
@@ -476,10 +476,11 @@ olp::client::CancellationToken VersionedLayerClientImpl::PublishToBatch(
       return {{client::ErrorCode::InvalidArgument, errmsg.str()}};
     }
 
-    auto upload_blob_response =
-        UploadBlob(partition, data_handle, layer_settings.content_type,
-                   layer_settings.content_encoding, layer_id,
-                   request.GetBillingTag(), context);
+    auto upload_blob_response = UploadBlob(
+        partition, request.GetDataStream(), request.GetDataStreamSize(),
+        data_handle, layer_settings.content_type,
+        layer_settings.content_encoding, layer_id, request.GetBillingTag(),
+        context);
     if (!upload_blob_response.IsSuccessful()) {
       return upload_blob_response.GetError();
     }
@@ -522,7 +523,9 @@ UploadPartitionResponse VersionedLayerClientImpl::UploadPartition(
 }
 
 UploadBlobResponse VersionedLayerClientImpl::UploadBlob(
-    const model::PublishPartition& partition, const std::string& data_handle,
+    const model::PublishPartition& partition,
+    const std::shared_ptr<std::istream>& data_stream, std::uint64_t data_size,
+    const std::string& data_handle,
     const std::string& content_type, const std::string& content_encoding,
     const std::string& layer_id, BillingTag billing_tag,
     client::CancellationContext context) {
@@ -533,6 +536,12 @@ UploadBlobResponse VersionedLayerClientImpl::UploadBlob(
   }
 
   auto blob_client = olp_client_response.MoveResult();
+  if (data_stream) {
+    return BlobApi::PutBlob(blob_client, layer_id, content_type,
+                            content_encoding, data_handle, data_stream,
+                            data_size, billing_tag, context);
+  }
+
   return BlobApi::PutBlob(blob_client, layer_id, content_type, content_encoding,
                           data_handle, partition.GetData(), billing_tag,
                           context);
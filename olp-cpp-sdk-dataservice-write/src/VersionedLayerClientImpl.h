@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,6 +31,7 @@
 #include "generated/model/Catalog.h"
 
 #include <condition_variable>
+#include <istream>
 #include <memory>
 #include <mutex>
 
@@ -115,13 +116,12 @@ class VersionedLayerClientImpl
       std::shared_ptr<client::CancellationContext> cancel_context,
       InitApiClientsCallback callback);
 
-  UploadBlobResponse UploadBlob(const model::PublishPartition& partition,
-                                const std::string& data_handle,
-                                const std::string& content_type,
-                                const std::string& content_encoding,
-                                const std::string& layer_id,
-                                BillingTag billing_tag,
-                                client::CancellationContext context);
+  UploadBlobResponse UploadBlob(
+      const model::PublishPartition& partition,
+      const std::shared_ptr<std::istream>& data_stream, std::uint64_t data_size,
+      const std::string& data_handle, const std::string& content_type,
+      const std::string& content_encoding, const std::string& layer_id,
+      BillingTag billing_tag, client::CancellationContext context);
 
   UploadPartitionResponse UploadPartition(
       const std::string& publication_id,
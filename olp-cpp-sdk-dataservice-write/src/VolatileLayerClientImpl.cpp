@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -47,7 +47,7 @@ namespace write {
 VolatileLayerClientImpl::VolatileLayerClientImpl(
     client::HRN catalog, client::OlpClientSettings settings)
     : catalog_(std::move(catalog)),
-      settings_(std::move(settings)),
+      settings_(client::ApplySchedulingGroup(std::move(settings))),
       catalog_settings_(catalog_, settings_),
       pending_requests_(std::make_shared<client::PendingRequests>()),
       task_scheduler_(settings_.task_scheduler) {}
@@ -317,6 +317,14 @@ VolatileLayerClientImpl::PublishPartitionData(
 client::CancellationToken VolatileLayerClientImpl::PublishPartitionData(
     const model::PublishPartitionDataRequest& request,
     PublishPartitionDataCallback callback) {
+  if (request.GetDataStream()) {
+    callback(PublishPartitionDataResponse(
+        client::ApiError(client::ErrorCode::InvalidArgument,
+                         "Streamed data is not supported for volatile "
+                         "layers.")));
+    return client::CancellationToken();
+  }
+
   if (!request.GetData() || !request.GetPartitionId()) {
     callback(PublishPartitionDataResponse(
         client::ApiError(client::ErrorCode::InvalidArgument,
@@ -550,7 +558,7 @@ client::CancellationToken VolatileLayerClientImpl::PublishToBatch(
       return {};
     }
 
-    if (partition.GetData()) {
+    if (partition.GetData() || partition.GetDataStream()) {
       callback(client::ApiError(
           client::ErrorCode::InvalidArgument,
           "PublishPartitionDataRequest contains data. This request is for "
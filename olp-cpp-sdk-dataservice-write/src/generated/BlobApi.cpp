@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -113,6 +113,42 @@ PutBlobResponse BlobApi::PutBlob(
   return PutBlobResponse(client::ApiNoResult());
 }
 
+PutBlobResponse BlobApi::PutBlob(
+    const client::OlpClient& client, const std::string& layer_id,
+    const std::string& content_type, const std::string& content_encoding,
+    const std::string& data_handle,
+    const std::shared_ptr<std::istream>& data_stream, std::uint64_t data_size,
+    const porting::optional<std::string>& billing_tag,
+    client::CancellationContext cancel_context) {
+  std::multimap<std::string, std::string> header_params;
+  std::multimap<std::string, std::string> query_params;
+
+  header_params.insert(std::make_pair("Accept", "application/json"));
+
+  if (!content_encoding.empty()) {
+    header_params.insert(std::make_pair("Content-Encoding", content_encoding));
+  }
+
+  if (billing_tag) {
+    query_params.insert(std::make_pair(kQueryParamBillingTag, *billing_tag));
+  }
+
+  std::string put_blob_uri = "/layers/" + layer_id + "/data/" + data_handle;
+
+  auto http_response = client.CallApiWithBodyStream(
+      std::move(put_blob_uri), "PUT", std::move(query_params),
+      std::move(header_params), data_stream, data_size, content_type,
+      cancel_context);
+
+  if (http_response.GetStatus() != olp::http::HttpStatusCode::OK &&
+      http_response.GetStatus() != olp::http::HttpStatusCode::NO_CONTENT) {
+    return PutBlobResponse(client::ApiError(
+        http_response.GetStatus(), http_response.GetResponseAsString()));
+  }
+
+  return PutBlobResponse(client::ApiNoResult());
+}
+
 client::CancellationToken BlobApi::deleteBlob(
     const client::OlpClient& client, const std::string& layer_id,
     const std::string& data_handle,
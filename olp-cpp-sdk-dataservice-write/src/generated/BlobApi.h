@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <istream>
 #include <memory>
 #include <string>
 
@@ -98,6 +100,21 @@ class BlobApi {
       const porting::optional<std::string>& billing_tag,
       client::CancellationContext cancel_contex);
 
+  /**
+   * @brief Synchronous version of \c PutBlob method that reads the content
+   * from the stream while it is uploaded.
+   *
+   * @param data_stream The stream that provides the content to be uploaded.
+   * @param data_size The number of bytes to read from the stream.
+   */
+  static PutBlobResponse PutBlob(
+      const client::OlpClient& client, const std::string& layer_id,
+      const std::string& content_type, const std::string& content_encoding,
+      const std::string& data_handle,
+      const std::shared_ptr<std::istream>& data_stream, std::uint64_t data_size,
+      const porting::optional<std::string>& billing_tag,
+      client::CancellationContext cancel_context);
+
   /**
    * @brief Delete a data blob
    * Deletes a data blob from the underlying storage mechanism (volume). When
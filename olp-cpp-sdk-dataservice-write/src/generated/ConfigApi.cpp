@@ -58,7 +58,7 @@ client::CancellationToken ConfigApi::GetCatalog(
               response.GetStatus(), response.GetResponseAsString())));
         } else {
           catalogCallback(
-              parser::parse_result<CatalogResponse>(response.GetRawResponse()));
+              parser::parse_result<CatalogResponse>(response));
         }
       };
 
@@ -85,7 +85,7 @@ CatalogResponse ConfigApi::GetCatalog(
     return client::ApiError(response.GetStatus(),
                             response.GetResponseAsString());
   }
-  return parser::parse_result<CatalogResponse>(response.GetRawResponse());
+  return parser::parse_result<CatalogResponse>(response);
 }
 
 }  // namespace write
@@ -85,8 +85,7 @@ client::CancellationToken IngestApi::IngestData(
           return;
         }
 
-        callback(parser::parse_result<IngestDataResponse>(
-            http_response.GetRawResponse()));
+        callback(parser::parse_result<IngestDataResponse>(http_response));
       });
 
   return cancel_token;
@@ -136,8 +135,7 @@ IngestDataResponse IngestApi::IngestData(
         http_response.GetStatus(), http_response.GetResponseAsString())};
   }
 
-  return parser::parse_result<IngestDataResponse>(
-      http_response.GetRawResponse());
+  return parser::parse_result<IngestDataResponse>(http_response);
 }
 
 IngestSdiiResponse IngestApi::IngestSdii(
@@ -172,7 +170,7 @@ IngestSdiiResponse IngestApi::IngestSdii(
     return IngestSdiiResponse(
         client::ApiError(response.GetStatus(), response.GetResponseAsString()));
   }
-  return parser::parse_result<IngestSdiiResponse>(response.GetRawResponse());
+  return parser::parse_result<IngestSdiiResponse>(response);
 }
 
 }  // namespace write
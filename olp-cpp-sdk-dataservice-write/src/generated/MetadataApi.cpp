@@ -79,7 +79,7 @@ client::CancellationToken MetadataApi::GetLayerVersions(
               response.GetStatus(), response.GetResponseAsString()));
         } else {
           layerVersionsCallback(parser::parse_result<LayerVersionsResponse>(
-              response.GetRawResponse()));
+              response));
         }
       };
 
@@ -123,7 +123,7 @@ client::CancellationToken MetadataApi::GetPartitions(
                                           response.GetResponseAsString()));
     } else {
       partitionsCallback(
-          parser::parse_result<PartitionsResponse>(response.GetRawResponse()));
+          parser::parse_result<PartitionsResponse>(response));
     }
   };
 
@@ -156,7 +156,7 @@ client::CancellationToken MetadataApi::GetLatestCatalogVersion(
               response.GetStatus(), response.GetResponseAsString()));
         } else {
           catalogVersionCallback(parser::parse_result<CatalogVersionResponse>(
-              response.GetRawResponse()));
+              response));
         }
       };
 
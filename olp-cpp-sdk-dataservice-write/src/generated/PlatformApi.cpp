@@ -52,7 +52,7 @@ client::CancellationToken PlatformApi::GetApis(
         } else {
           // parse the services
           // TODO catch any exception and return as Error
-          callback(parser::parse_result<ApisResponse>(response.GetRawResponse()));
+          callback(parser::parse_result<ApisResponse>(response));
         }
       };
 
@@ -80,7 +80,7 @@ PlatformApi::ApisResponse PlatformApi::GetApis(
     return client::ApiError(http_response.GetStatus(), http_response.GetResponseAsString());
   }
 
-  return parser::parse_result<ApisResponse>(http_response.GetRawResponse());
+  return parser::parse_result<ApisResponse>(http_response);
 }
 
 }  // namespace write
@@ -72,8 +72,7 @@ client::CancellationToken PublishApi::InitPublication(
           return;
         }
 
-        callback(parser::parse_result<InitPublicationResponse>(
-            http_response.GetRawResponse()));
+        callback(parser::parse_result<InitPublicationResponse>(http_response));
       });
 
   return cancel_token;
@@ -107,8 +106,7 @@ InitPublicationResponse PublishApi::InitPublication(
     return InitPublicationResponse(client::ApiError(
         http_response.GetStatus(), http_response.GetResponseAsString()));
   }
-  return parser::parse_result<InitPublicationResponse>(
-      http_response.GetRawResponse());
+  return parser::parse_result<InitPublicationResponse>(http_response);
 }
 
 client::CancellationToken PublishApi::UploadPartitions(
@@ -276,8 +274,7 @@ client::CancellationToken PublishApi::GetPublication(
           return;
         }
 
-        callback(parser::parse_result<GetPublicationResponse>(
-            http_response.GetRawResponse()));
+        callback(parser::parse_result<GetPublicationResponse>(http_response));
       });
 
   return cancel_token;
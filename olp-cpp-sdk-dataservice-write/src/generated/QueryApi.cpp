@@ -87,7 +87,7 @@ client::CancellationToken QueryApi::GetPartitionsById(
                                           response.GetResponseAsString()));
     } else {
       partitionsCallback(
-          parser::parse_result<PartitionsResponse>(response.GetRawResponse()));
+          parser::parse_result<PartitionsResponse>(response));
     }
   };
 
@@ -131,8 +131,7 @@ QueryApi::PartitionsResponse QueryApi::GetPartitionsById(
     return client::ApiError(http_response.GetStatus(),
                             http_response.GetResponseAsString());
   }
-  return parser::parse_result<PartitionsResponse>(
-      http_response.GetRawResponse());
+  return parser::parse_result<PartitionsResponse>(http_response);
 }
 
 }  // namespace write
@@ -53,7 +53,7 @@ client::CancellationToken ResourcesApi::GetApis(
         } else {
           // parse the services
           // TODO catch any exception and return as Error
-          callback(parser::parse_result<ApisResponse>(response.GetRawResponse()));
+          callback(parser::parse_result<ApisResponse>(response));
         }
       };
   return client->CallApi(resource_url, "GET", query_params, header_params,
@@ -80,7 +80,7 @@ ResourcesApi::ApisResponse ResourcesApi::GetApis(
     return client::ApiError(http_response.GetStatus(), http_response.GetResponseAsString());
   }
 
-  return parser::parse_result<ApisResponse>(http_response.GetRawResponse());
+  return parser::parse_result<ApisResponse>(http_response);
 }
 
 }  // namespace write
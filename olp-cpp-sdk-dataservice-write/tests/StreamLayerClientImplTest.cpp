@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include <olp/core/cache/CacheSettings.h>
 #include <olp/core/client/OlpClientSettingsFactory.h>
 #include <boost/optional/optional_io.hpp>
+#include <sstream>
 #include <unordered_set>
 #include "StreamLayerClientImpl.h"
 
@@ -526,6 +527,110 @@ TEST_F(StreamLayerClientImplTest, SuccessfullyPublishDataGreaterThanTwentyMib) {
   ASSERT_EQ(kMockedPartitionId, response.GetResult().GetTraceID());
 }
 
+TEST_F(StreamLayerClientImplTest, PublishDataStreamGreaterThanTwentyMib) {
+  const std::string kPayload = "streamed payload";
+  auto stream = std::make_shared<std::stringstream>(kPayload);
+  auto request = model::PublishDataRequest()
+                     .WithDataStream(stream, kPayload.size())
+                     .WithLayerId(kLayerName);
+
+  auto settings = settings_;
+  settings.cache = client::OlpClientSettingsFactory::CreateDefaultCache({});
+  settings.retry_settings.initial_backdown_period = 0;
+
+  const std::string kMockedPartitionId = "some-generated-partition-uuid";
+  MockStreamLayerClientImpl client{kHrn, write::StreamLayerClientSettings{},
+                                   settings};
+
+  EXPECT_CALL(client, GenerateUuid)
+      .WillOnce(Return(kMockedDataHandle))
+      .WillOnce(Return(kMockedPartitionId));
+
+  EXPECT_CALL(*network_, Send(IsGetRequest(kConfigRequestUrl), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                       olp::http::HttpStatusCode::OK),
+                                   kConfigHttpResponse));
+
+  EXPECT_CALL(*network_, Send(IsGetRequest(kGetCatalogRequest), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                       olp::http::HttpStatusCode::OK),
+                                   kGetCatalogResponse));
+
+  EXPECT_CALL(*network_, Send(IsGetRequest(kPublishRequestUrl), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                       olp::http::HttpStatusCode::OK),
+                                   kPublishHttpResponse));
+
+  EXPECT_CALL(*network_, Send(IsGetRequest(kBlobRequestUrl), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                       olp::http::HttpStatusCode::OK),
+                                   kBlobHttpResponse));
+
+  EXPECT_CALL(*network_, Send(IsPostRequest(kInitPublicationUrl), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                       olp::http::HttpStatusCode::OK),
+                                   kInitPublicationHttpResponse));
+
+  // The first upload fails with a retryable error, so the stream must be
+  // rewound before the blob is sent again.
+  std::vector<std::string> uploaded_bodies;
+  auto read_body = [&](const olp::http::NetworkRequest& network_request) {
+    EXPECT_FALSE(network_request.GetBody());
+    ASSERT_EQ(network_request.GetBodyStream(), stream);
+    ASSERT_TRUE(network_request.GetBodyStreamSize());
+    EXPECT_EQ(*network_request.GetBodyStreamSize(), kPayload.size());
+
+    std::string body(kPayload.size(), '\0');
+    stream->read(&body[0], static_cast<std::streamsize>(body.size()));
+    body.resize(static_cast<size_t>(stream->gcount()));
+    uploaded_bodies.push_back(std::move(body));
+  };
+
+  EXPECT_CALL(*network_, Send(IsPutRequest(kPutBlobRequestUrl), _, _, _, _))
+      .WillOnce([&](olp::http::NetworkRequest network_request,
+                    olp::http::Network::Payload payload,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback header_callback,
+                    olp::http::Network::DataCallback data_callback) {
+        read_body(network_request);
+        return ReturnHttpResponse(
+            olp::http::NetworkResponse().WithStatus(
+                olp::http::HttpStatusCode::SERVICE_UNAVAILABLE),
+            std::string{})(network_request, payload, callback, header_callback,
+                           data_callback);
+      })
+      .WillOnce([&](olp::http::NetworkRequest network_request,
+                    olp::http::Network::Payload payload,
+                    olp::http::Network::Callback callback,
+                    olp::http::Network::HeaderCallback header_callback,
+                    olp::http::Network::DataCallback data_callback) {
+        read_body(network_request);
+        return ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                      olp::http::HttpStatusCode::OK),
+                                  std::string{})(network_request, payload,
+                                                 callback, header_callback,
+                                                 data_callback);
+      });
+
+  EXPECT_CALL(*network_,
+              Send(IsPostRequest(kUploadPartitionRequestUrl), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                       olp::http::HttpStatusCode::NO_CONTENT),
+                                   std::string{}));
+
+  EXPECT_CALL(*network_,
+              Send(IsPutRequest(kSubmitPublicationRequestUrl), _, _, _, _))
+      .WillOnce(ReturnHttpResponse(olp::http::NetworkResponse().WithStatus(
+                                       olp::http::HttpStatusCode::NO_CONTENT),
+                                   std::string{}));
+
+  auto response = client.PublishDataGreaterThanTwentyMib(
+      request, client::CancellationContext{});
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(kMockedPartitionId, response.GetResult().GetTraceID());
+  EXPECT_EQ(uploaded_bodies, std::vector<std::string>(2u, kPayload));
+}
+
 TEST_F(StreamLayerClientImplTest, FailedPublishDataGreaterThanTwentyMib) {
   auto data = std::make_shared<std::vector<unsigned char>>(1, 'a');
   auto request =
@@ -778,4 +883,23 @@ TEST_F(StreamLayerClientImplTest, QueueAndFlush) {
   EXPECT_EQ(kBatchSize, trace_ids.size());
 }
 
+TEST_F(StreamLayerClientImplTest, QueueRejectsDataStream) {
+  settings_.cache =
+      olp::client::OlpClientSettingsFactory::CreateDefaultCache({});
+
+  auto client = std::make_shared<MockStreamLayerClientImpl>(
+      kHrn, write::StreamLayerClientSettings{}, settings_);
+
+  const std::string kPayload = "streamed payload";
+  auto request =
+      model::PublishDataRequest()
+          .WithDataStream(std::make_shared<std::stringstream>(kPayload),
+                          kPayload.size())
+          .WithLayerId("layer");
+
+  auto error = client->Queue(request);
+  EXPECT_NE(olp::porting::none, error);
+  EXPECT_EQ(client->QueueSize(), 0u);
+}
+
 }  // namespace
@@ -17,6 +17,10 @@
  * License-Filename: LICENSE
  */
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <matchers/NetworkUrlMatchers.h>
 #include <mocks/CacheMock.h>
@@ -390,6 +394,75 @@ TEST_F(VersionedLayerClientImplPublishToBatchTest, PublishToBatch) {
   }
 }
 
+TEST_F(VersionedLayerClientImplPublishToBatchTest, PublishDataStream) {
+  const std::string partition = "132";
+  const std::string kPayload = "streamed payload";
+  const auto publication =
+      mockserver::DefaultResponses::GeneratePublicationResponse({kLayer}, {});
+
+  MockConfigRequest(kLayer);
+  MockPublishPartitionRequest(publication, kLayer);
+
+  EXPECT_CALL(*cache_, Get(_, _)).Times(3);
+  EXPECT_CALL(*cache_, Contains(_)).Times(1);
+  EXPECT_CALL(*cache_, Put(_, _, _, _))
+      .WillRepeatedly([](const std::string& /*key*/,
+                         const olp::porting::any& /*value*/,
+                         const olp::cache::Encoder& /*encoder*/,
+                         time_t /*expiry*/) { return true; });
+
+  auto stream = std::make_shared<std::stringstream>(kPayload);
+
+  // The first upload fails with a retryable error, so the stream must be
+  // rewound before the blob is sent again.
+  std::vector<std::string> uploaded_bodies;
+  auto upload = [&](int status) {
+    return [&, status](olp::http::NetworkRequest request,
+                       olp::http::Network::Payload payload,
+                       olp::http::Network::Callback callback,
+                       olp::http::Network::HeaderCallback header_callback,
+                       olp::http::Network::DataCallback data_callback) {
+      EXPECT_FALSE(request.GetBody());
+      EXPECT_EQ(request.GetBodyStream(), stream);
+      EXPECT_EQ(olp::porting::value_or(request.GetBodyStreamSize(), 0u),
+                kPayload.size());
+
+      std::string body(kPayload.size(), '\0');
+      stream->read(&body[0], static_cast<std::streamsize>(body.size()));
+      body.resize(static_cast<size_t>(stream->gcount()));
+      uploaded_bodies.push_back(std::move(body));
+
+      return ReturnHttpResponse(
+          olp::http::NetworkResponse().WithStatus(status),
+          std::string{})(request, payload, callback, header_callback,
+                         data_callback);
+    };
+  };
+
+  const auto blob_api = MockApiRequest("blob");
+  EXPECT_CALL(*network_,
+              Send(IsPutRequestPrefix(blob_api.GetBaseUrl() + "/layers/" +
+                                      kLayer + "/data/"),
+                   _, _, _, _))
+      .WillOnce(upload(olp::http::HttpStatusCode::SERVICE_UNAVAILABLE))
+      .WillOnce(upload(olp::http::HttpStatusCode::NO_CONTENT));
+
+  auto settings = settings_;
+  settings.retry_settings.initial_backdown_period = 0;
+  write::VersionedLayerClientImpl client(kHrn, settings);
+
+  auto request = model::PublishPartitionDataRequest()
+                     .WithDataStream(stream, kPayload.size())
+                     .WithLayerId(kLayer)
+                     .WithPartitionId(partition);
+  auto future = client.PublishToBatch(publication, request).GetFuture();
+
+  const auto response = future.get();
+  ASSERT_TRUE(response.IsSuccessful());
+  EXPECT_EQ(response.GetResult().GetTraceID(), partition);
+  EXPECT_EQ(uploaded_bodies, std::vector<std::string>(2u, kPayload));
+}
+
 TEST_F(VersionedLayerClientImplPublishToBatchTest, NetworkErrors) {
   const auto catalog = kHrn.ToCatalogHRNString();
   const auto mock_error = olp::http::HttpStatusCode::BAD_REQUEST;
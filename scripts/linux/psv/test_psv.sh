@@ -1,6 +1,6 @@
 #!/bin/bash -e
 #
-# Copyright (C) 2019-2021 HERE Europe B.V.
+# Copyright (C) 2019-2026 HERE Europe B.V.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -32,6 +32,11 @@ $CPP_TEST_SOURCE_AUTHENTICATION/olp-cpp-sdk-authentication-tests \
 echo ">>> Core Test ... >>>"
 $CPP_TEST_SOURCE_CORE/olp-cpp-sdk-core-tests \
     --gtest_output="xml:olp-cpp-sdk-core-tests-report.xml"
+if [ -f $CPP_TEST_SOURCE_CORE/olp-cpp-sdk-core-coroutine-tests ]; then
+    echo ">>> Core Coroutine Test ... >>>"
+    $CPP_TEST_SOURCE_CORE/olp-cpp-sdk-core-coroutine-tests \
+        --gtest_output="xml:olp-cpp-sdk-core-coroutine-tests-report.xml"
+fi
 echo ">>> Dataservice read Test ... >>>"
 $CPP_TEST_SOURCE_DARASERVICE_READ/olp-cpp-sdk-dataservice-read-tests \
     --gtest_output="xml:olp-cpp-sdk-dataservice-read-tests-report.xml"
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <olp/core/logging/Appender.h>
+#include <olp/core/logging/Configuration.h>
+#include <olp/core/logging/Log.h>
+
+namespace {
+namespace logging = olp::logging;
+
+constexpr auto kLogTag = "LoggingTest";
+constexpr size_t kStatements = 1000000u;
+constexpr size_t kEnabledStatements = 100000u;
+
+using Clock = std::chrono::steady_clock;
+
+int64_t ElapsedNs(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                              start)
+      .count();
+}
+
+class CountingAppender : public logging::IAppender {
+ public:
+  logging::IAppender& append(const logging::LogMessage& message) override {
+    size_ += std::char_traits<char>::length(message.message);
+    ++count_;
+    return *this;
+  }
+
+  std::atomic<size_t> count_{0u};
+  size_t size_ = 0u;
+};
+
+struct LoggingTest : public ::testing::Test {
+  void TearDown() override {
+    logging::Log::configure(logging::Configuration::createDefault());
+    logging::Log::setLevel(logging::Level::Info);
+    for (const auto& result : results) {
+      OLP_SDK_LOG_CRITICAL_INFO_F(kLogTag, "%s: %.1f ns per statement",
+                                  result.first.c_str(), result.second);
+      RecordProperty(result.first + "_ns", std::to_string(result.second));
+    }
+  }
+
+  std::shared_ptr<CountingAppender> Configure(bool async) {
+    auto appender = std::make_shared<CountingAppender>();
+    logging::Configuration configuration;
+    configuration.addAppender(appender);
+    if (async) {
+      logging::Configuration::AsyncSettings settings;
+      settings.overflowPolicy = logging::Configuration::OverflowPolicy::Block;
+      configuration.setAsync(settings);
+    }
+    logging::Log::configure(configuration);
+    logging::Log::setLevel(logging::Level::Info);
+    return appender;
+  }
+
+  void Report(const std::string& name, int64_t elapsed_ns, size_t count) {
+    results.emplace_back(name, static_cast<double>(elapsed_ns) / count);
+  }
+
+  std::vector<std::pair<std::string, double>> results;
+};
+
+/*
+ * Measures the statements below the enabled level, which should cost only
+ * the level check.
+ */
+TEST_F(LoggingTest, DisabledStatements) {
+  auto appender = Configure(false);
+  const std::string path = "/some/path";
+
+  auto start = Clock::now();
+  for (size_t i = 0u; i < kStatements; ++i) {
+    OLP_SDK_LOG_DEBUG(kLogTag, "Request " << i << " to " << path);
+  }
+  Report("disabled_stream", ElapsedNs(start), kStatements);
+
+  start = Clock::now();
+  for (size_t i = 0u; i < kStatements; ++i) {
+    OLP_SDK_LOG_DEBUG_F(kLogTag, "Request %zu to %s", i, path.c_str());
+  }
+  Report("disabled_printf", ElapsedNs(start), kStatements);
+
+  start = Clock::now();
+  for (size_t i = 0u; i < kStatements; ++i) {
+    OLP_SDK_LOG_DEBUG_S(kLogTag, "Request {} to {}", i, path);
+  }
+  Report("disabled_structured", ElapsedNs(start), kStatements);
+
+  // A tag level mixed with the default level needs the tag lookup.
+  logging::Log::setLevel(logging::Level::Trace, "OtherTag");
+  start = Clock::now();
+  for (size_t i = 0u; i < kStatements; ++i) {
+    OLP_SDK_LOG_DEBUG_S(kLogTag, "Request {} to {}", i, path);
+  }
+  Report("disabled_structured_tag_levels", ElapsedNs(start), kStatements);
+  logging::Log::clearLevels();
+
+  EXPECT_EQ(appender->count_.load(), 0u);
+}
+
+/*
+ * Measures the enabled statements on the calling thread, in the synchronous
+ * and asynchronous modes.
+ */
+TEST_F(LoggingTest, EnabledStatements) {
+  const std::string path = "/some/path";
+
+  for (const bool async : {false, true}) {
+    const std::string mode = async ? "async" : "sync";
+
+    auto appender = Configure(async);
+    auto start = Clock::now();
+    for (size_t i = 0u; i < kEnabledStatements; ++i) {
+      OLP_SDK_LOG_INFO(kLogTag, "Request " << i << " to " << path);
+    }
+    Report(mode + "_stream", ElapsedNs(start), kEnabledStatements);
+
+    start = Clock::now();
+    for (size_t i = 0u; i < kEnabledStatements; ++i) {
+      OLP_SDK_LOG_INFO_S(kLogTag, "Request {} to {}", i, path);
+    }
+    Report(mode + "_structured", ElapsedNs(start), kEnabledStatements);
+
+    // Switching the mode writes the queued messages.
+    logging::Log::configure(logging::Configuration::createDefault());
+    EXPECT_EQ(appender->count_.load(), 2u * kEnabledStatements);
+  }
+}
+
+}  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,6 +27,8 @@
 #include <olp/core/utils/Dir.h>
 #include <testutils/CustomParameters.hpp>
 #include "NetworkWrapper.h"
+#include "OlpServerFixtures.h"
+#include "SimulatedNetwork.h"
 
 using KeyValueCachePtr = std::shared_ptr<olp::cache::KeyValueCache>;
 using CacheFactory = std::function<KeyValueCachePtr()>;
@@ -36,6 +38,8 @@ struct TestBaseConfiguration {
   CacheFactory cache_factory{nullptr};
   bool with_http_errors{false};
   bool with_network_timeouts{false};
+  // Use the in-process `SimulatedNetwork` instead of the Node test server.
+  bool with_simulated_network{false};
 };
 
 template <typename Param>
@@ -53,6 +57,32 @@ class MemoryTestBase : public ::testing::TestWithParam<Param> {
         .WithType(olp::http::NetworkProxySettings::Type::HTTP);
   }
 
+  /*
+   * Creates a network with the conditions of a typical broadband connection,
+   * where the blob service is further away than the metadata services. The
+   * error flags enable the same error rate as the Node test server has.
+   */
+  std::shared_ptr<olp::http::Network> CreateSimulatedNetwork(
+      const Param& parameter) {
+    SimulatedNetwork::Settings settings;
+    settings.bandwidth = 100u * 1024u * 1024u / 8u;
+    settings.default_profile.rtt_median = std::chrono::milliseconds(30);
+    settings.default_profile.connection_setup = std::chrono::milliseconds(60);
+    settings.default_profile.error_rate =
+        parameter.with_http_errors ? 0.1 : 0.0;
+    settings.default_profile.timeout_rate =
+        parameter.with_network_timeouts ? 0.01 : 0.0;
+
+    auto blob_profile = settings.default_profile;
+    blob_profile.rtt_median = std::chrono::milliseconds(80);
+    blob_profile.rtt_sigma = 0.8;
+    settings.host_profiles[kBlobServiceHost] = blob_profile;
+
+    auto network = std::make_shared<SimulatedNetwork>(std::move(settings));
+    AddOlpServerResponses(*network);
+    return network;
+  }
+
   olp::client::OlpClientSettings CreateCatalogClientSettings() {
     const auto& parameter = MemoryTestBase<Param>::GetParam();
 
@@ -63,9 +93,15 @@ class MemoryTestBase : public ::testing::TestWithParam<Param> {
               parameter.task_scheduler_capacity);
     }
 
-    auto network = std::make_shared<Http2HttpNetworkWrapper>();
-    network->WithErrors(parameter.with_http_errors);
-    network->WithTimeouts(parameter.with_network_timeouts);
+    std::shared_ptr<olp::http::Network> network;
+    if (parameter.with_simulated_network) {
+      network = CreateSimulatedNetwork(parameter);
+    } else {
+      auto wrapper = std::make_shared<Http2HttpNetworkWrapper>();
+      wrapper->WithErrors(parameter.with_http_errors);
+      wrapper->WithTimeouts(parameter.with_network_timeouts);
+      network = std::move(wrapper);
+    }
 
     olp::client::AuthenticationSettings auth_settings;
     auth_settings.token_provider = [](olp::client::CancellationContext&) {
@@ -76,7 +112,9 @@ class MemoryTestBase : public ::testing::TestWithParam<Param> {
     client_settings.authentication_settings = auth_settings;
     client_settings.task_scheduler = task_scheduler;
     client_settings.network_request_handler = std::move(network);
-    client_settings.proxy_settings = GetLocalhostProxySettings();
+    if (!parameter.with_simulated_network) {
+      client_settings.proxy_settings = GetLocalhostProxySettings();
+    }
     client_settings.cache =
         parameter.cache_factory ? parameter.cache_factory() : nullptr;
     client_settings.retry_settings.timeout = 1;
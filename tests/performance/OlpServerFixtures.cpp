@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "OlpServerFixtures.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Response = SimulatedNetwork::Response;
+
+constexpr auto kLoremIpsum =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
+    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
+    "commodo consequat. Duis aute irure dolor in reprehenderit in voluptate "
+    "velit esse cillum dolore eu fugiat nulla pariatur. Excepteur sint "
+    "occaecat cupidatat non proident, sunt in culpa qui officia deserunt "
+    "mollit anim id est laborum.";
+
+std::mt19937& Random() {
+  static thread_local std::mt19937 random{std::random_device{}()};
+  return random;
+}
+
+std::string RandomString(size_t length) {
+  static const char kCharacters[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+  std::uniform_int_distribution<size_t> index(0u, sizeof(kCharacters) - 2u);
+
+  auto& random = Random();
+  std::string result(length, '\0');
+  for (auto& character : result) {
+    character = kCharacters[index(random)];
+  }
+  return result;
+}
+
+/// Mimics `Math.floor(Math.random() * version)`.
+std::int64_t RandomVersion(std::int64_t version) {
+  if (version <= 0) {
+    return 0;
+  }
+  return std::uniform_int_distribution<std::int64_t>(0, version - 1)(Random());
+}
+
+/// Returns all the values of the query parameter.
+std::vector<std::string> GetQueryValues(const std::string& url,
+                                        const std::string& name) {
+  std::vector<std::string> values;
+  auto begin = url.find('?');
+  while (begin != std::string::npos) {
+    ++begin;
+    auto end = url.find_first_of("&#", begin);
+    const auto parameter = url.substr(begin, end - begin);
+    const auto separator = parameter.find('=');
+    if (separator == name.size() &&
+        parameter.compare(0, separator, name) == 0) {
+      values.push_back(parameter.substr(separator + 1u));
+    }
+    begin = end != std::string::npos && url[end] == '&' ? end
+                                                         : std::string::npos;
+  }
+  return values;
+}
+
+std::int64_t GetQueryVersion(const olp::http::NetworkRequest& request) {
+  const auto values = GetQueryValues(request.GetUrl(), "version");
+  return values.empty() ? 0 : std::strtoll(values.front().c_str(), nullptr, 10);
+}
+
+Response JsonResponse(const std::string& json) {
+  Response response;
+  response.headers.emplace_back("Content-Type", "application/json");
+  response.body = json;
+  return response;
+}
+
+std::string ServiceUrl(const std::string& service) {
+  if (service == "lookup") {
+    return kLookupServiceHost;
+  } else if (service == "config") {
+    return kConfigServiceHost;
+  } else if (service == "metadata") {
+    return kMetadataServiceHost;
+  } else if (service == "query") {
+    return kQueryServiceHost;
+  } else if (service == "blob") {
+    return kBlobServiceHost;
+  }
+  return "not_used.com";
+}
+
+std::string ApiJson(const std::string& service, const std::string& version,
+                    const std::string& base_url) {
+  return R"({"api":")" + service + R"(","version":")" + version +
+         R"(","baseURL":")" + base_url + R"(","parameters":{}})";
+}
+
+std::string ServiceApiJson(const std::string& service) {
+  return ApiJson(service, "v1", "http://" + ServiceUrl(service));
+}
+
+std::string ResourceApiJson(const std::string& service, const std::string& hrn,
+                            const std::string& version) {
+  return ApiJson(service, version,
+                 "http://" + ServiceUrl(service) + "/" + version +
+                     "/catalogs/" + hrn);
+}
+
+void AddLookupResponses(SimulatedNetwork& network) {
+  network.AddResponse(
+      kLookupServiceHost, R"(lookup/v1/platform/apis/(.+)/(.+)$)",
+      [](const std::smatch& match, const olp::http::NetworkRequest&) {
+        return JsonResponse("[" + ServiceApiJson(match[1]) + "]");
+      });
+  network.AddResponse(
+      kLookupServiceHost, R"(lookup/v1/platform/apis$)",
+      [](const std::smatch&, const olp::http::NetworkRequest&) {
+        return JsonResponse("[" + ServiceApiJson("config") + "," +
+                            ServiceApiJson("lookup") + "]");
+      });
+  network.AddResponse(
+      kLookupServiceHost, R"(lookup/v1/resources/(.+)/apis/(.+)/(.+)$)",
+      [](const std::smatch& match, const olp::http::NetworkRequest&) {
+        return JsonResponse("[" +
+                            ResourceApiJson(match[2], match[1], match[3]) +
+                            "]");
+      });
+  network.AddResponse(
+      kLookupServiceHost, R"(lookup/v1/resources/(.+)/apis$)",
+      [](const std::smatch& match, const olp::http::NetworkRequest&) {
+        const std::string hrn = match[1];
+        return JsonResponse("[" + ResourceApiJson("blob", hrn, "v1") + "," +
+                            ResourceApiJson("metadata", hrn, "v1") + "," +
+                            ResourceApiJson("query", hrn, "v1") + "]");
+      });
+}
+
+void AddConfigResponses(SimulatedNetwork& network) {
+  network.AddResponse(
+      kConfigServiceHost, R"(catalogs/(.+)$)",
+      [](const std::smatch& match, const olp::http::NetworkRequest&) {
+        std::stringstream json;
+        json << R"({"id":"Some unique Id","hrn":")" << match[1]
+             << R"(","name":"Generated Catalog","description":")"
+             << kLoremIpsum << R"(","layers":[)";
+        const char* layers[][2] = {{"versioned_test_layer", "versioned"},
+                                   {"volatile_test_layer", "volatile"}};
+        for (const auto& layer : layers) {
+          json << (layer == layers[0] ? "" : ",") << R"({"id":")" << layer[0]
+               << R"(","description":")" << kLoremIpsum
+               << R"(","schema":{"hrn":"hrn:here:schema:::com:here-tile-)"
+               << R"(schema_v1:1.0.0"},"layerType":")" << layer[1] << R"("})";
+        }
+        json << R"(],"marketplaceReady":false,"version":11})";
+        return JsonResponse(json.str());
+      });
+}
+
+std::string PartitionsJson(const std::vector<std::string>& partitions,
+                           const std::string& layer, std::int64_t version) {
+  std::stringstream json;
+  json << R"({"partitions":[)";
+  for (size_t i = 0; i < partitions.size(); ++i) {
+    json << (i ? "," : "") << R"({"version":)" << RandomVersion(version)
+         << R"(,"partition":")" << partitions[i] << R"(","layer":")" << layer
+         << R"(","dataHandle":")" << RandomString(35) << R"("})";
+  }
+  json << "]}";
+  return json.str();
+}
+
+void AddMetadataResponses(SimulatedNetwork& network) {
+  network.AddResponse(
+      kMetadataServiceHost, R"(layers/(.+)/partitions$)",
+      [](const std::smatch& match, const olp::http::NetworkRequest& request) {
+        std::vector<std::string> partitions(1000u);
+        for (auto& partition : partitions) {
+          partition = RandomString(5);
+        }
+        return JsonResponse(
+            PartitionsJson(partitions, match[1], GetQueryVersion(request)));
+      });
+  network.AddResponse(
+      kMetadataServiceHost, R"(catalogs/(.+)/versions/latest$)",
+      [](const std::smatch&, const olp::http::NetworkRequest&) {
+        return JsonResponse(R"({"version":100})");
+      });
+  network.AddResponse(
+      kMetadataServiceHost, R"(catalogs/(.+)/layerVersions$)",
+      [](const std::smatch&, const olp::http::NetworkRequest& request) {
+        const auto version = std::to_string(GetQueryVersion(request));
+        return JsonResponse(R"({"version":)" + version +
+                            R"(,"layerVersions":[{"layer":)"
+                            R"("versioned_test_layer","version":)" +
+                            version + R"(,"timestamp":0}]})");
+      });
+}
+
+/// Appends the sub quads of the `key` up to the `depth_limit`, mimics
+/// `traverseKey` of the query service fixture.
+void AppendSubQuads(std::uint64_t key, int depth, int depth_limit,
+                    std::int64_t version, std::stringstream& json) {
+  if (depth > depth_limit) {
+    return;
+  }
+
+  json << (key == 1u ? "" : ",") << R"({"version":)" << RandomVersion(version)
+       << R"(,"subQuadKey":")" << key << R"(","dataHandle":")"
+       << RandomString(35) << R"("})";
+  for (std::uint64_t child = 0u; child < 4u; ++child) {
+    AppendSubQuads((key << 2) + child, depth + 1, depth_limit, version, json);
+  }
+}
+
+void AddQueryResponses(SimulatedNetwork& network) {
+  network.AddResponse(
+      kQueryServiceHost, R"(layers/(.+)/partitions$)",
+      [](const std::smatch& match, const olp::http::NetworkRequest& request) {
+        return JsonResponse(
+            PartitionsJson(GetQueryValues(request.GetUrl(), "partition"),
+                           match[1], GetQueryVersion(request)));
+      });
+  network.AddResponse(
+      kQueryServiceHost,
+      R"(layers/(.+)/versions/(.+)/quadkeys/(.+)/depths/(\d{1}))",
+      [](const std::smatch& match, const olp::http::NetworkRequest&) {
+        const auto version = std::strtoll(match.str(2).c_str(), nullptr, 10);
+        auto key = std::strtoull(match.str(3).c_str(), nullptr, 10);
+        const auto depth = std::stoi(match[4]);
+
+        std::stringstream json;
+        json << R"({"subQuads":[)";
+        AppendSubQuads(1u, 0, depth, version, json);
+        json << R"(],"parentQuads":[)";
+        for (key >>= 2; key > 1u; key >>= 2) {
+          json << R"({"version":)" << RandomVersion(version)
+               << R"(,"partition":")" << key << R"(","dataHandle":")"
+               << RandomString(35) << R"("})" << (key >> 2 > 1u ? "," : "");
+        }
+        json << "]}";
+        return JsonResponse(json.str());
+      });
+}
+
+void AddBlobResponses(SimulatedNetwork& network) {
+  network.AddResponse(
+      kBlobServiceHost, R"(layers/(.+)/data/(.+)$)",
+      [](const std::smatch&, const olp::http::NetworkRequest&) {
+        // Generate a blob 400-500 Kb.
+        std::uniform_int_distribution<size_t> size(400u, 499u);
+        Response response;
+        response.headers.emplace_back("Content-Type",
+                                      "application/x-protobuf");
+        response.body = RandomString(size(Random()) * 1024u);
+        return response;
+      });
+}
+
+}  // namespace
+
+void AddOlpServerResponses(SimulatedNetwork& network) {
+  AddLookupResponses(network);
+  AddConfigResponses(network);
+  AddMetadataResponses(network);
+  AddQueryResponses(network);
+  AddBlobResponses(network);
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include "SimulatedNetwork.h"
+
+/*
+ * Host names used by the `tests/utils/olp_server` fixtures, see `urls.js`.
+ */
+constexpr auto kLookupServiceHost = "api-lookup.data.api.platform.here.com";
+constexpr auto kConfigServiceHost = "config_service.com";
+constexpr auto kMetadataServiceHost = "metadata_service.com";
+constexpr auto kQueryServiceHost = "query_service.com";
+constexpr auto kBlobServiceHost = "blob_service.com";
+
+/*
+ * Registers the responses of the lookup, config, metadata, query, and blob
+ * services that are generated the same way as in the `olp_server` fixtures,
+ * so the tests can run against `SimulatedNetwork` without the Node server.
+ */
+void AddOlpServerResponses(SimulatedNetwork& network);
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <olp/core/client/ApiError.h>
+#include <olp/core/client/ApiResponse.h>
+#include <olp/core/client/CancellationContext.h>
+#include <olp/core/client/PendingRequests.h>
+#include <olp/core/client/TaskContext.h>
+#include <olp/core/logging/Log.h>
+
+namespace {
+namespace client = olp::client;
+
+constexpr auto kLogTag = "PendingRequestsTest";
+constexpr size_t kTasks = 100000u;
+constexpr size_t kThreads = 4u;
+
+using Clock = std::chrono::steady_clock;
+using Response = client::ApiResponse<int, client::ApiError>;
+
+int64_t ElapsedUs(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() -
+                                                               start)
+      .count();
+}
+
+void Report(const std::string& name, int64_t elapsed_us) {
+  OLP_SDK_LOG_CRITICAL_INFO_F(kLogTag, "%s: %zu tasks in %lld us",
+                              name.c_str(), kTasks,
+                              static_cast<long long>(elapsed_us));
+  testing::Test::RecordProperty(name + "_elapsed_us",
+                                std::to_string(elapsed_us));
+}
+
+std::vector<client::TaskContext> CreateContexts() {
+  std::vector<client::TaskContext> contexts;
+  contexts.reserve(kTasks);
+  for (size_t i = 0u; i < kTasks; ++i) {
+    contexts.push_back(client::TaskContext::Create(
+        [](client::CancellationContext) { return Response(0); },
+        [](Response) {}));
+  }
+  return contexts;
+}
+
+/*
+ * Inserts and removes the tasks from several threads, as the clients do
+ * when the requests are started and finished.
+ */
+TEST(PendingRequestsTest, InsertRemove) {
+  const auto contexts = CreateContexts();
+  client::PendingRequests requests;
+
+  const auto start = Clock::now();
+  std::vector<std::thread> threads;
+  for (size_t t = 0u; t < kThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = t; i < kTasks; i += kThreads) {
+        requests.Insert(contexts[i]);
+      }
+      for (size_t i = t; i < kTasks; i += kThreads) {
+        requests.Remove(contexts[i]);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  Report("insert_remove", ElapsedUs(start));
+
+  EXPECT_EQ(requests.GetTaskCount(), 0u);
+}
+
+TEST(PendingRequestsTest, CancelAll) {
+  const auto contexts = CreateContexts();
+  client::PendingRequests requests;
+  for (const auto& context : contexts) {
+    requests.Insert(context);
+  }
+  ASSERT_EQ(requests.GetTaskCount(), kTasks);
+
+  const auto start = Clock::now();
+  EXPECT_TRUE(requests.CancelAll());
+  Report("cancel_all", ElapsedUs(start));
+}
+
+/*
+ * Checks the cancellation state from several threads, as the tasks do
+ * between their steps.
+ */
+TEST(PendingRequestsTest, IsCancelled) {
+  client::CancellationContext context;
+  size_t cancelled = 0u;
+
+  const auto start = Clock::now();
+  std::vector<std::thread> threads;
+  for (size_t t = 0u; t < kThreads; ++t) {
+    threads.emplace_back([&]() {
+      size_t count = 0u;
+      for (size_t i = 0u; i < kTasks; ++i) {
+        count += context.IsCancelled() ? 1u : 0u;
+      }
+      if (count != 0u) {
+        cancelled = count;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  Report("is_cancelled", ElapsedUs(start));
+
+  EXPECT_EQ(cancelled, 0u);
+}
+
+}  // namespace
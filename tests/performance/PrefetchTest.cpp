@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 HERE Europe B.V.
+ * Copyright (C) 2019-2026 HERE Europe B.V.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -189,10 +189,26 @@ TestConfiguration ShortRunningTestWithMutableCache() {
   return configuration;
 }
 
+/*
+ * Test to collect SDK allocations with in memory cache against the simulated
+ * network, does not need the Node test server.
+ */
+TestConfiguration ShortRunningTestWithSimulatedNetwork() {
+  TestConfiguration configuration;
+  SetDefaultCacheConfiguration(configuration);
+  SetErrorFlags(configuration);
+  configuration.with_simulated_network = true;
+  configuration.task_scheduler_capacity =
+      configuration.calling_thread_count * 3;
+  configuration.configuration_name = "short_test_simulated_network";
+  return configuration;
+}
+
 std::vector<TestConfiguration> Configurations() {
   std::vector<TestConfiguration> configurations;
   configurations.emplace_back(ShortRunningTestWithMemoryCache());
   configurations.emplace_back(ShortRunningTestWithMutableCache());
+  configurations.emplace_back(ShortRunningTestWithSimulatedNetwork());
   return configurations;
 }
 
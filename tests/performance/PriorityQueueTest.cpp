@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <olp/core/logging/Log.h>
+#include <olp/core/thread/TaskScheduler.h>
+
+#include "thread/BucketedPriorityQueue.h"
+#include "thread/PriorityQueueExtended.h"
+
+namespace {
+constexpr auto kLogTag = "PriorityQueueTest";
+constexpr size_t kTasks = 1000000u;
+constexpr size_t kBatch = 1000u;
+
+struct Task {
+  std::function<void()> function;
+  uint32_t priority;
+};
+
+struct CompareTask {
+  bool operator()(const Task& lhs, const Task& rhs) const {
+    return lhs.priority < rhs.priority;
+  }
+};
+
+struct GetTaskPriority {
+  uint32_t operator()(const Task& task) const { return task.priority; }
+};
+
+/*
+ * Pushes and pops the tasks in batches, as the scheduler does under load,
+ * with the three priorities used by the SDK.
+ */
+template <class Queue>
+void MeasurePushPop(Queue& queue, const std::string& name) {
+  const uint32_t priorities[] = {olp::thread::LOW, olp::thread::NORMAL,
+                                 olp::thread::HIGH};
+  size_t executed = 0u;
+  auto function = [&executed]() { ++executed; };
+
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t pushed = 0u; pushed < kTasks; pushed += kBatch) {
+    for (size_t i = 0u; i < kBatch; ++i) {
+      queue.push({function, priorities[i % 3]});
+    }
+    while (!queue.empty()) {
+      queue.front().function();
+      queue.pop();
+    }
+  }
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  ASSERT_EQ(executed, kTasks);
+
+  OLP_SDK_LOG_CRITICAL_INFO_F(kLogTag, "%s: %zu tasks in %lld us",
+                              name.c_str(), kTasks,
+                              static_cast<long long>(elapsed.count()));
+  testing::Test::RecordProperty(name + "_elapsed_us",
+                                std::to_string(elapsed.count()));
+}
+
+TEST(PriorityQueueTest, PushPop) {
+  {
+    SCOPED_TRACE("PriorityQueueExtended");
+    olp::thread::PriorityQueueExtended<Task, CompareTask> queue;
+    MeasurePushPop(queue, "priority_queue_extended");
+  }
+  {
+    SCOPED_TRACE("BucketedPriorityQueue");
+    olp::thread::BucketedPriorityQueue<Task, GetTaskPriority> queue;
+    MeasurePushPop(queue, "bucketed_priority_queue");
+  }
+}
+
+}  // namespace
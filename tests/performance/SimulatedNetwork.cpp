@@ -0,0 +1,466 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include "SimulatedNetwork.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "olp/core/http/NetworkUtils.h"
+
+namespace {
+
+using olp::http::Diagnostics;
+using olp::http::ErrorCode;
+using olp::http::NetworkRequest;
+using olp::http::NetworkResponse;
+using olp::http::RequestId;
+using olp::http::SendOutcome;
+
+// The same errors as `tests/utils/olp_server/errors_generator.js` produces.
+const std::pair<int, const char*> kErrors[] = {
+    {403,
+     R"({"error":"Forbidden","error_description":"These credentials do not )"
+     R"(authorize access"})"},
+    {404,
+     R"({"error":"Resource not Found","error_description":"Requested )"
+     R"(resource not found"})"},
+    {401,
+     R"({"errorId":"ERROR-3aaaa33b-3fb6-41cc-a238-7ff97c17bca7",)"
+     R"("httpStatus":401,"errorCode":401202,"message":"Invalid Client )"
+     R"(Authorization header, expecting signed request format."})"},
+    {404,
+     R"({"title":"Not Found","detail":[{"name":"other","error":"API not )"
+     R"(found blob/v10"}],"status":404})"},
+    {500, R"({"title":"Internal Server Error","status":500})"}};
+
+// Transfers with less bytes left are considered complete.
+constexpr double kTransferPrecision = 0.5;
+
+std::string ExtractPath(const std::string& url) {
+  auto begin = url.find("://");
+  begin = begin == std::string::npos ? 0u : begin + 3u;
+  begin = url.find('/', begin);
+  if (begin == std::string::npos) {
+    return "/";
+  }
+  return url.substr(begin, url.find_first_of("?#", begin) - begin);
+}
+
+Diagnostics::MicroSeconds ToMicroSeconds(std::chrono::nanoseconds duration) {
+  return std::chrono::duration_cast<Diagnostics::MicroSeconds>(
+      std::max(duration, std::chrono::nanoseconds::zero()));
+}
+
+}  // namespace
+
+SimulatedNetwork::SimulatedNetwork(Settings settings)
+    : settings_(std::move(settings)), random_(settings_.seed) {
+  thread_ = std::thread(&SimulatedNetwork::Run, this);
+}
+
+SimulatedNetwork::~SimulatedNetwork() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  condition_.notify_one();
+  thread_.join();
+}
+
+void SimulatedNetwork::AddResponse(const std::string& host,
+                                   const std::string& path_regex,
+                                   ResponseGenerator generator) {
+  Route route;
+  route.host = host;
+  route.path_regex = std::regex(path_regex);
+  route.generator = std::move(generator);
+  routes_.push_back(std::move(route));
+}
+
+SendOutcome SimulatedNetwork::Send(NetworkRequest request, Payload payload,
+                                   Callback callback,
+                                   HeaderCallback header_callback,
+                                   DataCallback data_callback) {
+  PendingRequest pending_request;
+  pending_request.host = olp::http::NetworkUtils::ExtractHost(request.GetUrl());
+  pending_request.timeout =
+      request.GetSettings().GetTransferTimeoutDuration();
+  pending_request.payload = std::move(payload);
+  pending_request.callback = std::move(callback);
+  pending_request.header_callback = std::move(header_callback);
+  pending_request.data_callback = std::move(data_callback);
+
+  const auto& profile = GetProfile(pending_request.host);
+  bool inject_error = false;
+  size_t error_index = 0u;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return SendOutcome(ErrorCode::OFFLINE_ERROR);
+    }
+
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    inject_error = chance(random_) < profile.error_rate;
+    pending_request.stall = chance(random_) < profile.timeout_rate;
+    error_index = std::uniform_int_distribution<size_t>(
+        0u, std::extent<decltype(kErrors)>::value - 1u)(random_);
+
+    const double median_us = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            profile.rtt_median)
+            .count());
+    double rtt_us = median_us;
+    if (profile.rtt_sigma > 0.0 && median_us > 0.0) {
+      rtt_us = std::lognormal_distribution<double>(
+          std::log(median_us), profile.rtt_sigma)(random_);
+    }
+    pending_request.rtt =
+        std::chrono::microseconds(static_cast<std::int64_t>(rtt_us));
+  }
+
+  // Generate the response out of the lock, as it might take a while.
+  if (inject_error) {
+    pending_request.response.status = kErrors[error_index].first;
+    pending_request.response.body = kErrors[error_index].second;
+    pending_request.response.headers.emplace_back("Content-Type",
+                                                  "application/json");
+  } else {
+    pending_request.response = GenerateResponse(request, pending_request.host);
+  }
+
+  RequestId id;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return SendOutcome(ErrorCode::OFFLINE_ERROR);
+    }
+
+    id = request_id_counter_;
+    if (request_id_counter_ ==
+        static_cast<RequestId>(olp::http::RequestIdConstants::RequestIdMax)) {
+      request_id_counter_ =
+          static_cast<RequestId>(olp::http::RequestIdConstants::RequestIdMin);
+    } else {
+      ++request_id_counter_;
+    }
+
+    ++counters_.requests;
+    counters_.injected_errors += inject_error ? 1u : 0u;
+    counters_.injected_timeouts += pending_request.stall ? 1u : 0u;
+
+    const auto now = Clock::now();
+    pending_request.send_time = now;
+    const auto host = pending_request.host;
+    hosts_[host].queue.push_back(id);
+    requests_.emplace(id, std::move(pending_request));
+    DispatchUnsafe(host, now);
+  }
+  condition_.notify_one();
+
+  return SendOutcome(id);
+}
+
+void SimulatedNetwork::Cancel(RequestId id) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = requests_.find(id);
+    if (it == requests_.end() || it->second.cancelled) {
+      return;
+    }
+
+    // Complete the request right away.
+    it->second.cancelled = true;
+    schedule_.emplace(Clock::now(), id);
+  }
+  condition_.notify_one();
+}
+
+SimulatedNetwork::Counters SimulatedNetwork::GetCounters() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return counters_;
+}
+
+const SimulatedNetwork::HostProfile& SimulatedNetwork::GetProfile(
+    const std::string& host) const {
+  auto it = settings_.host_profiles.find(host);
+  return it != settings_.host_profiles.end() ? it->second
+                                             : settings_.default_profile;
+}
+
+SimulatedNetwork::Response SimulatedNetwork::GenerateResponse(
+    const NetworkRequest& request, const std::string& host) const {
+  const auto path = ExtractPath(request.GetUrl());
+  for (const auto& route : routes_) {
+    std::smatch match;
+    if (route.host == host &&
+        std::regex_search(path, match, route.path_regex)) {
+      return route.generator(match, request);
+    }
+  }
+
+  Response response;
+  response.status = olp::http::HttpStatusCode::NOT_FOUND;
+  response.body = "Not Found";
+  return response;
+}
+
+void SimulatedNetwork::DispatchUnsafe(const std::string& host_name,
+                                      Clock::time_point now) {
+  auto& host = hosts_[host_name];
+  const auto& profile = GetProfile(host_name);
+
+  while (!host.queue.empty()) {
+    auto it = requests_.find(host.queue.front());
+    if (it == requests_.end() || it->second.state != State::kQueued) {
+      // Cancelled while waiting for a connection.
+      host.queue.pop_front();
+      continue;
+    }
+
+    auto& request = it->second;
+    auto connect_time = now;
+    if (host.idle_connections > 0u) {
+      --host.idle_connections;
+    } else if (host.open_connections < std::max<size_t>(
+                                           profile.max_connections, 1u)) {
+      ++host.open_connections;
+      ++counters_.connections_opened;
+      request.new_connection = true;
+      connect_time += profile.connection_setup;
+    } else {
+      break;
+    }
+
+    host.queue.pop_front();
+    request.state = State::kWaiting;
+    request.connected = true;
+    request.connect_time = connect_time;
+    request.first_byte_time = connect_time + request.rtt;
+
+    // The stalled request does not receive anything until it times out.
+    schedule_.emplace(request.stall ? connect_time + request.timeout
+                                    : request.first_byte_time,
+                      it->first);
+  }
+}
+
+SimulatedNetwork::Finished SimulatedNetwork::FinishUnsafe(
+    RequestId id, Result result, Clock::time_point now) {
+  auto it = requests_.find(id);
+  Finished finished{id, std::move(it->second), result, now};
+  requests_.erase(it);
+
+  if (finished.request.connected) {
+    auto& host = hosts_[finished.request.host];
+    if (result == Result::kCompleted) {
+      ++host.idle_connections;
+    } else {
+      // The connection of the aborted transfer can not be reused.
+      --host.open_connections;
+    }
+
+    DispatchUnsafe(finished.request.host, now);
+  }
+
+  if (result == Result::kCompleted) {
+    counters_.bytes_downloaded += finished.request.response.body.size();
+  }
+
+  return finished;
+}
+
+void SimulatedNetwork::AdvanceTransfersUnsafe(Clock::time_point now) {
+  if (!transfers_.empty() && now > transfers_update_time_) {
+    const double elapsed =
+        std::chrono::duration<double>(now - transfers_update_time_).count();
+    const double share = static_cast<double>(settings_.bandwidth) * elapsed /
+                         static_cast<double>(transfers_.size());
+    for (auto& transfer : transfers_) {
+      transfer.second -= share;
+    }
+  }
+  transfers_update_time_ = now;
+}
+
+SimulatedNetwork::Clock::time_point SimulatedNetwork::NextTransferEndUnsafe()
+    const {
+  if (transfers_.empty()) {
+    return Clock::time_point::max();
+  }
+
+  double bytes_left = std::numeric_limits<double>::max();
+  for (const auto& transfer : transfers_) {
+    bytes_left = std::min(bytes_left, transfer.second);
+  }
+
+  const std::chrono::duration<double> duration(
+      std::max(bytes_left, 0.0) * static_cast<double>(transfers_.size()) /
+      static_cast<double>(settings_.bandwidth));
+  return transfers_update_time_ +
+         std::chrono::duration_cast<Clock::duration>(duration) +
+         Clock::duration(1);
+}
+
+void SimulatedNetwork::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stopped_) {
+    const auto now = Clock::now();
+    AdvanceTransfersUnsafe(now);
+
+    std::vector<Finished> finished;
+    for (auto it = transfers_.begin(); it != transfers_.end();) {
+      if (it->second < kTransferPrecision) {
+        const auto id = it->first;
+        it = transfers_.erase(it);
+        finished.push_back(FinishUnsafe(id, Result::kCompleted, now));
+      } else {
+        ++it;
+      }
+    }
+
+    while (!schedule_.empty() && schedule_.begin()->first <= now) {
+      const auto id = schedule_.begin()->second;
+      schedule_.erase(schedule_.begin());
+
+      auto it = requests_.find(id);
+      if (it == requests_.end()) {
+        continue;
+      }
+
+      auto& request = it->second;
+      if (request.cancelled) {
+        transfers_.erase(id);
+        finished.push_back(FinishUnsafe(id, Result::kCancelled, now));
+      } else if (request.state != State::kWaiting) {
+        // The event of the request that was cancelled before.
+        continue;
+      } else if (request.stall) {
+        finished.push_back(FinishUnsafe(id, Result::kTimedOut, now));
+      } else if (settings_.bandwidth == 0u ||
+                 request.response.body.empty()) {
+        finished.push_back(FinishUnsafe(id, Result::kCompleted, now));
+      } else {
+        request.state = State::kTransferring;
+        transfers_.emplace(
+            id, static_cast<double>(request.response.body.size()));
+      }
+    }
+
+    if (!finished.empty()) {
+      lock.unlock();
+      for (auto& item : finished) {
+        Deliver(item);
+      }
+      lock.lock();
+      continue;
+    }
+
+    auto wake_up_time = NextTransferEndUnsafe();
+    if (!schedule_.empty()) {
+      wake_up_time = std::min(wake_up_time, schedule_.begin()->first);
+    }
+
+    if (wake_up_time == Clock::time_point::max()) {
+      condition_.wait(lock);
+    } else {
+      condition_.wait_until(lock, wake_up_time);
+    }
+  }
+
+  // Cancel the requests that are not completed yet.
+  std::vector<Finished> finished;
+  for (auto& request : requests_) {
+    finished.push_back(Finished{request.first, std::move(request.second),
+                                Result::kCancelled, Clock::now()});
+  }
+  requests_.clear();
+  transfers_.clear();
+  schedule_.clear();
+  lock.unlock();
+
+  for (auto& item : finished) {
+    Deliver(item);
+  }
+}
+
+void SimulatedNetwork::Deliver(Finished& finished) const {
+  auto& request = finished.request;
+  auto response = NetworkResponse().WithRequestId(finished.id);
+
+  if (finished.result == Result::kCancelled) {
+    response.WithStatus(static_cast<int>(ErrorCode::CANCELLED_ERROR))
+        .WithError("Cancelled");
+  } else if (finished.result == Result::kTimedOut) {
+    response.WithStatus(static_cast<int>(ErrorCode::TIMEOUT_ERROR))
+        .WithError("Timed out");
+  } else {
+    const auto& body = request.response.body;
+    if (request.header_callback) {
+      for (const auto& header : request.response.headers) {
+        request.header_callback(header.first, header.second);
+      }
+    }
+
+    if (!body.empty()) {
+      if (request.data_callback) {
+        request.data_callback(reinterpret_cast<const uint8_t*>(body.data()),
+                              0u, body.size());
+      }
+      if (request.payload) {
+        request.payload->write(body.data(),
+                               static_cast<std::streamsize>(body.size()));
+      }
+    }
+
+    const auto queue_end = request.new_connection
+                               ? request.connect_time -
+                                     GetProfile(request.host).connection_setup
+                               : request.connect_time;
+
+    Diagnostics diagnostics;
+    diagnostics.timings[Diagnostics::Queue] =
+        ToMicroSeconds(queue_end - request.send_time);
+    diagnostics.timings[Diagnostics::Connect] =
+        ToMicroSeconds(request.connect_time - queue_end);
+    diagnostics.timings[Diagnostics::Wait] =
+        ToMicroSeconds(request.first_byte_time - request.connect_time);
+    diagnostics.timings[Diagnostics::Receive] =
+        ToMicroSeconds(finished.time - request.first_byte_time);
+    diagnostics.timings[Diagnostics::Total] =
+        ToMicroSeconds(finished.time - request.send_time);
+    for (const auto timing : {Diagnostics::Queue, Diagnostics::Connect,
+                              Diagnostics::Wait, Diagnostics::Receive,
+                              Diagnostics::Total}) {
+      diagnostics.available_timings.set(timing);
+    }
+
+    response.WithStatus(request.response.status)
+        .WithError(olp::http::HttpErrorToString(request.response.status))
+        .WithBytesDownloaded(body.size())
+        .WithDiagnostics(diagnostics);
+  }
+
+  if (request.callback) {
+    request.callback(std::move(response));
+  }
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <regex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "olp/core/http/HttpStatusCode.h"
+#include "olp/core/http/Network.h"
+
+/*
+ * In-process network that simulates the latency, bandwidth, and failures of a
+ * real one. The responses are produced by the generators registered with
+ * `AddResponse`, see `AddOlpServerResponses` for the ones that mirror the
+ * `tests/utils/olp_server` fixtures.
+ *
+ * Every request goes through the following phases:
+ *  - it waits for a free connection to the host, when all of them are busy;
+ *  - it opens a new connection and pays the setup cost, when there is no idle
+ *    one;
+ *  - it waits one round-trip time for the first byte;
+ *  - it downloads the body through the bottleneck link that is shared evenly
+ *    by all the ongoing transfers.
+ *
+ * All the timers are run by a single worker thread, which also calls the
+ * callbacks, so the simulation does not depend on the number of requests.
+ */
+class SimulatedNetwork : public olp::http::Network {
+ public:
+  /*
+   * Network conditions of a single host.
+   */
+  struct HostProfile {
+    // The median of the log-normal round-trip time distribution.
+    std::chrono::milliseconds rtt_median{50};
+    // The shape of the round-trip time distribution. Zero makes it constant,
+    // bigger values give a longer tail.
+    double rtt_sigma{0.5};
+    // The time needed to open a new connection, including TLS handshake.
+    std::chrono::milliseconds connection_setup{100};
+    // The maximum number of connections to the host. The requests above the
+    // limit wait for a connection to be released.
+    size_t max_connections{6u};
+    // The probability that a request fails with an HTTP error.
+    double error_rate{0.0};
+    // The probability that a request stalls until its transfer timeout.
+    double timeout_rate{0.0};
+  };
+
+  struct Settings {
+    // The profile of the hosts that are not listed in `host_profiles`.
+    HostProfile default_profile;
+    // The profiles by host name.
+    std::unordered_map<std::string, HostProfile> host_profiles;
+    // The bandwidth of the bottleneck link in bytes per second. Zero means
+    // that the bodies are delivered together with the first byte.
+    std::uint64_t bandwidth{0u};
+    // The seed of the random generator used for the network conditions.
+    std::uint32_t seed{std::mt19937::default_seed};
+  };
+
+  struct Response {
+    int status{olp::http::HttpStatusCode::OK};
+    olp::http::Headers headers;
+    std::string body;
+  };
+
+  /*
+   * Produces the response for a request. The `match` holds the groups of the
+   * regular expression matched against the URL path.
+   */
+  using ResponseGenerator = std::function<Response(
+      const std::smatch& match, const olp::http::NetworkRequest& request)>;
+
+  struct Counters {
+    size_t requests{0u};
+    size_t connections_opened{0u};
+    size_t injected_errors{0u};
+    size_t injected_timeouts{0u};
+    std::uint64_t bytes_downloaded{0u};
+  };
+
+  explicit SimulatedNetwork(Settings settings);
+  ~SimulatedNetwork() override;
+
+  /*
+   * Registers a generator for the requests to the `host` whose URL path
+   * contains a match of `path_regex`. The generators are tried in the order
+   * of registration, the requests without one get the 404 response.
+   *
+   * Not thread-safe, must be called before the first request is sent.
+   */
+  void AddResponse(const std::string& host, const std::string& path_regex,
+                   ResponseGenerator generator);
+
+  olp::http::SendOutcome Send(olp::http::NetworkRequest request,
+                              Payload payload, Callback callback,
+                              HeaderCallback header_callback = nullptr,
+                              DataCallback data_callback = nullptr) override;
+
+  void Cancel(olp::http::RequestId id) override;
+
+  Counters GetCounters() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  enum class State { kQueued, kWaiting, kTransferring };
+
+  enum class Result { kCompleted, kTimedOut, kCancelled };
+
+  struct PendingRequest {
+    std::string host;
+    Response response;
+    Payload payload;
+    Callback callback;
+    HeaderCallback header_callback;
+    DataCallback data_callback;
+    State state{State::kQueued};
+    bool cancelled{false};
+    bool stall{false};
+    std::chrono::microseconds rtt{0};
+    std::chrono::milliseconds timeout{0};
+    Clock::time_point send_time;
+    Clock::time_point connect_time;
+    Clock::time_point first_byte_time;
+    bool connected{false};
+    bool new_connection{false};
+  };
+
+  struct Host {
+    size_t open_connections{0u};
+    size_t idle_connections{0u};
+    std::deque<olp::http::RequestId> queue;
+  };
+
+  struct Finished {
+    olp::http::RequestId id;
+    PendingRequest request;
+    Result result;
+    Clock::time_point time;
+  };
+
+  struct Route {
+    std::string host;
+    std::regex path_regex;
+    ResponseGenerator generator;
+  };
+
+  const HostProfile& GetProfile(const std::string& host) const;
+  Response GenerateResponse(const olp::http::NetworkRequest& request,
+                            const std::string& host) const;
+
+  /// Starts the queued requests of the host while there are free
+  /// connections. Must be called under the `mutex_`.
+  void DispatchUnsafe(const std::string& host, Clock::time_point now);
+  /// Must be called under the `mutex_`.
+  Finished FinishUnsafe(olp::http::RequestId id, Result result,
+                        Clock::time_point now);
+  /// Must be called under the `mutex_`.
+  void AdvanceTransfersUnsafe(Clock::time_point now);
+  /// Must be called under the `mutex_`.
+  Clock::time_point NextTransferEndUnsafe() const;
+
+  void Run();
+  void Deliver(Finished& finished) const;
+
+  const Settings settings_;
+  std::vector<Route> routes_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopped_{false};
+  std::mt19937 random_;
+  olp::http::RequestId request_id_counter_{
+      static_cast<olp::http::RequestId>(
+          olp::http::RequestIdConstants::RequestIdMin)};
+  std::unordered_map<olp::http::RequestId, PendingRequest> requests_;
+  std::unordered_map<std::string, Host> hosts_;
+  std::multimap<Clock::time_point, olp::http::RequestId> schedule_;
+  // The bytes left to download by the request ID.
+  std::unordered_map<olp::http::RequestId, double> transfers_;
+  Clock::time_point transfers_update_time_;
+  Counters counters_;
+
+  std::thread thread_;
+};
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <olp/core/client/ApiError.h>
+#include <olp/core/client/ApiResponse.h>
+#include <olp/core/client/TaskContext.h>
+#include <olp/core/logging/Log.h>
+#include <olp/core/logging/LogContext.h>
+#include <olp/core/thread/Continuation.h>
+#include <olp/core/thread/ThreadPoolTaskScheduler.h>
+
+namespace {
+std::atomic<size_t> g_allocations{0u};
+}  // namespace
+
+// Counts the heap allocations of the whole test binary. The counter is only
+// read by the tests below, the other tests just pay for an atomic increment.
+void* operator new(std::size_t size) {
+  g_allocations.fetch_add(1u, std::memory_order_relaxed);
+  if (auto* ptr = std::malloc(size != 0u ? size : 1u)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+namespace client = olp::client;
+
+constexpr auto kLogTag = "TaskAllocationTest";
+constexpr size_t kTasks = 100000u;
+constexpr auto kMaxWait = std::chrono::minutes(1);
+
+using Response = client::ApiResponse<size_t, client::ApiError>;
+
+/*
+ * Schedules the tasks with the given function on a single worker and counts
+ * the allocations on all threads until the last task is executed.
+ */
+template <class Schedule>
+void MeasureAllocations(const std::string& name, Schedule schedule) {
+  olp::thread::ThreadPoolTaskScheduler scheduler(1u);
+  std::atomic<size_t> executed{0u};
+  std::promise<void> done;
+  auto future = done.get_future();
+  std::function<void()> on_executed = [&]() {
+    if (++executed == kTasks + 1u) {
+      done.set_value();
+    }
+  };
+
+  // Starts the worker, so its start up is not counted.
+  schedule(scheduler, on_executed);
+  while (executed.load() == 0u) {
+    std::this_thread::yield();
+  }
+
+  const auto start = g_allocations.load();
+  const auto start_time = std::chrono::steady_clock::now();
+  for (size_t i = 0u; i < kTasks; ++i) {
+    schedule(scheduler, on_executed);
+  }
+  ASSERT_EQ(future.wait_for(kMaxWait), std::future_status::ready);
+  const auto allocations = g_allocations.load() - start;
+  const auto duration = std::chrono::steady_clock::now() - start_time;
+
+  const auto per_task =
+      static_cast<double>(allocations) / static_cast<double>(kTasks);
+  const auto ns_per_task =
+      static_cast<double>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+              .count()) /
+      static_cast<double>(kTasks);
+  OLP_SDK_LOG_CRITICAL_INFO_F(kLogTag,
+                              "%s: %.2f allocations, %.0f ns per task",
+                              name.c_str(), per_task, ns_per_task);
+  testing::Test::RecordProperty("allocations_per_task",
+                                std::to_string(per_task));
+}
+
+void ScheduleTask(olp::thread::TaskScheduler& scheduler,
+                  std::function<void()>& callback) {
+  scheduler.ScheduleTask([&callback]() { callback(); });
+}
+
+/*
+ * A plain task without a log context.
+ */
+TEST(TaskAllocationTest, ScheduleTask) {
+  MeasureAllocations("schedule_task", ScheduleTask);
+}
+
+/*
+ * A plain task scheduled with a log context set by the application.
+ */
+TEST(TaskAllocationTest, ScheduleTaskWithLogContext) {
+  auto context = std::make_shared<olp::logging::LogContext>();
+  context->emplace("request", "allocation-test");
+  olp::logging::ScopedLogContext scoped_context(context);
+
+  MeasureAllocations("schedule_task_with_log_context", ScheduleTask);
+}
+
+/*
+ * A task wrapped in a `TaskContext`, as the read clients schedule the
+ * requests. Like in the clients, the functions capture the shared state.
+ */
+TEST(TaskAllocationTest, TaskContext) {
+  auto state = std::make_shared<size_t>(1u);
+  auto schedule = [state](olp::thread::TaskScheduler& scheduler,
+                          std::function<void()>& callback) {
+    auto task = client::TaskContext::Create(
+        [state](client::CancellationContext) { return Response(*state); },
+        [state, &callback](Response) { callback(); });
+    scheduler.ScheduleTask([task]() { task.Execute(); });
+  };
+  MeasureAllocations("task_context", schedule);
+}
+
+/*
+ * A continuation chain of five tasks, built and run per scheduled task. The
+ * intermediate results are strings, so copying them would allocate as well.
+ */
+TEST(TaskAllocationTest, ContinuationChain) {
+  using olp::thread::Continuation;
+  using olp::thread::ExecutionContext;
+  using StringCallback = std::function<void(std::string)>;
+
+  // `Continuation` must outlive its execution, so the chains are kept here.
+  std::vector<Continuation<size_t>> chains;
+  chains.reserve(kTasks + 1u);
+
+  auto schedule = [&chains](olp::thread::TaskScheduler& scheduler,
+                            std::function<void()>& callback) {
+    // Does not own the scheduler, it outlives the chains.
+    std::shared_ptr<olp::thread::TaskScheduler> scheduler_ptr(
+        std::shared_ptr<olp::thread::TaskScheduler>(), &scheduler);
+    chains.emplace_back(
+        Continuation<std::string>(
+            std::move(scheduler_ptr), ExecutionContext(),
+            [](ExecutionContext, StringCallback next) {
+              next(std::string(64u, 'a'));
+            })
+            .Then([](ExecutionContext, std::string value, StringCallback next) {
+              next(std::move(value));
+            })
+            .Then([](ExecutionContext, std::string value, StringCallback next) {
+              next(std::move(value));
+            })
+            .Then([](ExecutionContext, std::string value, StringCallback next) {
+              next(std::move(value));
+            })
+            .Then([](ExecutionContext, std::string value,
+                     std::function<void(size_t)> next) {
+              next(value.size());
+            }));
+    chains.back().Finally([&callback](Response) { callback(); }).Run();
+  };
+  MeasureAllocations("continuation_chain", schedule);
+}
+
+}  // namespace
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 HERE Europe B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * License-Filename: LICENSE
+ */
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <olp/core/logging/Log.h>
+#include <olp/core/thread/ThreadPoolTaskScheduler.h>
+#include <olp/core/thread/WorkStealingTaskScheduler.h>
+
+namespace {
+using SchedulerFactory =
+    std::function<std::shared_ptr<olp::thread::TaskScheduler>(size_t)>;
+
+struct TestConfiguration {
+  std::string configuration_name;
+  SchedulerFactory create_scheduler;
+  size_t worker_thread_count = 4u;
+  /// The threads that schedule the tasks from outside of the scheduler.
+  size_t producer_thread_count = 4u;
+  /// The tasks scheduled by every producer.
+  size_t tasks_per_producer = 50000u;
+  /// The tasks spawned by every task of a producer from a worker thread.
+  size_t spawned_tasks_per_task = 0u;
+};
+
+std::ostream& operator<<(std::ostream& os, const TestConfiguration& config) {
+  return os << "TestConfiguration("
+            << ".configuration_name=" << config.configuration_name
+            << ", .worker_thread_count=" << config.worker_thread_count
+            << ", .producer_thread_count=" << config.producer_thread_count
+            << ", .tasks_per_producer=" << config.tasks_per_producer
+            << ", .spawned_tasks_per_task=" << config.spawned_tasks_per_task
+            << ")";
+}
+
+constexpr auto kLogTag = "TaskSchedulerTest";
+constexpr auto kMaxWait = std::chrono::minutes(2);
+
+/// A small amount of work, similar to the bookkeeping of a prefetch task.
+void SmallWork() {
+  volatile uint32_t value = 0u;
+  for (auto i = 0; i < 64; ++i) {
+    value = value + i;
+  }
+}
+
+class TaskSchedulerTest : public ::testing::TestWithParam<TestConfiguration> {
+};
+
+TEST_P(TaskSchedulerTest, Throughput) {
+  const auto& parameter = GetParam();
+  auto scheduler = parameter.create_scheduler(parameter.worker_thread_count);
+
+  const auto total_tasks =
+      parameter.producer_thread_count * parameter.tasks_per_producer *
+      (1u + parameter.spawned_tasks_per_task);
+
+  std::atomic<size_t> executed{0u};
+  std::promise<void> done;
+  auto on_executed = [&]() {
+    if (++executed == total_tasks) {
+      done.set_value();
+    }
+  };
+
+  auto task = [&]() {
+    for (size_t i = 0u; i < parameter.spawned_tasks_per_task; ++i) {
+      scheduler->ScheduleTask([&]() {
+        SmallWork();
+        on_executed();
+      });
+    }
+    SmallWork();
+    on_executed();
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> producers;
+  for (size_t i = 0u; i < parameter.producer_thread_count; ++i) {
+    producers.emplace_back([&]() {
+      for (size_t j = 0u; j < parameter.tasks_per_producer; ++j) {
+        scheduler->ScheduleTask(task);
+      }
+    });
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  ASSERT_EQ(done.get_future().wait_for(kMaxWait), std::future_status::ready);
+
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+  const auto tasks_per_second = static_cast<size_t>(
+      static_cast<double>(total_tasks) * 1e6 /
+      static_cast<double>(std::max<int64_t>(elapsed.count(), 1)));
+
+  OLP_SDK_LOG_CRITICAL_INFO_F(kLogTag,
+                              "%s: %zu tasks in %lld us, %zu tasks per second",
+                              parameter.configuration_name.c_str(),
+                              total_tasks,
+                              static_cast<long long>(elapsed.count()),
+                              tasks_per_second);
+  Test::RecordProperty("elapsed_us", std::to_string(elapsed.count()));
+  Test::RecordProperty("tasks_per_second", std::to_string(tasks_per_second));
+}
+
+std::shared_ptr<olp::thread::TaskScheduler> CreateThreadPool(size_t threads) {
+  return std::make_shared<olp::thread::ThreadPoolTaskScheduler>(threads);
+}
+
+std::shared_ptr<olp::thread::TaskScheduler> CreateWorkStealing(
+    size_t threads) {
+  return std::make_shared<olp::thread::WorkStealingTaskScheduler>(threads);
+}
+
+/*
+ * Many small tasks scheduled by the application threads.
+ */
+TestConfiguration ExternalTasks(std::string name, SchedulerFactory factory) {
+  TestConfiguration configuration;
+  configuration.configuration_name = std::move(name);
+  configuration.create_scheduler = std::move(factory);
+  return configuration;
+}
+
+/*
+ * Every task schedules more tasks from the worker, like the prefetch jobs do.
+ */
+TestConfiguration SpawnedTasks(std::string name, SchedulerFactory factory) {
+  TestConfiguration configuration;
+  configuration.configuration_name = std::move(name);
+  configuration.create_scheduler = std::move(factory);
+  configuration.producer_thread_count = 1u;
+  configuration.tasks_per_producer = 2000u;
+  configuration.spawned_tasks_per_task = 100u;
+  return configuration;
+}
+
+std::vector<TestConfiguration> Configurations() {
+  std::vector<TestConfiguration> configurations;
+  configurations.emplace_back(
+      ExternalTasks("external_tasks_thread_pool", CreateThreadPool));
+  configurations.emplace_back(
+      ExternalTasks("external_tasks_work_stealing", CreateWorkStealing));
+  configurations.emplace_back(
+      SpawnedTasks("spawned_tasks_thread_pool", CreateThreadPool));
+  configurations.emplace_back(
+      SpawnedTasks("spawned_tasks_work_stealing", CreateWorkStealing));
+  return configurations;
+}
+
+std::string TestName(const testing::TestParamInfo<TestConfiguration>& info) {
+  return info.param.configuration_name;
+}
+
+INSTANTIATE_TEST_SUITE_P(Performance, TaskSchedulerTest,
+                         ::testing::ValuesIn(Configurations()), TestName);
+}  // namespace